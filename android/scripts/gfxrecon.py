@@ -92,9 +92,13 @@ def CreateReplayParser():
     parser.add_argument('--quit-after-measurement-range', action='store_true', default=False, help='If this is specified the replayer will abort when it reaches the <end_frame> specified in the --measurement-frame-range argument. (forwarded to replay tool)')
     parser.add_argument('--flush-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at the start and end of the measurement range. (forwarded to replay tool)')
     parser.add_argument('--flush-inside-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at end of each frame inside the measurement range. (forwarded to replay tool)')
+    parser.add_argument('--measurement-cost-breakdown', action='store_true', default=False, help='Attribute the replay time of each frame in the measurement range to file read, decompression, decode, consumer work, device waits, and resource initialization, and write the per frame times with p50/p95/p99 summaries to the measurement file. (forwarded to replay tool)')
+    parser.add_argument('--decode-block-size', metavar='BYTES', help='Size of the memory blocks used for decoded API call parameters. Parameters that are larger than a block are allocated separately, and the allocations are reused by later calls. Valid values are 4096 to 1073741824. Default is 65536. (forwarded to replay tool)')
+    parser.add_argument('--decode-huge-pages', action='store_true', default=False, help='Request transparent huge page backing for decoded API call parameter memory allocations of 2 MiB or larger. (forwarded to replay tool)')
     parser.add_argument('--sgfs', '--skip-get-fence-status', metavar='STATUS', default=0, help='Specify behaviour to skip calls to vkWaitForFences and vkGetFenceStatus. Default is 0 - No skip (forwarded to replay tool)')
     parser.add_argument('--sgfr', '--skip-get-fence-ranges', metavar='FRAME-RANGES', default='', help='Frame ranges where --sgfs applies. Default is all frames (forwarded to replay tool)')
     parser.add_argument('--wait-before-present', action='store_true', default=False, help='Force wait on completion of queue operations for all queues before calling Present. This is needed for accurate acquisition of instrumentation data on some platforms.')
+    parser.add_argument('--reuse-command-buffers', action='store_true', default=False, help='Skip recording a command buffer when its recorded calls are identical to its previous recording, keeping the previously recorded command buffer. Not supported with --dump-resources.')
     parser.add_argument('-m', '--memory-translation', metavar='MODE', choices=['none', 'remap', 'realign', 'rebind'], help='Enable memory translation for replay on GPUs with memory types that are not compatible with the capture GPU\'s memory types.  Available modes are: none, remap, realign, rebind (forwarded to replay tool)')
     parser.add_argument('--swapchain', metavar='MODE', choices=['virtual', 'captured', 'offscreen'], help='Choose a swapchain mode to replay. Available modes are: virtual, captured, offscreen (forwarded to replay tool)')
     parser.add_argument('--vssb', '--virtual-swapchain-skip-blit', action='store_true', default=False, help='Skip blit to real swapchain to gain performance during replay.')
@@ -207,6 +211,16 @@ def MakeExtrasString(args):
     if args.flush_inside_measurement_range:
         arg_list.append('--flush-inside-measurement-range')
 
+    if args.measurement_cost_breakdown:
+        arg_list.append('--measurement-cost-breakdown')
+
+    if args.decode_block_size:
+        arg_list.append('--decode-block-size')
+        arg_list.append('{}'.format(args.decode_block_size))
+
+    if args.decode_huge_pages:
+        arg_list.append('--decode-huge-pages')
+
     if args.swapchain:
         arg_list.append('--swapchain')
         arg_list.append('{}'.format(args.swapchain))
@@ -232,6 +246,9 @@ def MakeExtrasString(args):
     if args.wait_before_present:
         arg_list.append('--wait-before-present')
 
+    if args.reuse_command_buffers:
+        arg_list.append('--reuse-command-buffers')
+
     if args.dump_resources:
         arg_list.append('--dump-resources')
         arg_list.append('{}'.format(args.dump_resources))
@@ -89,6 +89,21 @@ class ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    /// Decoders that do not override this receive a fill memory command for each changed span of the delta.
+    virtual void DispatchFillMemoryDeltaCommand(format::ThreadId                   thread_id,
+                                                uint64_t                           memory_id,
+                                                uint64_t                           offset,
+                                                uint64_t                           span_count,
+                                                const format::FillMemoryDeltaSpan* spans,
+                                                const uint8_t*                     data)
+    {
+        for (uint64_t i = 0; i < span_count; ++i)
+        {
+            DispatchFillMemoryCommand(thread_id, memory_id, offset + spans[i].offset, spans[i].size, data);
+            data += spans[i].size;
+        }
+    }
+
     virtual void
     DispatchFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
                                            const uint8_t*                                      data) = 0;
@@ -35,6 +35,7 @@
 #include "util/defines.h"
 
 #include <numeric>
+#include <unordered_set>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -51,6 +52,17 @@ class CommonConsumerBase : public MetadataConsumerBase, public MarkerConsumerBas
     virtual bool IsComplete(uint64_t block_index) { return false; }
 
     virtual void SetCurrentBlockIndex(uint64_t block_index) override { block_index_ = block_index; }
+
+    // Consumers that only process a small subset of the API calls or meta-data commands in a capture file can
+    // override these to fill in the IDs that they process and return true.  Decoders skip calls that none of their
+    // consumers process, and the file processor skips reading the blocks that no decoder supports.  The default
+    // return value of false indicates that the consumer processes everything.
+    virtual bool GetProcessedApiCalls(std::unordered_set<format::ApiCallId>* api_calls) const { return false; }
+
+    virtual bool GetProcessedMetaDataTypes(std::unordered_set<format::MetaDataType>* meta_data_types) const
+    {
+        return false;
+    }
 };
 
 /* Utility */
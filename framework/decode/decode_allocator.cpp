@@ -27,6 +27,9 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+size_t           DecodeAllocator::block_size_{ DecodeAllocator::kDefaultBlockSize };
+size_t           DecodeAllocator::max_cached_bytes_{ DecodeAllocator::kDefaultMaxCachedBytes };
+bool             DecodeAllocator::use_huge_pages_{ false };
 
 void DecodeAllocator::Begin()
 {
@@ -38,6 +41,25 @@ void DecodeAllocator::Begin()
     instance_->can_allocate_ = true;
 }
 
+void DecodeAllocator::Configure(size_t block_size, size_t max_cached_bytes, bool use_huge_pages)
+{
+    assert((instance_ == nullptr) || !instance_->can_allocate_);
+
+    block_size_       = kDefaultBlockSize;
+    max_cached_bytes_ = max_cached_bytes;
+    use_huge_pages_   = use_huge_pages;
+
+    if (block_size > 0)
+    {
+        block_size_ = block_size;
+    }
+
+    if (instance_ != nullptr)
+    {
+        DestroyInstance();
+    }
+}
+
 void DecodeAllocator::End()
 {
     assert((instance_ != nullptr) && instance_->can_allocate_);
@@ -32,11 +32,22 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 class DecodeAllocator
 {
+  public:
+    static const size_t kDefaultBlockSize{ 64 * 1024 };
+    static const size_t kDefaultMaxCachedBytes{ 64 * 1024 * 1024 };
+    static const size_t kMinBlockSize{ 4 * 1024 };
+    static const size_t kMaxBlockSize{ 1024 * 1024 * 1024 };
+
   public:
     // Begin must be called before any calls to Allocate (either initially or since End was called). This ensures
     // allocations are not made outside the intended scope. Also creates the allocator instance if it is nullptr.
     static void Begin();
 
+    // Sets the memory block size, the maximum size of the oversized allocations that are cached for reuse by later
+    // calls, and whether transparent huge page backing is requested for large allocations. Must not be called between
+    // Begin and End. Replaces the allocator instance when it has already been created.
+    static void Configure(size_t block_size, size_t max_cached_bytes, bool use_huge_pages);
+
     template <typename T>
     static T* Allocate(size_t count = 1, bool initialize = true)
     {
@@ -59,11 +70,15 @@ class DecodeAllocator
     static void DestroyInstance();
 
   private:
-    DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false), end_can_clear_(true) {}
+    DecodeAllocator() :
+        allocator_(block_size_, max_cached_bytes_, use_huge_pages_), can_allocate_(false), end_can_clear_(true)
+    {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
     static DecodeAllocator* instance_;
+    static size_t           block_size_;
+    static size_t           max_cached_bytes_;
+    static bool             use_huge_pages_;
 
     util::MonotonicAllocator allocator_;
     bool                     can_allocate_;
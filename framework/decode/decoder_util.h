@@ -27,6 +27,8 @@
 #include "decode/vulkan_object_info.h"
 
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -49,6 +51,53 @@ bool IsComplete(std::vector<T>& consumers, uint64_t block_index)
     return consumers.empty();
 }
 
+// Tracks the union of the API calls and meta-data commands processed by a decoder's consumers, so that the decoder can
+// report the calls that it does not need to decode.  Everything is accepted when any of the consumers does not
+// declare the calls that it processes, and nothing is accepted when there are no consumers.
+class ConsumerCallFilter
+{
+  public:
+    template <typename T>
+    void Update(const std::vector<T>& consumers)
+    {
+        accept_all_api_calls_       = false;
+        accept_all_meta_data_types_ = false;
+        api_calls_.clear();
+        meta_data_types_.clear();
+
+        for (const auto consumer : consumers)
+        {
+            if (!accept_all_api_calls_ && !consumer->GetProcessedApiCalls(&api_calls_))
+            {
+                accept_all_api_calls_ = true;
+                api_calls_.clear();
+            }
+
+            if (!accept_all_meta_data_types_ && !consumer->GetProcessedMetaDataTypes(&meta_data_types_))
+            {
+                accept_all_meta_data_types_ = true;
+                meta_data_types_.clear();
+            }
+        }
+    }
+
+    bool AcceptsApiCall(format::ApiCallId call_id) const
+    {
+        return accept_all_api_calls_ || (api_calls_.find(call_id) != api_calls_.end());
+    }
+
+    bool AcceptsMetaDataType(format::MetaDataType meta_data_type) const
+    {
+        return accept_all_meta_data_types_ || (meta_data_types_.find(meta_data_type) != meta_data_types_.end());
+    }
+
+  private:
+    bool                                     accept_all_api_calls_{ false };
+    bool                                     accept_all_meta_data_types_{ false };
+    std::unordered_set<format::ApiCallId>    api_calls_;
+    std::unordered_set<format::MetaDataType> meta_data_types_;
+};
+
 static VkQueue GetDeviceQueue(const encode::VulkanDeviceTable* device_table,
                               const DeviceInfo*                device_info,
                               uint32_t                         queue_family_index,
@@ -34,6 +34,8 @@
 #include <d3d12.h>
 #include <dxgi1_5.h>
 
+#include <unordered_set>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -47,6 +49,14 @@ class Dx12ConsumerBase : public MetadataConsumerBase, public MarkerConsumerBase
 
     virtual bool IsComplete(uint64_t block_index) { return false; }
 
+    // See CommonConsumerBase::GetProcessedApiCalls() and CommonConsumerBase::GetProcessedMetaDataTypes().
+    virtual bool GetProcessedApiCalls(std::unordered_set<format::ApiCallId>* api_calls) const { return false; }
+
+    virtual bool GetProcessedMetaDataTypes(std::unordered_set<format::MetaDataType>* meta_data_types) const
+    {
+        return false;
+    }
+
     virtual void ProcessInitDx12AccelerationStructureCommand(
         const format::InitDx12AccelerationStructureCommandHeader&       command_header,
         std::vector<format::InitDx12AccelerationStructureGeometryDesc>& geometry_descs,
@@ -44,14 +44,28 @@ class Dx12DecoderBase : public ApiDecoder
 
     virtual bool IsComplete(uint64_t block_index) override
     {
-        return decode::IsComplete<Dx12Consumer*>(consumers_, block_index);
+        size_t consumer_count = consumers_.size();
+        bool   complete       = decode::IsComplete<Dx12Consumer*>(consumers_, block_index);
+
+        // Calls that were only processed by the completed consumers no longer need to be decoded.
+        if (consumers_.size() != consumer_count)
+        {
+            call_filter_.Update(consumers_);
+        }
+
+        return complete;
     }
 
-    void AddConsumer(Dx12Consumer* consumer) { consumers_.push_back(consumer); }
+    void AddConsumer(Dx12Consumer* consumer)
+    {
+        consumers_.push_back(consumer);
+        call_filter_.Update(consumers_);
+    }
 
     void RemoveConsumer(Dx12Consumer* consumer)
     {
         consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer));
+        call_filter_.Update(consumers_);
     }
 
     virtual void WaitIdle() override {}
@@ -60,13 +74,15 @@ class Dx12DecoderBase : public ApiDecoder
     {
         auto family_id = format::GetApiCallFamily(call_id);
         return ((family_id == format::ApiFamilyId::ApiFamily_Dxgi) ||
-                (family_id == format::ApiFamilyId::ApiFamily_D3D12));
+                (family_id == format::ApiFamilyId::ApiFamily_D3D12)) &&
+               call_filter_.AcceptsApiCall(call_id);
     }
 
     virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override
     {
         format::ApiFamilyId api = format::GetMetaDataApi(meta_data_id);
-        return (api == format::ApiFamilyId::ApiFamily_Dxgi) || (api == format::ApiFamilyId::ApiFamily_D3D12);
+        return ((api == format::ApiFamilyId::ApiFamily_Dxgi) || (api == format::ApiFamilyId::ApiFamily_D3D12)) &&
+               call_filter_.AcceptsMetaDataType(format::GetMetaDataType(meta_data_id));
     }
 
     virtual void DecodeFunctionCall(format::ApiCallId  call_id,
@@ -265,6 +281,7 @@ class Dx12DecoderBase : public ApiDecoder
 
   private:
     std::vector<Dx12Consumer*> consumers_;
+    ConsumerCallFilter         call_filter_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
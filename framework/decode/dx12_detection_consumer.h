@@ -59,6 +59,17 @@ class Dx12DetectionConsumer : public Dx12Consumer
         return ((block_limit_ != kNoBlockLimit) && (block_index > block_limit_)) || WasD3D12APIDetected();
     }
 
+    virtual bool GetProcessedApiCalls(std::unordered_set<format::ApiCallId>* api_calls) const override
+    {
+        api_calls->insert(format::ApiCallId::ApiCall_D3D12CreateDevice);
+        return true;
+    }
+
+    virtual bool GetProcessedMetaDataTypes(std::unordered_set<format::MetaDataType>* meta_data_types) const override
+    {
+        return true;
+    }
+
   private:
     const uint64_t block_limit_;
     bool           dx12_consumer_usage_;
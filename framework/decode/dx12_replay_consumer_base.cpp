@@ -262,7 +262,7 @@ void Dx12ReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id,
         auto copy_size      = static_cast<size_t>(size);
         auto mapped_pointer = static_cast<uint8_t*>(entry->second.data_pointer) + offset;
 
-        util::platform::MemoryCopy(mapped_pointer, copy_size, data, copy_size);
+        util::platform::MappedMemoryCopy(mapped_pointer, copy_size, data, copy_size);
 
         ApplyFillMemoryResourceValueCommand(offset, size, data, static_cast<uint8_t*>(entry->second.data_pointer));
 
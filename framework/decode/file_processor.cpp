@@ -40,7 +40,7 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 const uint32_t kFirstFrame = 0;
 
 FileProcessor::FileProcessor() :
-    file_header_{}, file_descriptor_(nullptr), current_frame_number_(kFirstFrame), bytes_read_(0),
+    file_header_{}, file_descriptor_(nullptr), current_frame_number_(kFirstFrame), bytes_read_(0), block_offset_(0),
     error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr), block_index_(0),
     api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false), first_frame_(kFirstFrame + 1)
 {}
@@ -441,6 +441,8 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 
     bool success = false;
 
+    block_offset_ = bytes_read_;
+
     if (ReadBytes(block_header, sizeof(*block_header)))
     {
         success = true;
@@ -478,6 +480,8 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
             parameter_buffer_.resize(expected_uncompressed_size);
         }
 
+        graphics::ReplayCostTracker::Scope cost_scope(cost_tracker_, graphics::ReplayCostTracker::kDecompress);
+
         size_t uncompressed_size = compressor_->Decompress(
             compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
@@ -491,6 +495,8 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
 
 bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
+    graphics::ReplayCostTracker::Scope cost_scope(cost_tracker_, graphics::ReplayCostTracker::kFileRead);
+
     size_t bytes_read = util::platform::FileRead(buffer, 1, buffer_size, file_descriptor_);
     bytes_read_ += bytes_read;
     return (bytes_read == buffer_size);
@@ -498,6 +504,8 @@ bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
+    graphics::ReplayCostTracker::Scope cost_scope(cost_tracker_, graphics::ReplayCostTracker::kFileRead);
+
     bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
 
     if (success)
@@ -534,7 +542,16 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     {
         parameter_buffer_size -= sizeof(call_info.thread_id);
 
-        if (format::IsBlockCompressed(block_header.type))
+        if (!IsApiCallSupported(call_id))
+        {
+            success = SkipBytes(parameter_buffer_size);
+
+            if (!success)
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to skip function call block data");
+            }
+        }
+        else if (format::IsBlockCompressed(block_header.type))
         {
             parameter_buffer_size -= sizeof(uncompressed_size);
             success = ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
@@ -576,6 +593,8 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
 
         if (success)
         {
+            graphics::ReplayCostTracker::Scope cost_scope(cost_tracker_, graphics::ReplayCostTracker::kDecode);
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
@@ -610,7 +629,16 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header, f
     {
         parameter_buffer_size -= (sizeof(object_id) + sizeof(call_info.thread_id));
 
-        if (format::IsBlockCompressed(block_header.type))
+        if (!IsApiCallSupported(call_id))
+        {
+            success = SkipBytes(parameter_buffer_size);
+
+            if (!success)
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to skip method call block data");
+            }
+        }
+        else if (format::IsBlockCompressed(block_header.type))
         {
             parameter_buffer_size -= sizeof(uncompressed_size);
             success = ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
@@ -652,6 +680,8 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header, f
 
         if (success)
         {
+            graphics::ReplayCostTracker::Scope cost_scope(cost_tracker_, graphics::ReplayCostTracker::kDecode);
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
@@ -675,13 +705,63 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header, f
     return success;
 }
 
+bool FileProcessor::IsApiCallSupported(format::ApiCallId call_id)
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FileProcessor::IsMetaDataSupported(format::MetaDataId meta_data_id)
+{
+    // These commands are dispatched to every decoder, without checking for decoder support.
+    format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+    if ((meta_data_type == format::MetaDataType::kDriverInfoCommand) ||
+        (meta_data_type == format::MetaDataType::kCreateHeapAllocationCommand) ||
+        (meta_data_type == format::MetaDataType::kDxgiAdapterInfoCommand) ||
+        (meta_data_type == format::MetaDataType::kDx12RuntimeInfoCommand))
+    {
+        return true;
+    }
+
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataId(meta_data_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
+    // Parsing the meta-data block is decode time.  Reads, decompression, and the consumer calls made by the decoder
+    // dispatch functions enter their own nested stages.
+    graphics::ReplayCostTracker::Scope cost_scope(cost_tracker_, graphics::ReplayCostTracker::kDecode);
+
     bool success = false;
 
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
 
-    if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+    if (!IsMetaDataSupported(meta_data_id))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_data_id));
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip meta-data block");
+        }
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
     {
         format::FillMemoryCommandHeader header;
 
@@ -741,6 +821,104 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryDeltaCommand)
+    {
+        format::FillMemoryDeltaCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+        success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+        success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+        success = success && ReadBytes(&header.span_count, sizeof(header.span_count));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+            const uint64_t fields_size = sizeof(meta_data_id) + sizeof(header.thread_id) + sizeof(header.memory_id) +
+                                         sizeof(header.memory_offset) + sizeof(header.memory_size) +
+                                         sizeof(header.span_count) + sizeof(header.data_size);
+
+            const uint64_t payload_size = (block_header.size > fields_size) ? (block_header.size - fields_size) : 0;
+
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+
+                success = ReadCompressedParameterBuffer(
+                    static_cast<size_t>(payload_size), static_cast<size_t>(header.data_size), &uncompressed_size);
+            }
+            else
+            {
+                // Uncompressed data must exactly fill the rest of the block.
+                success = (header.data_size == payload_size) && ReadParameterBuffer(static_cast<size_t>(payload_size));
+            }
+
+            if (success)
+            {
+                // The span table is followed by the changed bytes, which must account for the rest of the data.  Each
+                // span must be within the memory range that was checked for changes.
+                const auto* spans = reinterpret_cast<const format::FillMemoryDeltaSpan*>(parameter_buffer_.data());
+
+                const uint64_t max_span_count = header.data_size / sizeof(format::FillMemoryDeltaSpan);
+                uint64_t       table_size     = 0;
+                uint64_t       span_bytes     = 0;
+                bool           valid          = (header.span_count <= max_span_count);
+
+                if (valid)
+                {
+                    table_size = header.span_count * sizeof(format::FillMemoryDeltaSpan);
+
+                    for (uint64_t i = 0; valid && (i < header.span_count); ++i)
+                    {
+                        const uint64_t span_end = static_cast<uint64_t>(spans[i].offset) + spans[i].size;
+
+                        span_bytes += spans[i].size;
+                        valid = (span_end <= header.memory_size) && (span_bytes <= (header.data_size - table_size));
+                    }
+                }
+
+                if (valid && (span_bytes == (header.data_size - table_size)))
+                {
+                    for (auto decoder : decoders_)
+                    {
+                        if (decoder->SupportsMetaDataId(meta_data_id))
+                        {
+                            decoder->DispatchFillMemoryDeltaCommand(header.thread_id,
+                                                                    header.memory_id,
+                                                                    header.memory_offset,
+                                                                    header.span_count,
+                                                                    spans,
+                                                                    parameter_buffer_.data() + table_size);
+                        }
+                    }
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData,
+                                         "Invalid span table in fill memory delta meta-data block");
+                    success = false;
+                }
+            }
+            else
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                         "Failed to read fill memory delta meta-data block");
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory delta meta-data block");
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory delta meta-data block header");
+        }
+    }
     else if (meta_data_type == format::MetaDataType::kFillMemoryResourceValueCommand)
     {
         format::FillMemoryResourceValueCommandHeader header;
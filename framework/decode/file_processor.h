@@ -28,6 +28,7 @@
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "graphics/replay_cost_tracker.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
@@ -93,6 +94,10 @@ class FileProcessor
 
     uint64_t GetNumBytesRead() const { return bytes_read_; }
 
+    // File offset of the block header for the block that is currently being processed.  Consumers can combine this
+    // with GetNumBytesRead() to determine the file range that contains the block being dispatched.
+    uint64_t GetCurrentBlockOffset() const { return block_offset_; }
+
     Error GetErrorState() const { return error_state_; }
 
     bool EntireFileWasProcessed() const { return (feof(file_descriptor_) != 0); }
@@ -106,6 +111,9 @@ class FileProcessor
         block_index_to_          = block_index_to;
     }
 
+    // Attributes the time spent reading, decompressing, and decoding blocks to the corresponding replay stages.
+    void SetCostTracker(graphics::ReplayCostTracker* cost_tracker) { cost_tracker_ = cost_tracker; }
+
   protected:
     bool ContinueDecoding();
 
@@ -121,6 +129,11 @@ class FileProcessor
 
     bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    // Blocks that are not supported by any decoder are skipped without being read or decompressed.
+    bool IsApiCallSupported(format::ApiCallId call_id);
+
+    bool IsMetaDataSupported(format::MetaDataId meta_data_id);
+
     bool IsFrameDelimiter(format::BlockType block_type, format::MarkerType marker_type) const;
 
     bool IsFrameDelimiter(format::ApiCallId call_id) const;
@@ -164,6 +177,7 @@ class FileProcessor
     std::vector<format::FileOptionPair> file_options_;
     format::EnabledOptions              enabled_options_;
     uint64_t                            bytes_read_;
+    uint64_t                            block_offset_;
     std::vector<uint8_t>                parameter_buffer_;
     std::vector<uint8_t>                compressed_parameter_buffer_;
     util::Compressor*                   compressor_;
@@ -174,6 +188,7 @@ class FileProcessor
     bool                                enable_print_block_info_{ false };
     int64_t                             block_index_from_{ 0 };
     int64_t                             block_index_to_{ 0 };
+    graphics::ReplayCostTracker*        cost_tracker_{ nullptr };
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -26,11 +26,14 @@
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+const uint64_t kCopyRangeChunkSize = 32 * 1024 * 1024;
+
 FileTransformer::FileTransformer() :
     file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
     error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
@@ -109,6 +112,8 @@ bool FileTransformer::Process()
         block_index_++;
     }
 
+    FinishProcessing();
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
@@ -257,19 +262,7 @@ bool FileTransformer::ProcessNextBlock()
         }
         else
         {
-            // Copy the block to the output file.
-            success = WriteBlockHeader(block_header);
-
-            if (success)
-            {
-                success = CopyBytes(block_header.size);
-
-                if (!success)
-                {
-                    GFXRECON_LOG_ERROR("Failed to write block data");
-                    error_state_ = kErrorWritingBlockData;
-                }
-            }
+            success = CopyBlock(block_header);
         }
     }
     else
@@ -285,6 +278,25 @@ bool FileTransformer::ProcessNextBlock()
     return success;
 }
 
+bool FileTransformer::CopyBlock(const format::BlockHeader& block_header)
+{
+    // Copy the block to the output file.
+    bool success = WriteBlockHeader(block_header);
+
+    if (success)
+    {
+        success = CopyBytes(block_header.size);
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to write block data");
+            error_state_ = kErrorWritingBlockData;
+        }
+    }
+
+    return success;
+}
+
 bool FileTransformer::ReadBlockHeader(format::BlockHeader* block_header)
 {
     assert(block_header != nullptr);
@@ -377,6 +389,29 @@ bool FileTransformer::SkipBytes(uint64_t skip_size)
     return success;
 }
 
+bool FileTransformer::CopyRange(uint64_t copy_size)
+{
+    uint64_t copied = util::platform::FileCopyRange(output_file_, input_file_, copy_size);
+
+    bytes_read_ += copied;
+    bytes_written_ += copied;
+
+    // Data that could not be copied in-kernel is copied through the parameter buffer, in chunks of a bounded size.
+    while (copied < copy_size)
+    {
+        const uint64_t chunk_size = std::min(copy_size - copied, kCopyRangeChunkSize);
+
+        if (!CopyBytes(chunk_size))
+        {
+            return false;
+        }
+
+        copied += chunk_size;
+    }
+
+    return true;
+}
+
 bool FileTransformer::CopyBytes(uint64_t copy_size)
 {
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, copy_size);
@@ -423,13 +458,15 @@ void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_m
     }
 }
 
-bool FileTransformer::CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor)
+bool FileTransformer::CreateCompressor(format::CompressionType            type,
+                                       std::unique_ptr<util::Compressor>* compressor,
+                                       int                                level)
 {
     assert(compressor != nullptr);
 
     if (type != format::CompressionType::kNone)
     {
-        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type));
+        (*compressor) = std::unique_ptr<util::Compressor>(format::CreateCompressor(type, level));
 
         if ((*compressor) == nullptr)
         {
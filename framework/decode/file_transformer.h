@@ -117,13 +117,18 @@ class FileTransformer
 
     bool CopyBytes(uint64_t copy_size);
 
+    // Copies a large range of the input file to the output file, without reading it into the parameter buffer when the
+    // platform supports in-kernel file copies.
+    bool CopyRange(uint64_t copy_size);
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     void HandleBlockWriteError(Error error_code, const char* error_message);
 
     void HandleBlockCopyError(Error error_code, const char* error_message);
 
-    bool CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor);
+    // A level of 0 selects the default level of the compression type.
+    bool CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor, int level = 0);
 
     virtual bool WriteFileHeader(const format::FileHeader& header, const std::vector<format::FileOptionPair>& options);
 
@@ -136,6 +141,12 @@ class FileTransformer
 
     virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    // Copies a block that is not handled by the other Process functions to the output file.
+    virtual bool CopyBlock(const format::BlockHeader& block_header);
+
+    // Called when block processing stops, at the end of the file or after an error, to complete any deferred output.
+    virtual bool FinishProcessing() { return true; }
+
     uint64_t GetCurrentBlockIndex() { return block_index_; }
 
   private:
@@ -51,9 +51,13 @@ class InfoDecoder : public ApiDecoder
 
     void AddConsumer(InfoConsumer* consumer) { consumers_.push_back(consumer); }
 
-    virtual bool SupportsApiCall(format::ApiCallId id) override { return true; }
+    virtual bool SupportsApiCall(format::ApiCallId id) override { return false; }
 
-    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override { return true; }
+    // Driver info is dispatched to all decoders, so only the executable info needs to be requested.
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override
+    {
+        return (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kExeFileInfoCommand);
+    }
 
     virtual void DecodeFunctionCall(format::ApiCallId  id,
                                     const ApiCallInfo& call_info,
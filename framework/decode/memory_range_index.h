@@ -0,0 +1,163 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_MEMORY_RANGE_INDEX_H
+#define GFXRECON_DECODE_MEMORY_RANGE_INDEX_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Index of the ranges of a memory object that resources are bound to, for finding the resources that overlap a range
+// of memory without visiting every resource bound to the memory object.  Entries are kept sorted by start offset,
+// with a tree holding the maximum end offset of each span of entries, which is rebuilt by the first search following
+// a change to the entries.  Ranges may overlap, as resources can alias the same memory.
+template <typename Value>
+class MemoryRangeIndex
+{
+  public:
+    void Insert(uint64_t offset, uint64_t size, Value value)
+    {
+        // Entries with the same offset are kept in insertion order.
+        auto iter = std::upper_bound(entries_.begin(), entries_.end(), offset, IsOffsetBeforeEntry);
+
+        entries_.insert(iter, { offset, offset + size, value });
+        tree_valid_ = false;
+    }
+
+    // Removes the entry for value, which must have been inserted with the same offset.
+    bool Remove(uint64_t offset, Value value)
+    {
+        auto iter = std::lower_bound(entries_.begin(), entries_.end(), offset, IsEntryBeforeOffset);
+
+        for (; (iter != entries_.end()) && (iter->start == offset); ++iter)
+        {
+            if (iter->value == value)
+            {
+                entries_.erase(iter);
+                tree_valid_ = false;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Clear()
+    {
+        entries_.clear();
+        tree_valid_ = false;
+    }
+
+    size_t GetCount() const { return entries_.size(); }
+
+    // Calls function with the value of each entry whose range overlaps the range from start to end, in order of entry
+    // offset.  Range ends are exclusive.  The entries must not be modified by function.
+    template <typename Function>
+    void ForEachOverlap(uint64_t start, uint64_t end, Function function)
+    {
+        if (!tree_valid_)
+        {
+            BuildTree();
+        }
+
+        // Only entries that begin before the end of the range can overlap it.
+        auto limit = std::lower_bound(entries_.begin(), entries_.end(), end, IsEntryBeforeOffset);
+
+        VisitNode(1, 0, leaf_count_, static_cast<size_t>(limit - entries_.begin()), start, function);
+    }
+
+  private:
+    struct Entry
+    {
+        uint64_t start;
+        uint64_t end;
+        Value    value;
+    };
+
+  private:
+    static bool IsEntryBeforeOffset(const Entry& entry, uint64_t offset) { return entry.start < offset; }
+
+    static bool IsOffsetBeforeEntry(uint64_t offset, const Entry& entry) { return offset < entry.start; }
+
+    void BuildTree()
+    {
+        leaf_count_ = 1;
+        while (leaf_count_ < entries_.size())
+        {
+            leaf_count_ <<= 1;
+        }
+
+        // Node 1 is the root, the children of node n are 2n and 2n + 1, and the leaves begin at leaf_count_.
+        max_ends_.assign(leaf_count_ * 2, 0);
+
+        for (size_t i = 0; i < entries_.size(); ++i)
+        {
+            max_ends_[leaf_count_ + i] = entries_[i].end;
+        }
+
+        for (size_t i = leaf_count_ - 1; i > 0; --i)
+        {
+            max_ends_[i] = std::max(max_ends_[i * 2], max_ends_[(i * 2) + 1]);
+        }
+
+        tree_valid_ = true;
+    }
+
+    // Visits the entries in the span from first to last that are before limit and end after start.
+    template <typename Function>
+    void VisitNode(size_t node, size_t first, size_t last, size_t limit, uint64_t start, Function& function) const
+    {
+        if ((first >= limit) || (max_ends_[node] <= start))
+        {
+            return;
+        }
+
+        if ((last - first) == 1)
+        {
+            function(entries_[first].value);
+        }
+        else
+        {
+            const size_t middle = first + ((last - first) / 2);
+            VisitNode(node * 2, first, middle, limit, start, function);
+            VisitNode((node * 2) + 1, middle, last, limit, start, function);
+        }
+    }
+
+  private:
+    std::vector<Entry>    entries_;
+    std::vector<uint64_t> max_ends_;
+    size_t                leaf_count_{ 0 };
+    bool                  tree_valid_{ false };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_MEMORY_RANGE_INDEX_H
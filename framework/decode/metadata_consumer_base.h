@@ -38,6 +38,20 @@ class MetadataConsumerBase
     virtual void Process_ExeFileInfo(util::filepath::FileInfo& info_record) {}
     virtual void ProcessDisplayMessageCommand(const std::string& message) {}
     virtual void ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) {}
+    /// @brief Apply the changed spans of a delta fill memory command. The default
+    /// implementation processes each span as a separate fill memory command.
+    virtual void ProcessFillMemoryDeltaCommand(uint64_t                           memory_id,
+                                               uint64_t                           offset,
+                                               uint64_t                           span_count,
+                                               const format::FillMemoryDeltaSpan* spans,
+                                               const uint8_t*                     data)
+    {
+        for (uint64_t i = 0; i < span_count; ++i)
+        {
+            ProcessFillMemoryCommand(memory_id, offset + spans[i].offset, spans[i].size, data);
+            data += spans[i].size;
+        }
+    }
     virtual void
     ProcessFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
                                           const uint8_t*                                      data)
@@ -22,16 +22,37 @@
 
 #include "decode/referenced_resource_table.h"
 
+#include <algorithm>
 #include <cassert>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+template <typename T>
+void ReferencedResourceTable::SlotList<T>::Add(const T& entry)
+{
+    entries.push_back(entry);
+
+    if (entries.size() >= deduplicate_size)
+    {
+        std::sort(entries.begin(), entries.end());
+        entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+        deduplicate_size = (entries.size() * 2 > kMinDeduplicateSize) ? (entries.size() * 2) : kMinDeduplicateSize;
+    }
+}
+
+template <typename T>
+void ReferencedResourceTable::SlotList<T>::Clear()
+{
+    entries.clear();
+    deduplicate_size = kMinDeduplicateSize;
+}
+
 void ReferencedResourceTable::AddResource(format::HandleId resource_id)
 {
-    if (resource_id != format::kNullHandleId)
+    if ((resource_id != format::kNullHandleId) && (GetResourceSlot(resource_id) == kInvalidSlot))
     {
-        resources_.emplace(resource_id, std::make_shared<ResourceInfo>());
+        AddResourceSlot(resource_id, false);
     }
 }
 
@@ -39,37 +60,29 @@ void ReferencedResourceTable::AddResource(format::HandleId parent_id, format::Ha
 {
     if ((parent_id != format::kNullHandleId) && (resource_id != format::kNullHandleId))
     {
-        auto parent_entry = resources_.find(parent_id);
+        const Slot parent = GetResourceSlot(parent_id);
 
-        if (parent_entry != resources_.end())
+        if (parent != kInvalidSlot)
         {
-            auto& parent_info = parent_entry->second;
-            assert(parent_info != nullptr);
-
-            auto resource_entry = resources_.find(resource_id);
-            if (resource_entry == resources_.end())
+            const Slot resource = GetResourceSlot(resource_id);
+            if (resource == kInvalidSlot)
             {
                 // The resource is not in the table, so add it to both the table and to the parent's child list.
-                auto resource_info      = std::make_shared<ResourceInfo>();
-                resource_info->is_child = true;
-
-                parent_info->child_infos.emplace(
-                    std::make_pair(resource_id, std::weak_ptr<ResourceInfo>{ resource_info }));
-                resources_.emplace(resource_id, resource_info);
+                AddChild(parent, AddResourceSlot(resource_id, true));
             }
             else
             {
                 // The resource has already been added to the table, but has multiple parent objects (e.g. a framebuffer
                 // is created from multiple image views), so we add it to the parent's child list.
-                parent_info->child_infos.emplace(
-                    std::make_pair(resource_id, std::weak_ptr<ResourceInfo>{ resource_entry->second }));
+                AddChild(parent, resource);
 
                 if (add_children)
                 {
-                    for (const auto& child : resource_entry->second->child_infos)
+                    // Copy the list, which may be reallocated when the parent is its own child.
+                    const std::vector<Slot> children = resource_children_[resource];
+                    for (const Slot child : children)
                     {
-                        parent_info->child_infos.emplace(
-                            std::make_pair(child.first, std::weak_ptr<ResourceInfo>{ child.second }));
+                        AddChild(parent, child);
                     }
                 }
             }
@@ -97,19 +110,14 @@ void ReferencedResourceTable::AddResourceToContainer(format::HandleId container_
 {
     if ((container_id != format::kNullHandleId) && (resource_id != format::kNullHandleId))
     {
-        auto container_entry = containers_.find(container_id);
-        if (container_entry != containers_.end())
+        ContainerInfo* container_info = GetContainerInfo(container_id);
+        if (container_info != nullptr)
         {
-            auto& container_info = container_entry->second;
-            auto  resource_entry = resources_.find(resource_id);
-
-            if (resource_entry != resources_.end())
+            const Slot resource = GetResourceSlot(resource_id);
+            if (resource != kInvalidSlot)
             {
-                auto& resource_info = resource_entry->second;
-                assert((container_info != nullptr) && (resource_info != nullptr));
-
-                container_info->resource_infos.emplace(resource_id, std::weak_ptr<ResourceInfo>{ resource_info });
-                container_info->resource_bindings[binding].insert(std::make_pair(element, resource_id));
+                container_info->resources.Add(resource);
+                container_info->bindings.emplace((static_cast<uint64_t>(binding) << 32) | element, resource);
             }
         }
     }
@@ -119,18 +127,13 @@ void ReferencedResourceTable::AddResourceToUser(format::HandleId user_id, format
 {
     if ((user_id != format::kNullHandleId) && (resource_id != format::kNullHandleId))
     {
-        auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
+        UserInfo* user_info = GetUserInfo(user_id);
+        if (user_info != nullptr)
         {
-            auto& user_info      = user_entry->second;
-            auto  resource_entry = resources_.find(resource_id);
-
-            if (resource_entry != resources_.end())
+            const Slot resource = GetResourceSlot(resource_id);
+            if (resource != kInvalidSlot)
             {
-                auto& resource_info = resource_entry->second;
-                assert((user_info != nullptr) && (resource_info != nullptr));
-
-                user_info->resource_infos.emplace(resource_id, std::weak_ptr<ResourceInfo>{ resource_info });
+                user_info->resources.Add(resource);
             }
         }
     }
@@ -140,19 +143,14 @@ void ReferencedResourceTable::AddContainerToUser(format::HandleId user_id, forma
 {
     if ((user_id != format::kNullHandleId) && (container_id != format::kNullHandleId))
     {
-        auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
+        UserInfo* user_info = GetUserInfo(user_id);
+        if (user_info != nullptr)
         {
-            auto& user_info       = user_entry->second;
-            auto  container_entry = containers_.find(container_id);
-
-            if (container_entry != containers_.end())
+            const auto container_entry = container_slots_.find(container_id);
+            if (container_entry != container_slots_.end())
             {
-                auto& container_info = container_entry->second;
-                assert((user_info != nullptr) && (container_info != nullptr));
-
-                user_info->container_infos.emplace(container_id,
-                                                   std::weak_ptr<ResourceContainerInfo>{ container_info });
+                const Slot container = container_entry->second;
+                user_info->containers.Add({ container, containers_[container].generation });
             }
         }
     }
@@ -162,37 +160,22 @@ void ReferencedResourceTable::AddUserToUser(format::HandleId user_id, format::Ha
 {
     if ((user_id != format::kNullHandleId) && (source_user_id != format::kNullHandleId))
     {
-        auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
-        {
-            auto& user_info         = user_entry->second;
-            auto  source_user_entry = users_.find(source_user_id);
+        UserInfo*       user_info        = GetUserInfo(user_id);
+        const UserInfo* source_user_info = GetUserInfo(source_user_id);
 
-            if (source_user_entry != users_.end())
+        if ((user_info != nullptr) && (source_user_info != nullptr) && (user_info != source_user_info))
+        {
+            // Copy resource and container info from source user to destination user.
+            for (const Slot resource : source_user_info->resources.entries)
             {
-                auto& source_user_info = source_user_entry->second;
-                assert((user_info != nullptr) && (source_user_info != nullptr));
-
-                // Copy resource and container info from source user to destination user.
-                auto&       resource_infos         = user_info->resource_infos;
-                auto&       container_infos        = user_info->container_infos;
-                const auto& source_resource_infos  = source_user_info->resource_infos;
-                const auto& source_container_infos = source_user_info->container_infos;
-
-                for (auto& source_resource_info : source_resource_infos)
-                {
-                    if (!source_resource_info.second.expired())
-                    {
-                        resource_infos.insert(source_resource_info);
-                    }
-                }
+                user_info->resources.Add(resource);
+            }
 
-                for (auto& source_container_info : source_container_infos)
+            for (const auto& container_ref : source_user_info->containers.entries)
+            {
+                if (IsValid(container_ref))
                 {
-                    if (!source_container_info.second.expired())
-                    {
-                        container_infos.insert(source_container_info);
-                    }
+                    user_info->containers.Add(container_ref);
                 }
             }
         }
@@ -203,9 +186,28 @@ void ReferencedResourceTable::AddContainer(format::HandleId pool_id, format::Han
 {
     if ((pool_id != format::kNullHandleId) && (container_id != format::kNullHandleId))
     {
-        auto container_info     = std::make_shared<ResourceContainerInfo>();
-        container_info->pool_id = pool_id;
-        containers_.emplace(container_id, std::move(container_info));
+        if (container_slots_.find(container_id) == container_slots_.end())
+        {
+            Slot container = kInvalidSlot;
+
+            if (!free_container_slots_.empty())
+            {
+                container = free_container_slots_.back();
+                free_container_slots_.pop_back();
+            }
+            else
+            {
+                container = static_cast<Slot>(containers_.size());
+                containers_.emplace_back();
+            }
+
+            ContainerInfo& container_info = containers_[container];
+            container_info.pool_id        = pool_id;
+            container_info.active         = true;
+
+            container_slots_.emplace(container_id, container);
+        }
+
         container_pool_handles_[pool_id].insert(container_id);
     }
 }
@@ -214,9 +216,26 @@ void ReferencedResourceTable::AddUser(format::HandleId pool_id, format::HandleId
 {
     if ((pool_id != format::kNullHandleId) && (user_id != format::kNullHandleId))
     {
-        auto user_info     = std::make_shared<ResourceUserInfo>();
-        user_info->pool_id = pool_id;
-        users_.emplace(user_id, std::move(user_info));
+        if (user_slots_.find(user_id) == user_slots_.end())
+        {
+            Slot user = kInvalidSlot;
+
+            if (!free_user_slots_.empty())
+            {
+                user = free_user_slots_.back();
+                free_user_slots_.pop_back();
+            }
+            else
+            {
+                user = static_cast<Slot>(users_.size());
+                users_.emplace_back();
+            }
+
+            users_[user].pool_id = pool_id;
+
+            user_slots_.emplace(user_id, user);
+        }
+
         user_pool_handles_[pool_id].insert(user_id);
     }
 }
@@ -225,14 +244,11 @@ void ReferencedResourceTable::RemoveContainer(format::HandleId container_id)
 {
     if (container_id != format::kNullHandleId)
     {
-        auto container_entry = containers_.find(container_id);
-        if (container_entry != containers_.end())
+        const ContainerInfo* container_info = GetContainerInfo(container_id);
+        if (container_info != nullptr)
         {
-            auto& container_info = container_entry->second;
-            assert(container_info != nullptr);
-
             container_pool_handles_[container_info->pool_id].erase(container_id);
-            containers_.erase(container_entry);
+            EraseContainer(container_id);
         }
     }
 }
@@ -241,14 +257,11 @@ void ReferencedResourceTable::RemoveUser(format::HandleId user_id)
 {
     if (user_id != format::kNullHandleId)
     {
-        auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
+        const UserInfo* user_info = GetUserInfo(user_id);
+        if (user_info != nullptr)
         {
-            auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
-
             user_pool_handles_[user_info->pool_id].erase(user_id);
-            users_.erase(user_entry);
+            EraseUser(user_id);
         }
     }
 }
@@ -257,14 +270,11 @@ void ReferencedResourceTable::ResetContainer(format::HandleId container_id)
 {
     if (container_id != format::kNullHandleId)
     {
-        auto container_entry = containers_.find(container_id);
-        if (container_entry != containers_.end())
+        ContainerInfo* container_info = GetContainerInfo(container_id);
+        if (container_info != nullptr)
         {
-            auto& container_info = container_entry->second;
-            assert(container_info != nullptr);
-
-            container_info->resource_infos.clear();
-            container_info->resource_bindings.clear();
+            container_info->resources.Clear();
+            container_info->bindings.clear();
         }
     }
 }
@@ -273,14 +283,11 @@ void ReferencedResourceTable::ResetUser(format::HandleId user_id)
 {
     if (user_id != format::kNullHandleId)
     {
-        auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
+        UserInfo* user_info = GetUserInfo(user_id);
+        if (user_info != nullptr)
         {
-            auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
-
-            user_info->resource_infos.clear();
-            user_info->container_infos.clear();
+            user_info->resources.Clear();
+            user_info->containers.Clear();
         }
     }
 }
@@ -316,7 +323,7 @@ void ReferencedResourceTable::ClearContainers(format::HandleId pool_id)
         auto& container_ids = container_pool_handles_[pool_id];
         for (auto container_id : container_ids)
         {
-            containers_.erase(container_id);
+            EraseContainer(container_id);
         }
 
         container_ids.clear();
@@ -330,7 +337,7 @@ void ReferencedResourceTable::ClearUsers(format::HandleId pool_id)
         auto& user_ids = user_pool_handles_[pool_id];
         for (auto user_id : user_ids)
         {
-            users_.erase(user_id);
+            EraseUser(user_id);
         }
 
         user_ids.clear();
@@ -346,20 +353,17 @@ void ReferencedResourceTable::CopyContainerEntry(format::HandleId source_contain
 {
     if (source_container_id != format::kNullHandleId)
     {
-        const auto container_entry = containers_.find(source_container_id);
-        if (container_entry != containers_.end())
+        const ContainerInfo* container_info = GetContainerInfo(source_container_id);
+        if (container_info != nullptr)
         {
-            const auto& container_info = container_entry->second;
-            const auto  binding_entry  = container_info->resource_bindings.find(source_binding);
-            if (binding_entry != container_info->resource_bindings.end())
+            const auto binding_entry =
+                container_info->bindings.find((static_cast<uint64_t>(source_binding) << 32) | source_element);
+            if (binding_entry != container_info->bindings.end())
             {
-                const auto& binding_elements = binding_entry->second;
-                const auto  element_entry    = binding_elements.find(source_element);
-                if (element_entry != binding_elements.end())
-                {
-                    AddResourceToContainer(
-                        destination_container_id, element_entry->second, destination_binding, destination_element);
-                }
+                AddResourceToContainer(destination_container_id,
+                                       resource_ids_[binding_entry->second],
+                                       destination_binding,
+                                       destination_element);
             }
         }
     }
@@ -369,48 +373,21 @@ void ReferencedResourceTable::ProcessUserSubmission(format::HandleId user_id)
 {
     if (user_id != format::kNullHandleId)
     {
-        auto user_entry = users_.find(user_id);
-        if (user_entry != users_.end())
+        const UserInfo* user_info = GetUserInfo(user_id);
+        if (user_info != nullptr)
         {
-            auto& user_info = user_entry->second;
-            assert(user_info != nullptr);
-
-            auto& resource_infos  = user_info->resource_infos;
-            auto& container_infos = user_info->container_infos;
-
-            for (auto& resource_info : resource_infos)
+            for (const Slot resource : user_info->resources.entries)
             {
-                if (!resource_info.second.expired())
-                {
-                    auto resource_info_ptr  = resource_info.second.lock();
-                    resource_info_ptr->used = true;
-
-                    for (auto& child : resource_info_ptr->child_infos)
-                    {
-                        auto child_info_ptr  = child.second.lock();
-                        child_info_ptr->used = true;
-                    }
-                }
+                MarkUsed(resource);
             }
 
-            for (auto& container_info : container_infos)
+            for (const auto& container_ref : user_info->containers.entries)
             {
-                if (!container_info.second.expired())
+                if (IsValid(container_ref))
                 {
-                    auto container_info_ptr = container_info.second.lock();
-                    for (auto& resource_info : container_info_ptr->resource_infos)
+                    for (const Slot resource : containers_[container_ref.slot].resources.entries)
                     {
-                        if (!resource_info.second.expired())
-                        {
-                            auto resource_info_ptr  = resource_info.second.lock();
-                            resource_info_ptr->used = true;
-
-                            for (auto& child : resource_info_ptr->child_infos)
-                            {
-                                auto child_info_ptr  = child.second.lock();
-                                child_info_ptr->used = true;
-                            }
-                        }
+                        MarkUsed(resource);
                     }
                 }
             }
@@ -421,51 +398,102 @@ void ReferencedResourceTable::ProcessUserSubmission(format::HandleId user_id)
 void ReferencedResourceTable::GetReferencedResourceIds(std::unordered_set<format::HandleId>* referenced_ids,
                                                        std::unordered_set<format::HandleId>* unreferenced_ids) const
 {
-    for (auto resource_entry : resources_)
+    for (Slot resource = 0; resource < resource_ids_.size(); ++resource)
     {
-        auto& resource_info = resource_entry.second;
-
-        if (!resource_info->is_child)
+        if (!resource_is_child_[resource])
         {
-            bool used = IsUsed(resource_info.get());
+            bool used = IsUsed(resource);
 
             if (used && (referenced_ids != nullptr))
             {
-                referenced_ids->insert(resource_entry.first);
+                referenced_ids->insert(resource_ids_[resource]);
 
-                for (const auto& child : resource_entry.second->child_infos)
+                for (const Slot child : resource_children_[resource])
                 {
-                    referenced_ids->insert(child.first);
+                    referenced_ids->insert(resource_ids_[child]);
                 }
             }
             else if (!used && (unreferenced_ids != nullptr))
             {
-                unreferenced_ids->insert(resource_entry.first);
+                unreferenced_ids->insert(resource_ids_[resource]);
             }
         }
     }
 }
 
-bool ReferencedResourceTable::IsUsed(const ResourceInfo* resource_info) const
+ReferencedResourceTable::Slot ReferencedResourceTable::GetResourceSlot(format::HandleId resource_id) const
+{
+    const auto entry = resource_slots_.find(resource_id);
+    return (entry != resource_slots_.end()) ? entry->second : kInvalidSlot;
+}
+
+ReferencedResourceTable::Slot ReferencedResourceTable::AddResourceSlot(format::HandleId resource_id, bool is_child)
 {
-    assert(resource_info != nullptr);
+    const Slot resource = static_cast<Slot>(resource_ids_.size());
 
-    if (resource_info->used)
+    resource_slots_.emplace(resource_id, resource);
+    resource_ids_.push_back(resource_id);
+    resource_used_.push_back(false);
+    resource_is_child_.push_back(is_child);
+    resource_children_.emplace_back();
+
+    return resource;
+}
+
+void ReferencedResourceTable::AddChild(Slot parent, Slot child)
+{
+    // Child lists are small, typically the attachments of a framebuffer or the views of an image.
+    auto& children = resource_children_[parent];
+    if (std::find(children.begin(), children.end(), child) == children.end())
+    {
+        children.push_back(child);
+    }
+}
+
+ReferencedResourceTable::ContainerInfo* ReferencedResourceTable::GetContainerInfo(format::HandleId container_id)
+{
+    const auto entry = container_slots_.find(container_id);
+    return (entry != container_slots_.end()) ? &containers_[entry->second] : nullptr;
+}
+
+ReferencedResourceTable::UserInfo* ReferencedResourceTable::GetUserInfo(format::HandleId user_id)
+{
+    const auto entry = user_slots_.find(user_id);
+    return (entry != user_slots_.end()) ? &users_[entry->second] : nullptr;
+}
+
+bool ReferencedResourceTable::IsValid(const ContainerRef& container_ref) const
+{
+    assert(container_ref.slot < containers_.size());
+
+    const ContainerInfo& container_info = containers_[container_ref.slot];
+    return container_info.active && (container_info.generation == container_ref.generation);
+}
+
+void ReferencedResourceTable::MarkUsed(Slot resource)
+{
+    resource_used_[resource] = true;
+
+    for (const Slot child : resource_children_[resource])
+    {
+        resource_used_[child] = true;
+    }
+}
+
+bool ReferencedResourceTable::IsUsed(Slot resource) const
+{
+    if (resource_used_[resource])
     {
         return true;
     }
     else
     {
         // If the resource was not used directly, check to see if it was used indirectly through a child.
-        for (const auto& child_info : resource_info->child_infos)
+        for (const Slot child : resource_children_[resource])
         {
-            if (!child_info.second.expired())
+            if (IsUsed(child))
             {
-                const auto child_info_ptr = child_info.second.lock();
-                if (IsUsed(child_info_ptr.get()))
-                {
-                    return true;
-                }
+                return true;
             }
         }
     }
@@ -473,5 +501,42 @@ bool ReferencedResourceTable::IsUsed(const ResourceInfo* resource_info) const
     return false;
 }
 
+void ReferencedResourceTable::EraseContainer(format::HandleId container_id)
+{
+    const auto entry = container_slots_.find(container_id);
+    if (entry != container_slots_.end())
+    {
+        const Slot     container      = entry->second;
+        ContainerInfo& container_info = containers_[container];
+
+        // Advancing the generation invalidates the references that users hold to the removed container.
+        container_info.pool_id = format::kNullHandleId;
+        container_info.active  = false;
+        container_info.resources.Clear();
+        container_info.bindings.clear();
+        ++container_info.generation;
+
+        free_container_slots_.push_back(container);
+        container_slots_.erase(entry);
+    }
+}
+
+void ReferencedResourceTable::EraseUser(format::HandleId user_id)
+{
+    const auto entry = user_slots_.find(user_id);
+    if (entry != user_slots_.end())
+    {
+        const Slot user      = entry->second;
+        UserInfo&  user_info = users_[user];
+
+        user_info.pool_id = format::kNullHandleId;
+        user_info.resources.Clear();
+        user_info.containers.Clear();
+
+        free_user_slots_.push_back(user);
+        user_slots_.erase(entry);
+    }
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -29,7 +29,7 @@
 
 #include "vulkan/vulkan.h"
 
-#include <memory>
+#include <cstdint>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -90,44 +90,107 @@ class ReferencedResourceTable
                                   std::unordered_set<format::HandleId>* unreferenced_ids) const;
 
   private:
-    // Track the referenced/used state of a resource (buffer, image, view, framebuffer).
-    struct ResourceInfo
+    // Resources, containers, and users are stored in dense arrays indexed by slot, with tables mapping handle IDs to
+    // slots.  Resources are never removed, so resource slots are permanent.  Container slots are reused after a
+    // container is removed, so references to containers include a generation count that identifies the container that
+    // was referenced.
+    typedef uint32_t Slot;
+
+    static const Slot kInvalidSlot = 0xffffffff;
+
+    // Lists are not deduplicated for every insertion.  Instead, duplicates are removed when a list has doubled in size
+    // since it was last deduplicated, which keeps insertion cheap for the descriptor sets and command buffers that
+    // repeatedly reference the same objects.
+    static const size_t kMinDeduplicateSize = 16;
+
+    struct ContainerRef
     {
-        bool                                                              used{ false };
-        bool                                                              is_child{ false };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>> child_infos;
+        Slot     slot;
+        uint32_t generation;
+
+        bool operator<(const ContainerRef& other) const
+        {
+            return (slot < other.slot) || ((slot == other.slot) && (generation < other.generation));
+        }
+
+        bool operator==(const ContainerRef& other) const
+        {
+            return (slot == other.slot) && (generation == other.generation);
+        }
     };
 
-    // Track the referenced/used state of a resource container (descriptor set).
-    struct ResourceContainerInfo
+    template <typename T>
+    struct SlotList
     {
-        format::HandleId                                                  pool_id{ format::kNullHandleId };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>> resource_infos;
+        std::vector<T> entries;
+        size_t         deduplicate_size{ kMinDeduplicateSize };
 
-        // Table mapping a container binding to a handle.  Each binding contains a table of handles keyed by array
-        // element index.
-        std::unordered_map<uint32_t, std::unordered_map<uint32_t, format::HandleId>> resource_bindings;
+        void Add(const T& entry);
+
+        void Clear();
     };
 
-    // Track the state of a resource user (command buffer).
-    struct ResourceUserInfo
+    // Track the resources referenced by a resource container (descriptor set).
+    struct ContainerInfo
     {
-        format::HandleId                                                           pool_id{ format::kNullHandleId };
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceInfo>>          resource_infos;
-        std::unordered_map<format::HandleId, std::weak_ptr<ResourceContainerInfo>> container_infos;
+        format::HandleId pool_id{ format::kNullHandleId };
+        uint32_t         generation{ 0 };
+        bool             active{ false };
+        SlotList<Slot>   resources;
+
+        // Table mapping a container binding and array element, packed as (binding << 32) | element, to a resource.
+        std::unordered_map<uint64_t, Slot> bindings;
+    };
+
+    // Track the resources and containers referenced by a resource user (command buffer).
+    struct UserInfo
+    {
+        format::HandleId       pool_id{ format::kNullHandleId };
+        SlotList<Slot>         resources;
+        SlotList<ContainerRef> containers;
     };
 
     typedef std::unordered_set<format::HandleId> PoolHandles;
 
   private:
-    bool IsUsed(const ResourceInfo* resource_info) const;
+    Slot GetResourceSlot(format::HandleId resource_id) const;
+
+    Slot AddResourceSlot(format::HandleId resource_id, bool is_child);
+
+    void AddChild(Slot parent, Slot child);
+
+    ContainerInfo* GetContainerInfo(format::HandleId container_id);
+
+    UserInfo* GetUserInfo(format::HandleId user_id);
+
+    bool IsValid(const ContainerRef& container_ref) const;
+
+    void MarkUsed(Slot resource);
+
+    bool IsUsed(Slot resource) const;
+
+    void EraseContainer(format::HandleId container_id);
+
+    void EraseUser(format::HandleId user_id);
 
   private:
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceInfo>>          resources_;
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceContainerInfo>> containers_;
-    std::unordered_map<format::HandleId, std::shared_ptr<ResourceUserInfo>>      users_;
-    std::unordered_map<format::HandleId, PoolHandles>                            container_pool_handles_;
-    std::unordered_map<format::HandleId, PoolHandles>                            user_pool_handles_;
+    // Resource state, indexed by resource slot.
+    std::unordered_map<format::HandleId, Slot> resource_slots_;
+    std::vector<format::HandleId>              resource_ids_;
+    std::vector<bool>                          resource_used_;
+    std::vector<bool>                          resource_is_child_;
+    std::vector<std::vector<Slot>>             resource_children_;
+
+    std::unordered_map<format::HandleId, Slot> container_slots_;
+    std::vector<ContainerInfo>                 containers_;
+    std::vector<Slot>                          free_container_slots_;
+
+    std::unordered_map<format::HandleId, Slot> user_slots_;
+    std::vector<UserInfo>                      users_;
+    std::vector<Slot>                          free_user_slots_;
+
+    std::unordered_map<format::HandleId, PoolHandles> container_pool_handles_;
+    std::unordered_map<format::HandleId, PoolHandles> user_pool_handles_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -49,6 +49,7 @@ struct ReplayOptions
     bool        quit_after_measurement_frame_range{ false };
     bool        flush_measurement_frame_range{ false };
     bool        flush_inside_measurement_range{ false };
+    bool        measurement_cost_breakdown{ false };
     bool        force_windowed{ false };
     uint32_t    windowed_width{ 0 };
     uint32_t    windowed_height{ 0 };
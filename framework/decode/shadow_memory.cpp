@@ -0,0 +1,139 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/shadow_memory.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+std::atomic<uint64_t> ShadowMemory::total_committed_size_{ 0 };
+std::atomic<uint64_t> ShadowMemory::peak_committed_size_{ 0 };
+
+ShadowMemory::ShadowMemory(uint64_t size) : size_(size), committed_page_count_(0)
+{
+    const uint64_t page_count = (size + kPageSize - 1) / kPageSize;
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, page_count);
+    pages_.resize(static_cast<size_t>(page_count));
+}
+
+ShadowMemory::~ShadowMemory()
+{
+    total_committed_size_ -= GetCommittedSize();
+}
+
+void ShadowMemory::Write(uint64_t offset, const uint8_t* data, size_t size)
+{
+    assert((data != nullptr) && (offset <= size_) && (size <= (size_ - offset)));
+
+    while (size > 0)
+    {
+        const size_t page        = static_cast<size_t>(offset / kPageSize);
+        const size_t page_offset = static_cast<size_t>(offset % kPageSize);
+        const size_t copy_size   = ((kPageSize - page_offset) < size) ? (kPageSize - page_offset) : size;
+
+        uint8_t* page_data = pages_[page].get();
+        if (page_data == nullptr)
+        {
+            page_data = CommitPage(page);
+        }
+
+        util::platform::MemoryCopy(page_data + page_offset, copy_size, data, copy_size);
+
+        offset += copy_size;
+        data += copy_size;
+        size -= copy_size;
+    }
+}
+
+void ShadowMemory::Read(uint64_t offset, size_t size, uint8_t* data) const
+{
+    assert((data != nullptr) && (offset <= size_) && (size <= (size_ - offset)));
+
+    while (size > 0)
+    {
+        const size_t page        = static_cast<size_t>(offset / kPageSize);
+        const size_t page_offset = static_cast<size_t>(offset % kPageSize);
+        const size_t copy_size   = ((kPageSize - page_offset) < size) ? (kPageSize - page_offset) : size;
+
+        const uint8_t* page_data = pages_[page].get();
+        if (page_data != nullptr)
+        {
+            util::platform::MemoryCopy(data, copy_size, page_data + page_offset, copy_size);
+        }
+        else
+        {
+            memset(data, 0, copy_size);
+        }
+
+        offset += copy_size;
+        data += copy_size;
+        size -= copy_size;
+    }
+}
+
+bool ShadowMemory::IsWritten(uint64_t offset, uint64_t size) const
+{
+    if ((offset >= size_) || (size == 0))
+    {
+        return false;
+    }
+
+    const uint64_t end        = ((size_ - offset) < size) ? size_ : (offset + size);
+    const size_t   first_page = static_cast<size_t>(offset / kPageSize);
+    const size_t   last_page  = static_cast<size_t>((end - 1) / kPageSize);
+
+    for (size_t page = first_page; page <= last_page; ++page)
+    {
+        if (pages_[page] != nullptr)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint8_t* ShadowMemory::CommitPage(size_t page)
+{
+    // Pages are zero initialized, to match the content of the unwritten pages.
+    pages_[page] = std::make_unique<uint8_t[]>(kPageSize);
+    ++committed_page_count_;
+
+    const uint64_t total = (total_committed_size_ += kPageSize);
+
+    uint64_t peak = peak_committed_size_.load();
+    while ((total > peak) && !peak_committed_size_.compare_exchange_weak(peak, total))
+    {
+    }
+
+    return pages_[page].get();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
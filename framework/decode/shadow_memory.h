@@ -0,0 +1,136 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_SHADOW_MEMORY_H
+#define GFXRECON_DECODE_SHADOW_MEMORY_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Host copy of the content of a device memory object, divided into pages that are only allocated when they are first
+// written.  Pages that have not been written read as zero.  The memory allocated for pages by all ShadowMemory objects
+// is tracked, and its peak value is reported with the replay statistics.
+class ShadowMemory
+{
+  public:
+    static const size_t kPageSize = 64 * 1024;
+
+  public:
+    explicit ShadowMemory(uint64_t size);
+
+    ~ShadowMemory();
+
+    ShadowMemory(const ShadowMemory&) = delete;
+
+    ShadowMemory& operator=(const ShadowMemory&) = delete;
+
+    uint64_t GetSize() const { return size_; }
+
+    uint64_t GetCommittedSize() const { return static_cast<uint64_t>(committed_page_count_) * kPageSize; }
+
+    void Write(uint64_t offset, const uint8_t* data, size_t size);
+
+    // Copies the content of a range, with zeros for the pages that have not been written.
+    void Read(uint64_t offset, size_t size, uint8_t* data) const;
+
+    // Returns true if any page of the range has been written.
+    bool IsWritten(uint64_t offset, uint64_t size) const;
+
+    // Calls function(offset, data, size) for each run of consecutive written pages in a range, clipped to the range.
+    // Runs that span more than one page are copied to a temporary buffer, so that the data is contiguous.
+    template <typename Function>
+    void ForEachWrittenRange(uint64_t offset, uint64_t size, Function function) const
+    {
+        if (offset >= size_)
+        {
+            return;
+        }
+
+        const uint64_t end = ((size_ - offset) < size) ? size_ : (offset + size);
+
+        std::vector<uint8_t> run_data;
+        uint64_t             position = offset;
+
+        while (position < end)
+        {
+            const size_t first_page = static_cast<size_t>(position / kPageSize);
+
+            if (pages_[first_page] == nullptr)
+            {
+                position = static_cast<uint64_t>(first_page + 1) * kPageSize;
+                continue;
+            }
+
+            size_t last_page = first_page;
+            while (((static_cast<uint64_t>(last_page + 1) * kPageSize) < end) && (pages_[last_page + 1] != nullptr))
+            {
+                ++last_page;
+            }
+
+            const uint64_t run_limit = static_cast<uint64_t>(last_page + 1) * kPageSize;
+            const uint64_t run_end   = (run_limit < end) ? run_limit : end;
+            const size_t   run_size  = static_cast<size_t>(run_end - position);
+
+            if (first_page == last_page)
+            {
+                function(position, pages_[first_page].get() + (position % kPageSize), run_size);
+            }
+            else
+            {
+                run_data.resize(run_size);
+                Read(position, run_size, run_data.data());
+                function(position, run_data.data(), run_size);
+            }
+
+            position = run_end;
+        }
+    }
+
+    // Memory allocated for the pages of all ShadowMemory objects.
+    static uint64_t GetTotalCommittedSize() { return total_committed_size_.load(); }
+
+    static uint64_t GetPeakCommittedSize() { return peak_committed_size_.load(); }
+
+  private:
+    uint8_t* CommitPage(size_t page);
+
+  private:
+    static std::atomic<uint64_t> total_committed_size_;
+    static std::atomic<uint64_t> peak_committed_size_;
+
+    uint64_t                                size_;
+    std::vector<std::unique_ptr<uint8_t[]>> pages_;
+    size_t                                  committed_page_count_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_SHADOW_MEMORY_H
@@ -39,10 +39,75 @@
 
 #include <cassert>
 #include <memory>
+#include <type_traits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Identifies the struct types that are encoded with the same number of bytes for every array element, because they
+// contain no pointers or pNext chains.  The size of an encoded array of these structs can be determined without
+// decoding each element, so StructPointerDecoder defers element decoding until the structs are first accessed.
+template <typename T>
+struct StructHasFixedEncodedSize : std::false_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkBufferCopy> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkBufferImageCopy> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkImageCopy> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkImageResolve> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkViewport> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkRect2D> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkClearRect> : std::true_type
+{};
+
+template <>
+struct StructHasFixedEncodedSize<Decoded_VkAccelerationStructureBuildRangeInfoKHR> : std::true_type
+{};
+
+// Returns the encoded size of a single struct, which is measured by decoding the first struct of the buffer, or 0 for
+// struct types without a fixed encoded size.
+template <typename T>
+size_t GetFixedEncodedStructSize(const uint8_t*, size_t, std::false_type)
+{
+    return 0;
+}
+
+template <typename T>
+size_t GetFixedEncodedStructSize(const uint8_t* buffer, size_t buffer_size, std::true_type)
+{
+    typename T::struct_type value{};
+    T                       wrapper{};
+
+    wrapper.decoded_value = &value;
+
+    return DecodeStruct(buffer, buffer_size, &wrapper);
+}
+
+template <typename T>
+size_t GetFixedEncodedStructSize(const uint8_t* buffer, size_t buffer_size)
+{
+    return GetFixedEncodedStructSize<T>(buffer, buffer_size, StructHasFixedEncodedSize<T>{});
+}
+
 template <typename T>
 class StructPointerDecoder : public PointerDecoderBase
 {
@@ -51,13 +116,29 @@ class StructPointerDecoder : public PointerDecoderBase
         decoded_structs_(nullptr), struct_memory_(nullptr), capacity_(0), is_memory_external_(false)
     {}
 
-    T* GetMetaStructPointer() { return decoded_structs_; }
+    T* GetMetaStructPointer()
+    {
+        DecodeDeferredStructs();
+        return decoded_structs_;
+    }
 
-    const T* GetMetaStructPointer() const { return decoded_structs_; }
+    const T* GetMetaStructPointer() const
+    {
+        const_cast<StructPointerDecoder*>(this)->DecodeDeferredStructs();
+        return decoded_structs_;
+    }
 
-    typename T::struct_type* GetPointer() { return struct_memory_; }
+    typename T::struct_type* GetPointer()
+    {
+        DecodeDeferredStructs();
+        return struct_memory_;
+    }
 
-    const typename T::struct_type* GetPointer() const { return struct_memory_; }
+    const typename T::struct_type* GetPointer() const
+    {
+        const_cast<StructPointerDecoder*>(this)->DecodeDeferredStructs();
+        return struct_memory_;
+    }
 
     size_t GetOutputLength() const { return output_len_; }
 
@@ -110,51 +191,94 @@ class StructPointerDecoder : public PointerDecoderBase
         {
             size_t len = GetLength();
 
-            if (!is_memory_external_)
+            // Decoding is deferred for arrays with a fixed encoded size, unless the decoded structs are written to
+            // external memory that belongs to a parent struct, which expects the array to be decoded with it.
+            if (HasData() && (len > 0) && !is_memory_external_)
             {
-                assert(struct_memory_ == nullptr);
+                size_t encoded_size = GetFixedEncodedStructSize<T>((buffer + bytes_read), (buffer_size - bytes_read));
 
-                struct_memory_ = DecodeAllocator::Allocate<typename T::struct_type>(len);
-                capacity_      = len;
-            }
-            else
-            {
-                assert(struct_memory_ != nullptr);
-                assert(len <= capacity_);
-
-                if ((struct_memory_ == nullptr) || (len > capacity_))
+                if ((encoded_size > 0) && (len <= ((buffer_size - bytes_read) / encoded_size)))
                 {
-                    GFXRECON_LOG_WARNING("Struct pointer decoder's external memory capacity (%" PRIuPTR
-                                         ") is smaller than the decoded array size (%" PRIuPTR
-                                         "); an internal memory allocation will be used instead",
-                                         capacity_,
-                                         len);
-
-                    is_memory_external_ = false;
-                    struct_memory_      = DecodeAllocator::Allocate<typename T::struct_type>(len);
-                    capacity_           = len;
+                    deferred_data_      = buffer + bytes_read;
+                    deferred_data_size_ = len * encoded_size;
+                    return bytes_read + deferred_data_size_;
                 }
             }
 
-            decoded_structs_ = DecodeAllocator::Allocate<T>(len);
+            AllocateStructs(len);
 
             if (HasData())
             {
-                for (size_t i = 0; i < len; ++i)
-                {
-                    decoded_structs_[i].decoded_value = &struct_memory_[i];
+                bytes_read += DecodeStructs((buffer + bytes_read), (buffer_size - bytes_read));
+            }
+        }
 
-                    // Note: We only expect this class to be used with structs that have a decode_struct function.
-                    //       If an error is encoutered here due to a new struct type, the struct decoders need to be
-                    //       updated to support the new type.
-                    bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_structs_[i]);
-                }
+        return bytes_read;
+    }
+
+  private:
+    void AllocateStructs(size_t len)
+    {
+        if (!is_memory_external_)
+        {
+            assert(struct_memory_ == nullptr);
+
+            struct_memory_ = DecodeAllocator::Allocate<typename T::struct_type>(len);
+            capacity_      = len;
+        }
+        else
+        {
+            assert(struct_memory_ != nullptr);
+            assert(len <= capacity_);
+
+            if ((struct_memory_ == nullptr) || (len > capacity_))
+            {
+                GFXRECON_LOG_WARNING("Struct pointer decoder's external memory capacity (%" PRIuPTR
+                                     ") is smaller than the decoded array size (%" PRIuPTR
+                                     "); an internal memory allocation will be used instead",
+                                     capacity_,
+                                     len);
+
+                is_memory_external_ = false;
+                struct_memory_      = DecodeAllocator::Allocate<typename T::struct_type>(len);
+                capacity_           = len;
             }
         }
 
+        decoded_structs_ = DecodeAllocator::Allocate<T>(len);
+    }
+
+    size_t DecodeStructs(const uint8_t* buffer, size_t buffer_size)
+    {
+        size_t bytes_read = 0;
+        size_t len        = GetLength();
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            decoded_structs_[i].decoded_value = &struct_memory_[i];
+
+            // Note: We only expect this class to be used with structs that have a decode_struct function.
+            //       If an error is encoutered here due to a new struct type, the struct decoders need to be
+            //       updated to support the new type.
+            bytes_read += DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &decoded_structs_[i]);
+        }
+
         return bytes_read;
     }
 
+    // Decodes the structs from the encoded data that was retained by Decode.  The decoder must be accessed while the
+    // parameter buffer that was passed to Decode is valid, which is the case for the consumer calls that receive it.
+    void DecodeDeferredStructs()
+    {
+        if (deferred_data_ != nullptr)
+        {
+            AllocateStructs(GetLength());
+            DecodeStructs(deferred_data_, deferred_data_size_);
+
+            deferred_data_ = nullptr;
+        }
+    }
+
   private:
     /// Memory to hold decoded data. Points to an internal allocation when #is_memory_external_ is false and
     /// to an externally provided allocation when #is_memory_external_ is true.
@@ -168,6 +292,10 @@ class StructPointerDecoder : public PointerDecoderBase
     /// compared.
     typename T::struct_type* output_data_{ nullptr };
     size_t                   output_len_; ///< Size of #output_data_.
+
+    /// Encoded structs that have not been decoded yet, when decoding was deferred until the structs are accessed.
+    const uint8_t* deferred_data_{ nullptr };
+    size_t         deferred_data_size_{ 0 }; ///< Size of #deferred_data_.
 };
 
 template <typename T>
@@ -176,13 +304,29 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
   public:
     StructPointerDecoder() : decoded_structs_(nullptr), struct_memory_(nullptr) {}
 
-    T** GetMetaStructPointer() { return decoded_structs_; }
+    T** GetMetaStructPointer()
+    {
+        DecodeDeferredRows();
+        return decoded_structs_;
+    }
 
-    const T* const* GetMetaStructPointer() const { return decoded_structs_; }
+    const T* const* GetMetaStructPointer() const
+    {
+        const_cast<StructPointerDecoder*>(this)->DecodeDeferredRows();
+        return decoded_structs_;
+    }
 
-    typename T::struct_type** GetPointer() { return struct_memory_; }
+    typename T::struct_type** GetPointer()
+    {
+        DecodeDeferredRows();
+        return struct_memory_;
+    }
 
-    const typename T::struct_type** GetPointer() const { return struct_memory_; }
+    const typename T::struct_type** GetPointer() const
+    {
+        const_cast<StructPointerDecoder*>(this)->DecodeDeferredRows();
+        return struct_memory_;
+    }
 
     size_t Decode(const uint8_t* buffer, size_t buffer_size)
     {
@@ -196,62 +340,152 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
         {
             assert(struct_memory_ == nullptr);
 
-            size_t len       = GetLength();
-            struct_memory_   = DecodeAllocator::Allocate<typename T::struct_type*>(len, false);
-            decoded_structs_ = DecodeAllocator::Allocate<T*>(len, false);
+            // Decoding is deferred for arrays with a fixed encoded size, as for the 1D struct array decoder.
+            size_t deferred_size = GetDeferredRowsSize((buffer + bytes_read), (buffer_size - bytes_read));
 
-            for (size_t i = 0; i < len; ++i)
+            if (deferred_size > 0)
             {
-                uint32_t attrib = 0;
-                bytes_read +=
-                    ValueDecoder::DecodeUInt32Value((buffer + bytes_read), (buffer_size - bytes_read), &attrib);
+                deferred_data_      = buffer + bytes_read;
+                deferred_data_size_ = deferred_size;
+                bytes_read += deferred_size;
+            }
+            else
+            {
+                bytes_read += DecodeRows((buffer + bytes_read), (buffer_size - bytes_read));
+            }
+        }
 
-                if ((attrib & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
-                {
-                    if ((attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-                    {
-                        uint64_t address;
-                        bytes_read +=
-                            ValueDecoder::DecodeAddress((buffer + bytes_read), (buffer_size - bytes_read), &address);
-                    }
+        return bytes_read;
+    }
 
-                    assert((attrib & format::PointerAttributes::kIsStruct) == format::PointerAttributes::kIsStruct);
+  private:
+    // Decodes the attributes that precede the structs of a row, returning the number of bytes read.  The row length is
+    // only decoded for rows that are not null.
+    static size_t DecodeRowAttributes(const uint8_t* buffer, size_t buffer_size, uint32_t* attrib, size_t* inner_len)
+    {
+        size_t bytes_read = ValueDecoder::DecodeUInt32Value(buffer, buffer_size, attrib);
 
-                    size_t inner_len = 0;
-                    bytes_read +=
-                        ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), &inner_len);
-
-                    typename T::struct_type* inner_struct_memory =
-                        DecodeAllocator::Allocate<typename T::struct_type>(inner_len);
-                    T* inner_decoded_structs = DecodeAllocator::Allocate<T>(inner_len);
-
-                    for (size_t j = 0; j < inner_len; ++j)
-                    {
-                        inner_decoded_structs[j].decoded_value = &inner_struct_memory[j];
-                        // Note: We only expect this class to be used with structs that have a decode_struct function.
-                        //       If an error is encoutered here due to a new struct type, the struct decoders need to be
-                        //       updated to support the new type.
-                        bytes_read +=
-                            DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &inner_decoded_structs[j]);
-                    }
-
-                    struct_memory_[i]   = inner_struct_memory;
-                    decoded_structs_[i] = inner_decoded_structs;
+        if ((*attrib & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
+        {
+            if ((*attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
+            {
+                uint64_t address;
+                bytes_read += ValueDecoder::DecodeAddress((buffer + bytes_read), (buffer_size - bytes_read), &address);
+            }
+
+            assert((*attrib & format::PointerAttributes::kIsStruct) == format::PointerAttributes::kIsStruct);
+
+            bytes_read += ValueDecoder::DecodeSizeTValue((buffer + bytes_read), (buffer_size - bytes_read), inner_len);
+        }
+
+        return bytes_read;
+    }
+
+    // Returns the encoded size of the rows when their decoding can be deferred, or 0 when the rows must be decoded
+    // immediately because the struct type does not have a fixed encoded size or the data is incomplete.
+    size_t GetDeferredRowsSize(const uint8_t* buffer, size_t buffer_size) const
+    {
+        if (!StructHasFixedEncodedSize<T>::value)
+        {
+            return 0;
+        }
+
+        size_t len          = GetLength();
+        size_t bytes_read   = 0;
+        size_t encoded_size = 0;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            // Each row is preceded by at least a 32-bit attribute mask, and a 64-bit address and length when it is
+            // not null.
+            if ((buffer_size - bytes_read) < (sizeof(uint32_t) + (2 * sizeof(uint64_t))))
+            {
+                return 0;
+            }
+
+            uint32_t attrib    = 0;
+            size_t   inner_len = 0;
+            bytes_read += DecodeRowAttributes((buffer + bytes_read), (buffer_size - bytes_read), &attrib, &inner_len);
+
+            if (inner_len > 0)
+            {
+                if (encoded_size == 0)
+                {
+                    encoded_size = GetFixedEncodedStructSize<T>((buffer + bytes_read), (buffer_size - bytes_read));
                 }
-                else
+
+                if ((encoded_size == 0) || (inner_len > ((buffer_size - bytes_read) / encoded_size)))
+                {
+                    return 0;
+                }
+
+                bytes_read += inner_len * encoded_size;
+            }
+        }
+
+        return bytes_read;
+    }
+
+    size_t DecodeRows(const uint8_t* buffer, size_t buffer_size)
+    {
+        size_t bytes_read = 0;
+        size_t len        = GetLength();
+
+        struct_memory_   = DecodeAllocator::Allocate<typename T::struct_type*>(len, false);
+        decoded_structs_ = DecodeAllocator::Allocate<T*>(len, false);
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            uint32_t attrib    = 0;
+            size_t   inner_len = 0;
+            bytes_read += DecodeRowAttributes((buffer + bytes_read), (buffer_size - bytes_read), &attrib, &inner_len);
+
+            if ((attrib & format::PointerAttributes::kIsNull) != format::PointerAttributes::kIsNull)
+            {
+                typename T::struct_type* inner_struct_memory =
+                    DecodeAllocator::Allocate<typename T::struct_type>(inner_len);
+                T* inner_decoded_structs = DecodeAllocator::Allocate<T>(inner_len);
+
+                for (size_t j = 0; j < inner_len; ++j)
                 {
-                    struct_memory_[i]   = nullptr;
-                    decoded_structs_[i] = nullptr;
+                    inner_decoded_structs[j].decoded_value = &inner_struct_memory[j];
+                    // Note: We only expect this class to be used with structs that have a decode_struct function.
+                    //       If an error is encoutered here due to a new struct type, the struct decoders need to be
+                    //       updated to support the new type.
+                    bytes_read +=
+                        DecodeStruct((buffer + bytes_read), (buffer_size - bytes_read), &inner_decoded_structs[j]);
                 }
+
+                struct_memory_[i]   = inner_struct_memory;
+                decoded_structs_[i] = inner_decoded_structs;
+            }
+            else
+            {
+                struct_memory_[i]   = nullptr;
+                decoded_structs_[i] = nullptr;
             }
         }
 
         return bytes_read;
     }
 
+    void DecodeDeferredRows()
+    {
+        if (deferred_data_ != nullptr)
+        {
+            DecodeRows(deferred_data_, deferred_data_size_);
+
+            deferred_data_ = nullptr;
+        }
+    }
+
   private:
     T**                       decoded_structs_; ///< Memory to hold decoded data.
     typename T::struct_type** struct_memory_;   ///< Decoded Vulkan structures.
+
+    /// Encoded rows that have not been decoded yet, when decoding was deferred until the structs are accessed.
+    const uint8_t* deferred_data_{ nullptr };
+    size_t         deferred_data_size_{ 0 }; ///< Size of #deferred_data_.
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -24,16 +24,29 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
+#include "decode/memory_range_index.h"
+#include "decode/referenced_resource_table.h"
+#include "decode/shadow_memory.h"
+#include "decode/struct_pointer_decoder.h"
+#include "decode/vulkan_command_buffer_reuse_tracker.h"
+#include "decode/vulkan_replay_dump_resources_common.h"
 #include "decode/vulkan_handle_mapping_util.h"
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_object_info_table.h"
 #include "format/format.h"
 #include "format/format_util.h"
+#include "generated/generated_vulkan_struct_decoders.h"
 
 #include "vulkan/vulkan.h"
 
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 const VkBuffer                   kBufferHandles[] = { gfxrecon::format::FromHandleId<VkBuffer>(0xabcd),
@@ -147,3 +160,518 @@ TEST_CASE("handle IDs need to be mapped to valid handles", "[wrapper]")
 
     gfxrecon::util::Log::Release();
 }
+
+TEST_CASE("ReferencedResourceTable reports the resources referenced by submitted users", "[referenced_resource_table]")
+{
+    const gfxrecon::format::HandleId kPoolId           = 1;
+    const gfxrecon::format::HandleId kCommandPoolId    = 2;
+    const gfxrecon::format::HandleId kBufferId         = 10;
+    const gfxrecon::format::HandleId kImageId          = 11;
+    const gfxrecon::format::HandleId kImageViewId      = 12;
+    const gfxrecon::format::HandleId kUnusedBufferId   = 13;
+    const gfxrecon::format::HandleId kRemovedBufferId  = 14;
+    const gfxrecon::format::HandleId kCopiedBufferId   = 15;
+    const gfxrecon::format::HandleId kSetId            = 20;
+    const gfxrecon::format::HandleId kRemovedSetId     = 21;
+    const gfxrecon::format::HandleId kSourceSetId      = 22;
+    const gfxrecon::format::HandleId kDestinationSetId = 23;
+    const gfxrecon::format::HandleId kCommandBufferId  = 30;
+
+    gfxrecon::decode::ReferencedResourceTable table;
+
+    table.AddResource(kBufferId);
+    table.AddResource(kImageId);
+    table.AddResource(kImageId, kImageViewId);
+    table.AddResource(kUnusedBufferId);
+    table.AddResource(kRemovedBufferId);
+    table.AddResource(kCopiedBufferId);
+
+    table.AddContainer(kPoolId, kSetId);
+    table.AddContainer(kPoolId, kRemovedSetId);
+    table.AddContainer(kPoolId, kSourceSetId);
+    table.AddContainer(kPoolId, kDestinationSetId);
+    table.AddResourceToContainer(kSetId, kBufferId, 0, 0);
+    table.AddResourceToContainer(kRemovedSetId, kRemovedBufferId, 0, 0);
+    table.AddResourceToContainer(kSourceSetId, kCopiedBufferId, 1, 2);
+    table.CopyContainerEntry(kSourceSetId, 1, 2, kDestinationSetId, 0, 0);
+
+    // The image is referenced through its view, and the removed set no longer contributes its resources.
+    table.AddUser(kCommandPoolId, kCommandBufferId);
+    table.AddResourceToUser(kCommandBufferId, kImageViewId);
+    table.AddContainerToUser(kCommandBufferId, kSetId);
+    table.AddContainerToUser(kCommandBufferId, kRemovedSetId);
+    table.AddContainerToUser(kCommandBufferId, kDestinationSetId);
+    table.RemoveContainer(kRemovedSetId);
+    table.ProcessUserSubmission(kCommandBufferId);
+
+    std::unordered_set<gfxrecon::format::HandleId> referenced_ids;
+    std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
+    table.GetReferencedResourceIds(&referenced_ids, &unreferenced_ids);
+
+    REQUIRE(referenced_ids == std::unordered_set<gfxrecon::format::HandleId>{
+                                  kBufferId, kImageId, kImageViewId, kCopiedBufferId });
+    REQUIRE(unreferenced_ids == std::unordered_set<gfxrecon::format::HandleId>{ kUnusedBufferId, kRemovedBufferId });
+}
+
+TEST_CASE("ReferencedResourceTable descriptor workload", "[referenced_resource_table][!benchmark]")
+{
+    const uint32_t kResourceCount      = 100000;
+    const uint32_t kSetCount           = 200000;
+    const uint32_t kBindingsPerSet     = 8;
+    const uint32_t kCommandBufferCount = 1000;
+    const uint32_t kSetsPerSubmission  = 400;
+
+    BENCHMARK("Update and submit 200000 descriptor sets")
+    {
+        gfxrecon::decode::ReferencedResourceTable table;
+
+        for (uint32_t i = 1; i <= kResourceCount; ++i)
+        {
+            table.AddResource(i);
+        }
+
+        for (uint32_t set = 0; set < kSetCount; ++set)
+        {
+            const gfxrecon::format::HandleId set_id = kResourceCount + 1 + set;
+            table.AddContainer(1, set_id);
+
+            for (uint32_t binding = 0; binding < kBindingsPerSet; ++binding)
+            {
+                table.AddResourceToContainer(set_id, 1 + ((set * 7 + binding * 13) % kResourceCount), binding, 0);
+            }
+        }
+
+        for (uint32_t command_buffer = 0; command_buffer < kCommandBufferCount; ++command_buffer)
+        {
+            const gfxrecon::format::HandleId command_buffer_id = kResourceCount + kSetCount + 1 + command_buffer;
+            table.AddUser(2, command_buffer_id);
+
+            for (uint32_t i = 0; i < kSetsPerSubmission; ++i)
+            {
+                table.AddContainerToUser(command_buffer_id,
+                                         kResourceCount + 1 + ((command_buffer * 31 + i * 17) % kSetCount));
+            }
+
+            table.ProcessUserSubmission(command_buffer_id);
+        }
+
+        std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
+        table.GetReferencedResourceIds(nullptr, &unreferenced_ids);
+
+        return unreferenced_ids.size();
+    };
+}
+
+TEST_CASE("VulkanCommandBufferReuseTracker skips identical recordings", "[command_buffer_reuse]")
+{
+    using gfxrecon::format::ApiCallId;
+
+    const gfxrecon::format::HandleId kCommandPoolId   = 1;
+    const gfxrecon::format::HandleId kCommandBufferId = 2;
+    const gfxrecon::format::HandleId kSetId           = 3;
+
+    // Stands in for the device: records the calls that would be replayed.
+    std::vector<ApiCallId>                            issued_calls;
+    gfxrecon::decode::VulkanCommandBufferReuseTracker tracker(
+        [&issued_calls](ApiCallId call_id, const gfxrecon::decode::ApiCallInfo&, const uint8_t*, size_t) {
+            issued_calls.push_back(call_id);
+        });
+
+    // Encodes the command buffer handle followed by a value that distinguishes recordings.
+    auto record = [&](const std::vector<uint32_t>& draws, bool reusable, bool bind_set) {
+        const gfxrecon::decode::ApiCallInfo call_info;
+        uint8_t                             parameters[sizeof(gfxrecon::format::HandleId) + sizeof(uint32_t)] = {};
+        std::memcpy(parameters, &kCommandBufferId, sizeof(kCommandBufferId));
+
+        tracker.BeginCommandBuffer(kCommandBufferId,
+                                   reusable,
+                                   ApiCallId::ApiCall_vkBeginCommandBuffer,
+                                   call_info,
+                                   parameters,
+                                   sizeof(parameters));
+
+        if (bind_set)
+        {
+            REQUIRE(tracker.IsRecording(kCommandBufferId));
+            tracker.RecordCommand(kCommandBufferId,
+                                  ApiCallId::ApiCall_vkCmdBindDescriptorSets,
+                                  call_info,
+                                  parameters,
+                                  sizeof(parameters));
+            tracker.AddDependencies(kCommandBufferId, &kSetId, 1);
+        }
+
+        for (uint32_t draw : draws)
+        {
+            std::memcpy(parameters + sizeof(kCommandBufferId), &draw, sizeof(draw));
+            tracker.RecordCommand(
+                kCommandBufferId, ApiCallId::ApiCall_vkCmdDraw, call_info, parameters, sizeof(parameters));
+        }
+
+        tracker.EndCommandBuffer(
+            kCommandBufferId, ApiCallId::ApiCall_vkEndCommandBuffer, call_info, parameters, sizeof(parameters));
+        REQUIRE(!tracker.IsRecording(kCommandBufferId));
+    };
+
+    const std::vector<ApiCallId> kDrawRecording = { ApiCallId::ApiCall_vkBeginCommandBuffer,
+                                                    ApiCallId::ApiCall_vkCmdDraw,
+                                                    ApiCallId::ApiCall_vkCmdDraw,
+                                                    ApiCallId::ApiCall_vkEndCommandBuffer };
+    const std::vector<ApiCallId> kBindRecording = { ApiCallId::ApiCall_vkBeginCommandBuffer,
+                                                    ApiCallId::ApiCall_vkCmdBindDescriptorSets,
+                                                    ApiCallId::ApiCall_vkCmdDraw,
+                                                    ApiCallId::ApiCall_vkEndCommandBuffer };
+
+    tracker.AllocateCommandBuffers(kCommandPoolId, &kCommandBufferId, 1);
+
+    record({ 1, 2 }, true, false);
+    REQUIRE(issued_calls == kDrawRecording);
+
+    // An identical recording is skipped.
+    issued_calls.clear();
+    record({ 1, 2 }, true, false);
+    REQUIRE(issued_calls.empty());
+    REQUIRE(tracker.GetReusedCount() == 1);
+
+    // A difference issues the held back calls and the rest of the recording, in order.
+    record({ 1, 3 }, true, false);
+    REQUIRE(issued_calls == kDrawRecording);
+
+    // A recording that is a prefix of the previous recording is not a match.
+    issued_calls.clear();
+    record({ 1 }, true, false);
+    REQUIRE(issued_calls.size() == 3);
+
+    // Pool resets, descriptor set updates, and single submission recordings prevent reuse.
+    issued_calls.clear();
+    tracker.ResetCommandPool(kCommandPoolId);
+    record({ 1 }, true, false);
+    REQUIRE(issued_calls.size() == 3);
+
+    issued_calls.clear();
+    record({ 4 }, true, true);
+    record({ 4 }, true, true);
+    REQUIRE(issued_calls == kBindRecording);
+
+    issued_calls.clear();
+    tracker.InvalidateDependents(kSetId);
+    record({ 4 }, true, true);
+    REQUIRE(issued_calls == kBindRecording);
+
+    issued_calls.clear();
+    record({ 4 }, false, true);
+    record({ 4 }, false, true);
+    REQUIRE(issued_calls.size() == (2 * kBindRecording.size()));
+
+    REQUIRE(tracker.GetReusedCount() == 2);
+}
+
+TEST_CASE("MemoryRangeIndex finds the ranges that overlap a memory range", "[memory_range_index]")
+{
+    gfxrecon::decode::MemoryRangeIndex<uint32_t> index;
+
+    auto find = [&index](uint64_t start, uint64_t end) {
+        std::vector<uint32_t> values;
+        index.ForEachOverlap(start, end, [&values](uint32_t value) { values.push_back(value); });
+        return values;
+    };
+
+    REQUIRE(find(0, 100).empty());
+
+    index.Insert(0, 64, 1);
+    index.Insert(64, 64, 2);
+    index.Insert(256, 1024, 3);
+    index.Insert(128, 32, 4);
+
+    // Range ends are exclusive, and results are ordered by offset.
+    REQUIRE(find(0, 64) == std::vector<uint32_t>{ 1 });
+    REQUIRE(find(63, 65) == std::vector<uint32_t>{ 1, 2 });
+    REQUIRE(find(160, 256).empty());
+    REQUIRE(find(100, 300) == std::vector<uint32_t>{ 2, 4, 3 });
+
+    // Aliased ranges that begin before the search range are found through their end offsets.
+    index.Insert(0, 2048, 5);
+    REQUIRE(find(1500, 1600) == std::vector<uint32_t>{ 5 });
+    REQUIRE(find(1000, 1001) == std::vector<uint32_t>{ 5, 3 });
+
+    REQUIRE(index.Remove(256, 3));
+    REQUIRE(!index.Remove(256, 3));
+    REQUIRE(!index.Remove(0, 4));
+    REQUIRE(find(1000, 1001) == std::vector<uint32_t>{ 5 });
+    REQUIRE(index.GetCount() == 4);
+}
+
+TEST_CASE("MemoryRangeIndex suballocated memory workload", "[memory_range_index][!benchmark]")
+{
+    // One memory object with thousands of suballocated buffers, written by small fills.
+    const uint32_t kResourceCount = 8192;
+    const uint64_t kResourceSize  = 4096;
+    const uint32_t kFillCount     = 10000;
+    const uint64_t kFillSize      = 256;
+
+    gfxrecon::decode::MemoryRangeIndex<uint32_t> index;
+    std::vector<std::pair<uint64_t, uint64_t>>   ranges;
+
+    for (uint32_t i = 0; i < kResourceCount; ++i)
+    {
+        const uint64_t offset = ((i * 7919) % kResourceCount) * kResourceSize;
+        index.Insert(offset, kResourceSize, i);
+        ranges.emplace_back(offset, offset + kResourceSize);
+    }
+
+    BENCHMARK("Visit the resources overlapping 10000 fills with the index")
+    {
+        uint64_t visited = 0;
+        for (uint32_t i = 0; i < kFillCount; ++i)
+        {
+            const uint64_t start = ((i * 104729) % (kResourceCount * kResourceSize - kFillSize));
+            index.ForEachOverlap(start, start + kFillSize, [&visited](uint32_t) { ++visited; });
+        }
+        return visited;
+    };
+
+    BENCHMARK("Visit the resources overlapping 10000 fills with a linear search")
+    {
+        uint64_t visited = 0;
+        for (uint32_t i = 0; i < kFillCount; ++i)
+        {
+            const uint64_t start = ((i * 104729) % (kResourceCount * kResourceSize - kFillSize));
+            for (const auto& range : ranges)
+            {
+                if ((range.first < (start + kFillSize)) && (start < range.second))
+                {
+                    ++visited;
+                }
+            }
+        }
+        return visited;
+    };
+}
+
+TEST_CASE("ShadowMemory only allocates the pages that are written", "[shadow_memory]")
+{
+    const size_t   kPageSize   = gfxrecon::decode::ShadowMemory::kPageSize;
+    const uint64_t kShadowSize = (kPageSize * 1024) + 100;
+
+    gfxrecon::decode::ShadowMemory shadow(kShadowSize);
+    REQUIRE(shadow.GetCommittedSize() == 0);
+
+    // A write that crosses a page boundary commits both pages, and the last page may be partial.
+    const std::vector<uint8_t> data(64, 0xab);
+    shadow.Write(kPageSize - 32, data.data(), data.size());
+    shadow.Write(kShadowSize - 10, data.data(), 10);
+    REQUIRE(shadow.GetCommittedSize() == (3 * kPageSize));
+    REQUIRE(gfxrecon::decode::ShadowMemory::GetPeakCommittedSize() >= (3 * kPageSize));
+
+    std::vector<uint8_t> content(96, 0xff);
+    shadow.Read(kPageSize - 64, content.size(), content.data());
+    REQUIRE(std::vector<uint8_t>(content.begin(), content.begin() + 32) == std::vector<uint8_t>(32, 0));
+    REQUIRE(std::vector<uint8_t>(content.begin() + 32, content.end()) == data);
+
+    REQUIRE(shadow.IsWritten(0, kPageSize));
+    REQUIRE(!shadow.IsWritten(2 * kPageSize, 100 * kPageSize));
+    REQUIRE(shadow.IsWritten(kShadowSize - 1, 1000));
+
+    // Consecutive written pages are reported as a single range, clipped to the requested range.
+    std::vector<std::pair<uint64_t, size_t>> ranges;
+    shadow.ForEachWrittenRange(16, kShadowSize, [&ranges](uint64_t offset, const uint8_t*, size_t size) {
+        ranges.emplace_back(offset, size);
+    });
+
+    REQUIRE(ranges.size() == 2);
+    REQUIRE(ranges[0] == std::make_pair<uint64_t, size_t>(16, (2 * kPageSize) - 16));
+    REQUIRE(ranges[1] == std::make_pair<uint64_t, size_t>(kPageSize * 1024, 100));
+}
+
+// Returns the content of a file written by DumpResourcesFileWriter.
+static std::vector<uint8_t> ReadDumpedFile(const std::string& filename)
+{
+    std::vector<uint8_t> content;
+    FILE*                file = fopen(filename.c_str(), "rb");
+    if (file != nullptr)
+    {
+        int value = 0;
+        while ((value = fgetc(file)) != EOF)
+        {
+            content.push_back(static_cast<uint8_t>(value));
+        }
+        fclose(file);
+    }
+    return content;
+}
+
+TEST_CASE("DumpResourcesFileWriter writes identical content once", "[dump_resources_file_writer]")
+{
+    const std::string kFileA = "gfxrecon_decode_test_dump_a.bin";
+    const std::string kFileB = "gfxrecon_decode_test_dump_b.bin";
+    const std::string kFileC = "gfxrecon_decode_test_dump_c.bin";
+    const std::string kFileD = "gfxrecon_decode_test_dump_d.bin";
+
+    const std::vector<uint8_t> first(4096, 0x11);
+    const std::vector<uint8_t> second(4096, 0x22);
+
+    std::vector<uint8_t> third = first;
+    third[4095]                = 0x33;
+
+    std::string rewritten_file;
+
+    {
+        gfxrecon::decode::DumpResourcesFileWriter file_writer;
+
+        // A write with the same data as a previous write refers to the file of that write.
+        file_writer.WriteBuffer(kFileA, std::vector<uint8_t>(first));
+        file_writer.WriteBuffer(kFileB, std::vector<uint8_t>(first));
+        REQUIRE(file_writer.GetWrittenFilename(kFileB) == kFileA);
+
+        // Data of the same size that differs in a single byte is written to its own file.
+        file_writer.WriteBuffer(kFileC, std::vector<uint8_t>(third));
+        REQUIRE(file_writer.GetWrittenFilename(kFileC) == kFileC);
+
+        // Data at an offset within a shared buffer is compared, rather than the whole buffer.
+        auto shared_data = std::make_shared<const std::vector<uint8_t>>(8192, 0x11);
+        file_writer.WriteBuffer(kFileD, shared_data, 1024, first.size());
+        REQUIRE(file_writer.GetWrittenFilename(kFileD) == kFileA);
+
+        // When a file is written again with new content, the files that referred to its previous content keep
+        // referring to it, and the new content is written to a file with a unique name.
+        file_writer.WriteBuffer(kFileA, std::vector<uint8_t>(second));
+        file_writer.Flush();
+
+        rewritten_file = file_writer.GetWrittenFilename(kFileA);
+        REQUIRE(rewritten_file != kFileA);
+        REQUIRE(file_writer.GetWrittenFilename(kFileB) == kFileA);
+        REQUIRE(file_writer.GetWrittenFilename(kFileD) == kFileA);
+        REQUIRE(ReadDumpedFile(kFileA) == first);
+        REQUIRE(ReadDumpedFile(rewritten_file) == second);
+        REQUIRE(ReadDumpedFile(kFileC) == third);
+
+        // A file that is not referred to by other files is written again in place.
+        const std::vector<uint8_t> fourth(2048, 0x44);
+        file_writer.WriteBuffer(kFileC, std::vector<uint8_t>(fourth));
+        file_writer.Flush();
+
+        REQUIRE(file_writer.GetWrittenFilename(kFileC) == kFileC);
+        REQUIRE(ReadDumpedFile(kFileC) == fourth);
+    }
+
+    for (const auto& filename : { kFileA, kFileB, kFileC, kFileD, rewritten_file })
+    {
+        remove(filename.c_str());
+    }
+}
+
+// Appends an encoded VkRect2D array, with offset (i, -i) and extent (100 + i, 200 + i) for element i.
+static void EncodeRectArray(uint64_t length, std::vector<uint8_t>* buffer)
+{
+    const uint32_t kAttributes = gfxrecon::format::PointerAttributes::kIsStruct |
+                                 gfxrecon::format::PointerAttributes::kIsArray |
+                                 gfxrecon::format::PointerAttributes::kHasAddress |
+                                 gfxrecon::format::PointerAttributes::kHasData;
+
+    auto append = [buffer](const auto& value) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        buffer->insert(buffer->end(), bytes, bytes + sizeof(value));
+    };
+
+    append(kAttributes);
+    append(uint64_t{ 0x1000 });
+    append(length);
+
+    for (int32_t i = 0; i < static_cast<int32_t>(length); ++i)
+    {
+        append(i);
+        append(-i);
+        append(static_cast<uint32_t>(100 + i));
+        append(static_cast<uint32_t>(200 + i));
+    }
+}
+
+TEST_CASE("StructPointerDecoder defers decoding of fixed size struct arrays", "[struct_pointer_decoder]")
+{
+    const uint64_t kLength        = 3;
+    const uint32_t kTrailingValue = 0xabcd;
+
+    std::vector<uint8_t> buffer;
+    EncodeRectArray(kLength, &buffer);
+
+    const size_t kEncodedSize = buffer.size();
+    buffer.resize(kEncodedSize + sizeof(kTrailingValue));
+    memcpy(buffer.data() + kEncodedSize, &kTrailingValue, sizeof(kTrailingValue));
+
+    gfxrecon::decode::DecodeAllocator::Begin();
+
+    {
+        // The size of the encoded array is reported without decoding the structs, which are decoded when accessed.
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkRect2D> decoder;
+        REQUIRE(decoder.Decode(buffer.data(), buffer.size()) == kEncodedSize);
+        REQUIRE(decoder.GetLength() == kLength);
+
+        const VkRect2D* rects = decoder.GetPointer();
+        REQUIRE(rects != nullptr);
+        REQUIRE(decoder.GetMetaStructPointer()[2].decoded_value == &rects[2]);
+
+        for (int32_t i = 0; i < static_cast<int32_t>(kLength); ++i)
+        {
+            REQUIRE(rects[i].offset.x == i);
+            REQUIRE(rects[i].offset.y == -i);
+            REQUIRE(rects[i].extent.width == static_cast<uint32_t>(100 + i));
+            REQUIRE(rects[i].extent.height == static_cast<uint32_t>(200 + i));
+        }
+    }
+
+    gfxrecon::decode::DecodeAllocator::End();
+}
+
+TEST_CASE("DecodeAllocator large call workload", "[decode_allocator][!benchmark]")
+{
+    // A stream of calls that each carry a struct array that is larger than the allocator's memory blocks.
+    const uint64_t kLength    = 64 * 1024;
+    const size_t   kCallCount = 64;
+
+    std::vector<uint8_t> buffer;
+    EncodeRectArray(kLength, &buffer);
+
+    auto decode_calls = [&buffer]() {
+        uint64_t checksum = 0;
+        for (size_t i = 0; i < kCallCount; ++i)
+        {
+            gfxrecon::decode::DecodeAllocator::Begin();
+
+            gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkRect2D> decoder;
+            decoder.Decode(buffer.data(), buffer.size());
+            checksum += decoder.GetPointer()[i].extent.width;
+
+            gfxrecon::decode::DecodeAllocator::End();
+        }
+        return checksum;
+    };
+
+    gfxrecon::decode::DecodeAllocator::Configure(gfxrecon::decode::DecodeAllocator::kDefaultBlockSize, 0, false);
+
+    BENCHMARK("Decode 64 large calls without reuse of oversized allocations")
+    {
+        return decode_calls();
+    };
+
+    gfxrecon::decode::DecodeAllocator::Configure(gfxrecon::decode::DecodeAllocator::kDefaultBlockSize,
+                                                 gfxrecon::decode::DecodeAllocator::kDefaultMaxCachedBytes,
+                                                 false);
+
+    BENCHMARK("Decode 64 large calls with reuse of oversized allocations")
+    {
+        return decode_calls();
+    };
+
+    gfxrecon::decode::DecodeAllocator::Configure(
+        4 * 1024 * 1024, gfxrecon::decode::DecodeAllocator::kDefaultMaxCachedBytes, true);
+
+    BENCHMARK("Decode 64 large calls with 4 MiB huge page blocks")
+    {
+        return decode_calls();
+    };
+
+    gfxrecon::decode::DecodeAllocator::Configure(gfxrecon::decode::DecodeAllocator::kDefaultBlockSize,
+                                                 gfxrecon::decode::DecodeAllocator::kDefaultMaxCachedBytes,
+                                                 false);
+    gfxrecon::decode::DecodeAllocator::DestroyInstance();
+}
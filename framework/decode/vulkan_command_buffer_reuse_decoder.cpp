@@ -0,0 +1,307 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_command_buffer_reuse_decoder.h"
+
+#include "decode/handle_pointer_decoder.h"
+#include "decode/struct_pointer_decoder.h"
+#include "decode/value_decoder.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+
+#include "vulkan/vulkan.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanCommandBufferReuseDecoder::VulkanCommandBufferReuseDecoder(bool enable_reuse) :
+    enable_reuse_(enable_reuse),
+    tracker_([this](format::ApiCallId call_id, const ApiCallInfo& call_info, const uint8_t* data, size_t size) {
+        VulkanDecoder::DecodeFunctionCall(call_id, call_info, data, size);
+    })
+{}
+
+void VulkanCommandBufferReuseDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                                         const ApiCallInfo& call_info,
+                                                         const uint8_t*     parameter_buffer,
+                                                         size_t             buffer_size)
+{
+    if (!enable_reuse_)
+    {
+        VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+        return;
+    }
+
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+            DecodeBeginCommandBuffer(call_id, call_info, parameter_buffer, buffer_size);
+            return;
+        case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
+        case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
+        case format::ApiCallId::ApiCall_vkResetCommandBuffer:
+        case format::ApiCallId::ApiCall_vkResetCommandPool:
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+            DecodeCommandBufferLifetimeCall(call_id, parameter_buffer, buffer_size);
+            VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+            return;
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSets:
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate:
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR:
+            DecodeDescriptorSetUpdate(call_id, parameter_buffer, buffer_size);
+            VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+            return;
+        case format::ApiCallId::ApiCall_vkCreateInstance:
+        case format::ApiCallId::ApiCall_vkEnumerateInstanceExtensionProperties:
+        case format::ApiCallId::ApiCall_vkEnumerateInstanceLayerProperties:
+        case format::ApiCallId::ApiCall_vkEnumerateInstanceVersion:
+            // Global commands are the only commands that do not begin with a handle.
+            VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+            return;
+        default:
+            break;
+    }
+
+    // Commands recorded to a command buffer, including vkEndCommandBuffer, begin with the command buffer handle.
+    // Handle IDs are unique across object types, so a call that begins with the ID of a command buffer that is being
+    // recorded is a command for that command buffer.
+    format::HandleId command_buffer = format::kNullHandleId;
+    if (buffer_size >= sizeof(command_buffer))
+    {
+        ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer);
+    }
+
+    if (!tracker_.IsRecording(command_buffer))
+    {
+        VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkEndCommandBuffer)
+    {
+        tracker_.EndCommandBuffer(command_buffer, call_id, call_info, parameter_buffer, buffer_size);
+    }
+    else
+    {
+        tracker_.RecordCommand(command_buffer, call_id, call_info, parameter_buffer, buffer_size);
+
+        if (((call_id == format::ApiCallId::ApiCall_vkCmdBindDescriptorSets) ||
+             (call_id == format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2KHR) ||
+             (call_id == format::ApiCallId::ApiCall_vkCmdExecuteCommands)) &&
+            tracker_.IsCapturing(command_buffer))
+        {
+            DecodeDependencies(call_id, command_buffer, parameter_buffer, buffer_size);
+        }
+    }
+}
+
+void VulkanCommandBufferReuseDecoder::DecodeBeginCommandBuffer(format::ApiCallId  call_id,
+                                                               const ApiCallInfo& call_info,
+                                                               const uint8_t*     parameter_buffer,
+                                                               size_t             buffer_size)
+{
+    size_t bytes_read = 0;
+
+    format::HandleId                                       command_buffer;
+    StructPointerDecoder<Decoded_VkCommandBufferBeginInfo> begin_info;
+
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &command_buffer);
+    bytes_read += begin_info.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+    // Command buffers recorded for a single submission become invalid after they are executed.
+    const VkCommandBufferBeginInfo* value    = begin_info.GetPointer();
+    const bool                      reusable = (value != nullptr) &&
+                                               ((value->flags & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) == 0);
+
+    tracker_.BeginCommandBuffer(command_buffer, reusable, call_id, call_info, parameter_buffer, buffer_size);
+}
+
+void VulkanCommandBufferReuseDecoder::DecodeCommandBufferLifetimeCall(format::ApiCallId call_id,
+                                                                      const uint8_t*    parameter_buffer,
+                                                                      size_t            buffer_size)
+{
+    size_t bytes_read = 0;
+
+    format::HandleId first_handle;
+    bytes_read += ValueDecoder::DecodeHandleIdValue(
+        (parameter_buffer + bytes_read), (buffer_size - bytes_read), &first_handle);
+
+    if (call_id == format::ApiCallId::ApiCall_vkResetCommandBuffer)
+    {
+        tracker_.ResetCommandBuffer(first_handle);
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkAllocateCommandBuffers)
+    {
+        StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo> allocate_info;
+        HandlePointerDecoder<VkCommandBuffer>                     command_buffers;
+
+        bytes_read += allocate_info.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        bytes_read += command_buffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const Decoded_VkCommandBufferAllocateInfo* meta_info = allocate_info.GetMetaStructPointer();
+        if ((meta_info != nullptr) && (command_buffers.GetPointer() != nullptr))
+        {
+            tracker_.AllocateCommandBuffers(
+                meta_info->commandPool, command_buffers.GetPointer(), command_buffers.GetLength());
+        }
+    }
+    else
+    {
+        format::HandleId command_pool;
+        bytes_read += ValueDecoder::DecodeHandleIdValue(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), &command_pool);
+
+        if (call_id == format::ApiCallId::ApiCall_vkFreeCommandBuffers)
+        {
+            uint32_t                              command_buffer_count;
+            HandlePointerDecoder<VkCommandBuffer> command_buffers;
+
+            bytes_read += ValueDecoder::DecodeUInt32Value(
+                (parameter_buffer + bytes_read), (buffer_size - bytes_read), &command_buffer_count);
+            bytes_read += command_buffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+            if (command_buffers.GetPointer() != nullptr)
+            {
+                tracker_.FreeCommandBuffers(command_pool, command_buffers.GetPointer(), command_buffers.GetLength());
+            }
+        }
+        else if (call_id == format::ApiCallId::ApiCall_vkResetCommandPool)
+        {
+            tracker_.ResetCommandPool(command_pool);
+        }
+        else
+        {
+            tracker_.DestroyCommandPool(command_pool);
+        }
+    }
+}
+
+void VulkanCommandBufferReuseDecoder::DecodeDescriptorSetUpdate(format::ApiCallId call_id,
+                                                                const uint8_t*    parameter_buffer,
+                                                                size_t            buffer_size)
+{
+    // Updates only need to be decoded when a recording depends on a descriptor set.
+    if (!tracker_.HasDependents())
+    {
+        return;
+    }
+
+    size_t bytes_read = 0;
+
+    format::HandleId device;
+    bytes_read +=
+        ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &device);
+
+    if (call_id == format::ApiCallId::ApiCall_vkUpdateDescriptorSets)
+    {
+        uint32_t                                           write_count;
+        StructPointerDecoder<Decoded_VkWriteDescriptorSet> writes;
+        uint32_t                                           copy_count;
+        StructPointerDecoder<Decoded_VkCopyDescriptorSet>  copies;
+
+        bytes_read +=
+            ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &write_count);
+        bytes_read += writes.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+        bytes_read +=
+            ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &copy_count);
+        bytes_read += copies.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const Decoded_VkWriteDescriptorSet* meta_writes = writes.GetMetaStructPointer();
+        if (meta_writes != nullptr)
+        {
+            for (size_t i = 0; i < writes.GetLength(); ++i)
+            {
+                tracker_.InvalidateDependents(meta_writes[i].dstSet);
+            }
+        }
+
+        const Decoded_VkCopyDescriptorSet* meta_copies = copies.GetMetaStructPointer();
+        if (meta_copies != nullptr)
+        {
+            for (size_t i = 0; i < copies.GetLength(); ++i)
+            {
+                tracker_.InvalidateDependents(meta_copies[i].dstSet);
+            }
+        }
+    }
+    else
+    {
+        format::HandleId descriptor_set;
+        bytes_read += ValueDecoder::DecodeHandleIdValue(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptor_set);
+
+        tracker_.InvalidateDependents(descriptor_set);
+    }
+}
+
+void VulkanCommandBufferReuseDecoder::DecodeDependencies(format::ApiCallId call_id,
+                                                         format::HandleId  command_buffer,
+                                                         const uint8_t*    parameter_buffer,
+                                                         size_t            buffer_size)
+{
+    size_t bytes_read = sizeof(format::HandleId);
+
+    if (call_id == format::ApiCallId::ApiCall_vkCmdBindDescriptorSets)
+    {
+        VkPipelineBindPoint                   bind_point;
+        format::HandleId                      layout;
+        uint32_t                              first_set;
+        uint32_t                              descriptor_set_count;
+        HandlePointerDecoder<VkDescriptorSet> descriptor_sets;
+
+        bytes_read +=
+            ValueDecoder::DecodeEnumValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &bind_point);
+        bytes_read +=
+            ValueDecoder::DecodeHandleIdValue((parameter_buffer + bytes_read), (buffer_size - bytes_read), &layout);
+        bytes_read +=
+            ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &first_set);
+        bytes_read += ValueDecoder::DecodeUInt32Value(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptor_set_count);
+        bytes_read += descriptor_sets.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        tracker_.AddDependencies(command_buffer, descriptor_sets.GetPointer(), descriptor_sets.GetLength());
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2KHR)
+    {
+        StructPointerDecoder<Decoded_VkBindDescriptorSetsInfoKHR> bind_info;
+        bytes_read += bind_info.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        const Decoded_VkBindDescriptorSetsInfoKHR* meta_info = bind_info.GetMetaStructPointer();
+        if (meta_info != nullptr)
+        {
+            tracker_.AddDependencies(
+                command_buffer, meta_info->pDescriptorSets.GetPointer(), meta_info->pDescriptorSets.GetLength());
+        }
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkCmdExecuteCommands)
+    {
+        uint32_t                              command_buffer_count;
+        HandlePointerDecoder<VkCommandBuffer> command_buffers;
+
+        bytes_read += ValueDecoder::DecodeUInt32Value(
+            (parameter_buffer + bytes_read), (buffer_size - bytes_read), &command_buffer_count);
+        bytes_read += command_buffers.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
+
+        tracker_.AddDependencies(command_buffer, command_buffers.GetPointer(), command_buffers.GetLength());
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
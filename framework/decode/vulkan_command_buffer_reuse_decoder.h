@@ -0,0 +1,86 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_COMMAND_BUFFER_REUSE_DECODER_H
+#define GFXRECON_DECODE_VULKAN_COMMAND_BUFFER_REUSE_DECODER_H
+
+#include "decode/vulkan_command_buffer_reuse_tracker.h"
+#include "format/api_call_id.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/defines.h"
+
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Vulkan decoder that skips the decoding and replay of command buffer recordings that are identical to the previous
+// recording of the same command buffer.  See VulkanCommandBufferReuseTracker for the conditions under which a
+// recording is reused.
+//
+// Recordings are compared with their encoded parameter data, which includes the capture time addresses of pointer
+// parameters.  Recordings that reference application memory allocated for each frame will not match.
+//
+// When reuse is not enabled, calls are decoded as they are by VulkanDecoder.
+class VulkanCommandBufferReuseDecoder : public VulkanDecoder
+{
+  public:
+    VulkanCommandBufferReuseDecoder(bool enable_reuse);
+
+    virtual ~VulkanCommandBufferReuseDecoder() override {}
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override;
+
+    uint64_t GetReusedCount() const { return tracker_.GetReusedCount(); }
+
+    uint64_t GetRecordedCount() const { return tracker_.GetRecordedCount(); }
+
+  private:
+    void DecodeBeginCommandBuffer(format::ApiCallId  call_id,
+                                  const ApiCallInfo& call_info,
+                                  const uint8_t*     parameter_buffer,
+                                  size_t             buffer_size);
+
+    void
+    DecodeCommandBufferLifetimeCall(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void DecodeDescriptorSetUpdate(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    // Adds the descriptor sets and secondary command buffers referenced by a call to the dependencies of the command
+    // buffer.
+    void DecodeDependencies(format::ApiCallId call_id,
+                            format::HandleId  command_buffer,
+                            const uint8_t*    parameter_buffer,
+                            size_t            buffer_size);
+
+  private:
+    bool                            enable_reuse_;
+    VulkanCommandBufferReuseTracker tracker_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_COMMAND_BUFFER_REUSE_DECODER_H
@@ -0,0 +1,427 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_command_buffer_reuse_tracker.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void VulkanCommandBufferReuseTracker::BeginCommandBuffer(format::HandleId   command_buffer,
+                                                         bool               reusable,
+                                                         format::ApiCallId  call_id,
+                                                         const ApiCallInfo& call_info,
+                                                         const uint8_t*     parameter_buffer,
+                                                         size_t             buffer_size)
+{
+    CommandBufferState* state = GetState(command_buffer);
+
+    if (state->mode == Mode::kComparing)
+    {
+        // The held back calls would be discarded by the implicit reset of vkBeginCommandBuffer, so they are not issued.
+        // The previous recording no longer matches the command buffer state at capture.
+        state->deferred_calls.clear();
+        state->recording_valid = false;
+    }
+
+    if (reusable && state->recording_valid)
+    {
+        SetMode(state, Mode::kComparing);
+        state->stream.clear();
+
+        if (!AppendCall(state, call_id, call_info, parameter_buffer, buffer_size))
+        {
+            IssueDeferredCalls(command_buffer, state);
+        }
+    }
+    else
+    {
+        // Recording the command buffer again invalidates the primary command buffers that execute it.
+        InvalidateDependents(command_buffer);
+        ClearDependencies(command_buffer, state);
+
+        SetMode(state, Mode::kCapturing);
+        state->recording_valid = false;
+        state->capture_valid   = reusable;
+        state->stream.clear();
+
+        if (reusable)
+        {
+            AppendCall(state, call_id, call_info, parameter_buffer, buffer_size);
+        }
+
+        issue_call_(call_id, call_info, parameter_buffer, buffer_size);
+    }
+}
+
+void VulkanCommandBufferReuseTracker::RecordCommand(format::HandleId   command_buffer,
+                                                    format::ApiCallId  call_id,
+                                                    const ApiCallInfo& call_info,
+                                                    const uint8_t*     parameter_buffer,
+                                                    size_t             buffer_size)
+{
+    CommandBufferState* state = GetState(command_buffer);
+
+    if (state->mode == Mode::kComparing)
+    {
+        if (!AppendCall(state, call_id, call_info, parameter_buffer, buffer_size))
+        {
+            IssueDeferredCalls(command_buffer, state);
+        }
+    }
+    else
+    {
+        if (state->capture_valid)
+        {
+            AppendCall(state, call_id, call_info, parameter_buffer, buffer_size);
+        }
+
+        issue_call_(call_id, call_info, parameter_buffer, buffer_size);
+    }
+}
+
+void VulkanCommandBufferReuseTracker::EndCommandBuffer(format::HandleId   command_buffer,
+                                                       format::ApiCallId  call_id,
+                                                       const ApiCallInfo& call_info,
+                                                       const uint8_t*     parameter_buffer,
+                                                       size_t             buffer_size)
+{
+    CommandBufferState* state = GetState(command_buffer);
+
+    if (state->mode == Mode::kComparing)
+    {
+        if (AppendCall(state, call_id, call_info, parameter_buffer, buffer_size) &&
+            (state->stream.size() == state->recording.size()))
+        {
+            // The command buffer still holds the matching previous recording.
+            state->deferred_calls.clear();
+            state->stream.clear();
+            SetMode(state, Mode::kIdle);
+            ++reused_count_;
+            return;
+        }
+
+        IssueDeferredCalls(command_buffer, state);
+    }
+    else
+    {
+        if (state->capture_valid)
+        {
+            AppendCall(state, call_id, call_info, parameter_buffer, buffer_size);
+        }
+
+        issue_call_(call_id, call_info, parameter_buffer, buffer_size);
+    }
+
+    FinishRecording(command_buffer, state);
+}
+
+void VulkanCommandBufferReuseTracker::AddDependencies(format::HandleId        command_buffer,
+                                                      const format::HandleId* handles,
+                                                      size_t                  count)
+{
+    assert((handles != nullptr) || (count == 0));
+
+    auto entry = command_buffers_.find(command_buffer);
+    if (entry == command_buffers_.end())
+    {
+        return;
+    }
+
+    // While comparing, the dependencies match those of the previous recording, which are already registered.
+    CommandBufferState& state = entry->second;
+    if ((state.mode == Mode::kCapturing) && state.capture_valid)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if ((handles[i] != format::kNullHandleId) && dependents_[handles[i]].insert(command_buffer).second)
+            {
+                state.dependencies.push_back(handles[i]);
+            }
+        }
+    }
+}
+
+void VulkanCommandBufferReuseTracker::InvalidateDependents(format::HandleId handle)
+{
+    auto entry = dependents_.find(handle);
+    if (entry == dependents_.end())
+    {
+        return;
+    }
+
+    // Invalidating a dependent command buffer may issue its held back calls, which invalidates its own dependents, so
+    // the entry is removed before the command buffers are processed.
+    std::unordered_set<format::HandleId> command_buffers = std::move(entry->second);
+    dependents_.erase(entry);
+
+    for (format::HandleId command_buffer : command_buffers)
+    {
+        auto state_entry = command_buffers_.find(command_buffer);
+        if (state_entry != command_buffers_.end())
+        {
+            CommandBufferState* state = &state_entry->second;
+
+            if (state->mode == Mode::kComparing)
+            {
+                IssueDeferredCalls(command_buffer, state);
+            }
+
+            state->recording_valid = false;
+            state->capture_valid   = false;
+            state->recording.clear();
+            state->stream.clear();
+
+            ClearDependencies(command_buffer, state);
+        }
+    }
+}
+
+void VulkanCommandBufferReuseTracker::AllocateCommandBuffers(format::HandleId        command_pool,
+                                                             const format::HandleId* command_buffers,
+                                                             size_t                  count)
+{
+    assert((command_buffers != nullptr) || (count == 0));
+
+    std::vector<format::HandleId>& pool_command_buffers = pool_command_buffers_[command_pool];
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        GetState(command_buffers[i])->command_pool = command_pool;
+        pool_command_buffers.push_back(command_buffers[i]);
+    }
+}
+
+void VulkanCommandBufferReuseTracker::FreeCommandBuffers(format::HandleId        command_pool,
+                                                         const format::HandleId* command_buffers,
+                                                         size_t                  count)
+{
+    assert((command_buffers != nullptr) || (count == 0));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto entry = command_buffers_.find(command_buffers[i]);
+        if (entry != command_buffers_.end())
+        {
+            ResetState(command_buffers[i], &entry->second);
+            command_buffers_.erase(command_buffers[i]);
+        }
+    }
+
+    auto pool_entry = pool_command_buffers_.find(command_pool);
+    if (pool_entry != pool_command_buffers_.end())
+    {
+        std::vector<format::HandleId>& pool_command_buffers = pool_entry->second;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            pool_command_buffers.erase(
+                std::remove(pool_command_buffers.begin(), pool_command_buffers.end(), command_buffers[i]),
+                pool_command_buffers.end());
+        }
+    }
+}
+
+void VulkanCommandBufferReuseTracker::ResetCommandBuffer(format::HandleId command_buffer)
+{
+    auto entry = command_buffers_.find(command_buffer);
+    if (entry != command_buffers_.end())
+    {
+        ResetState(command_buffer, &entry->second);
+    }
+}
+
+void VulkanCommandBufferReuseTracker::ResetCommandPool(format::HandleId command_pool)
+{
+    auto pool_entry = pool_command_buffers_.find(command_pool);
+    if (pool_entry != pool_command_buffers_.end())
+    {
+        for (format::HandleId command_buffer : pool_entry->second)
+        {
+            ResetCommandBuffer(command_buffer);
+        }
+    }
+}
+
+void VulkanCommandBufferReuseTracker::DestroyCommandPool(format::HandleId command_pool)
+{
+    auto pool_entry = pool_command_buffers_.find(command_pool);
+    if (pool_entry != pool_command_buffers_.end())
+    {
+        std::vector<format::HandleId> command_buffers = std::move(pool_entry->second);
+        pool_command_buffers_.erase(pool_entry);
+
+        for (format::HandleId command_buffer : command_buffers)
+        {
+            auto entry = command_buffers_.find(command_buffer);
+            if (entry != command_buffers_.end())
+            {
+                ResetState(command_buffer, &entry->second);
+                command_buffers_.erase(command_buffer);
+            }
+        }
+    }
+}
+
+VulkanCommandBufferReuseTracker::CommandBufferState*
+VulkanCommandBufferReuseTracker::GetState(format::HandleId command_buffer)
+{
+    return &command_buffers_[command_buffer];
+}
+
+void VulkanCommandBufferReuseTracker::SetMode(CommandBufferState* state, Mode mode)
+{
+    assert(state != nullptr);
+
+    if ((state->mode == Mode::kIdle) && (mode != Mode::kIdle))
+    {
+        ++recording_count_;
+    }
+    else if ((state->mode != Mode::kIdle) && (mode == Mode::kIdle))
+    {
+        assert(recording_count_ > 0);
+        --recording_count_;
+    }
+
+    state->mode = mode;
+}
+
+bool VulkanCommandBufferReuseTracker::AppendCall(CommandBufferState* state,
+                                                 format::ApiCallId   call_id,
+                                                 const ApiCallInfo&  call_info,
+                                                 const uint8_t*      parameter_buffer,
+                                                 size_t              buffer_size)
+{
+    assert(state != nullptr);
+
+    const uint64_t size   = buffer_size;
+    const size_t   offset = state->stream.size();
+    const size_t   end    = offset + kCallHeaderSize + buffer_size;
+
+    state->stream.resize(end);
+
+    uint8_t* data = state->stream.data() + offset;
+    util::platform::MemoryCopy(data, sizeof(call_id), &call_id, sizeof(call_id));
+    util::platform::MemoryCopy(data + sizeof(call_id), sizeof(size), &size, sizeof(size));
+
+    if (buffer_size > 0)
+    {
+        util::platform::MemoryCopy(data + kCallHeaderSize, buffer_size, parameter_buffer, buffer_size);
+    }
+
+    if (state->mode != Mode::kComparing)
+    {
+        return true;
+    }
+
+    state->deferred_calls.push_back({ call_id, call_info, offset + kCallHeaderSize, buffer_size });
+
+    return (end <= state->recording.size()) &&
+           (util::platform::MemoryCompare(data, state->recording.data() + offset, end - offset) == 0);
+}
+
+void VulkanCommandBufferReuseTracker::IssueDeferredCalls(format::HandleId command_buffer, CommandBufferState* state)
+{
+    assert((state != nullptr) && (state->mode == Mode::kComparing));
+
+    // The command buffer is now recorded again, replacing the previous recording.
+    SetMode(state, Mode::kCapturing);
+    state->recording_valid = false;
+    state->capture_valid   = true;
+
+    InvalidateDependents(command_buffer);
+
+    for (const DeferredCall& call : state->deferred_calls)
+    {
+        issue_call_(call.call_id, call.call_info, state->stream.data() + call.offset, call.size);
+    }
+
+    state->deferred_calls.clear();
+}
+
+void VulkanCommandBufferReuseTracker::FinishRecording(format::HandleId command_buffer, CommandBufferState* state)
+{
+    assert(state != nullptr);
+
+    if (state->capture_valid)
+    {
+        std::swap(state->recording, state->stream);
+        state->recording_valid = true;
+    }
+    else
+    {
+        state->recording.clear();
+        state->recording_valid = false;
+
+        ClearDependencies(command_buffer, state);
+    }
+
+    state->capture_valid = false;
+    state->stream.clear();
+    SetMode(state, Mode::kIdle);
+
+    ++recorded_count_;
+}
+
+void VulkanCommandBufferReuseTracker::ClearDependencies(format::HandleId command_buffer, CommandBufferState* state)
+{
+    assert(state != nullptr);
+
+    for (format::HandleId handle : state->dependencies)
+    {
+        auto entry = dependents_.find(handle);
+        if (entry != dependents_.end())
+        {
+            entry->second.erase(command_buffer);
+            if (entry->second.empty())
+            {
+                dependents_.erase(entry);
+            }
+        }
+    }
+
+    state->dependencies.clear();
+}
+
+void VulkanCommandBufferReuseTracker::ResetState(format::HandleId command_buffer, CommandBufferState* state)
+{
+    assert(state != nullptr);
+
+    // Held back calls are discarded, as the command buffer state is the same after a reset whether or not they were
+    // issued.
+    InvalidateDependents(command_buffer);
+    ClearDependencies(command_buffer, state);
+
+    SetMode(state, Mode::kIdle);
+    state->recording_valid = false;
+    state->capture_valid   = false;
+    state->recording.clear();
+    state->stream.clear();
+    state->deferred_calls.clear();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,196 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_COMMAND_BUFFER_REUSE_TRACKER_H
+#define GFXRECON_DECODE_VULKAN_COMMAND_BUFFER_REUSE_TRACKER_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Detects command buffers that are re-recorded with the same encoded call stream as their previous recording, so that
+// replay can keep the previously recorded command buffer instead of recording it again.
+//
+// The calls between vkBeginCommandBuffer and vkEndCommandBuffer are passed to the tracker, which forwards them to the
+// issue function.  When the command buffer has a reusable recording, the calls are held back and compared with the
+// previous recording.  A complete match skips the calls, leaving the command buffer in the executable state from the
+// previous recording.  The first difference issues the held back calls and the remainder of the recording normally.
+//
+// A recording stops being reusable when its command buffer or pool is reset or freed, when a descriptor set that it
+// bound is updated, or when a secondary command buffer that it executes is recorded again.  Recordings begun with
+// VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT are never reused.
+class VulkanCommandBufferReuseTracker
+{
+  public:
+    typedef std::function<void(format::ApiCallId, const ApiCallInfo&, const uint8_t*, size_t)> IssueCallFunction;
+
+  public:
+    VulkanCommandBufferReuseTracker(IssueCallFunction issue_call) : issue_call_(std::move(issue_call)) {}
+
+    // Returns true when the command buffer is between vkBeginCommandBuffer and vkEndCommandBuffer, indicating that
+    // calls recorded to it must be passed to RecordCommand.
+    bool IsRecording(format::HandleId command_buffer) const
+    {
+        if (recording_count_ == 0)
+        {
+            return false;
+        }
+
+        auto entry = command_buffers_.find(command_buffer);
+        return (entry != command_buffers_.end()) && (entry->second.mode != Mode::kIdle);
+    }
+
+    // Returns true when the command buffer is being recorded to the device with a recording that may be reused, so its
+    // dependencies must be passed to AddDependencies.
+    bool IsCapturing(format::HandleId command_buffer) const
+    {
+        auto entry = command_buffers_.find(command_buffer);
+        return (entry != command_buffers_.end()) && (entry->second.mode == Mode::kCapturing) &&
+               entry->second.capture_valid;
+    }
+
+    // Returns true when a recording depends on at least one object.
+    bool HasDependents() const { return !dependents_.empty(); }
+
+    void BeginCommandBuffer(format::HandleId   command_buffer,
+                            bool               reusable,
+                            format::ApiCallId  call_id,
+                            const ApiCallInfo& call_info,
+                            const uint8_t*     parameter_buffer,
+                            size_t             buffer_size);
+
+    void RecordCommand(format::HandleId   command_buffer,
+                       format::ApiCallId  call_id,
+                       const ApiCallInfo& call_info,
+                       const uint8_t*     parameter_buffer,
+                       size_t             buffer_size);
+
+    void EndCommandBuffer(format::HandleId   command_buffer,
+                          format::ApiCallId  call_id,
+                          const ApiCallInfo& call_info,
+                          const uint8_t*     parameter_buffer,
+                          size_t             buffer_size);
+
+    // Records objects, such as descriptor sets and secondary command buffers, that the current recording of a command
+    // buffer depends on.  Must be called after the call that references the objects is passed to RecordCommand.
+    void AddDependencies(format::HandleId command_buffer, const format::HandleId* handles, size_t count);
+
+    // Prevents the reuse of recordings that depend on the specified object.
+    void InvalidateDependents(format::HandleId handle);
+
+    // The following must be called before the corresponding API call is issued.
+    void AllocateCommandBuffers(format::HandleId command_pool, const format::HandleId* command_buffers, size_t count);
+
+    void FreeCommandBuffers(format::HandleId command_pool, const format::HandleId* command_buffers, size_t count);
+
+    void ResetCommandBuffer(format::HandleId command_buffer);
+
+    void ResetCommandPool(format::HandleId command_pool);
+
+    void DestroyCommandPool(format::HandleId command_pool);
+
+    uint64_t GetReusedCount() const { return reused_count_; }
+
+    uint64_t GetRecordedCount() const { return recorded_count_; }
+
+  private:
+    static const size_t kCallHeaderSize = sizeof(format::ApiCallId) + sizeof(uint64_t);
+
+    enum class Mode
+    {
+        kIdle,
+        kCapturing,  // Calls are issued, and stored for comparison with the next recording when capture_valid is set.
+        kComparing   // Calls are held back and compared with the previous recording.
+    };
+
+    struct DeferredCall
+    {
+        format::ApiCallId call_id;
+        ApiCallInfo       call_info;
+        size_t            offset;
+        size_t            size;
+    };
+
+    struct CommandBufferState
+    {
+        format::HandleId command_pool{ format::kNullHandleId };
+        Mode             mode{ Mode::kIdle };
+
+        // The previous complete recording, stored as a sequence of call ID, parameter size, and parameter data.
+        bool                 recording_valid{ false };
+        std::vector<uint8_t> recording;
+
+        // The recording in progress.
+        bool                      capture_valid{ false };
+        std::vector<uint8_t>      stream;
+        std::vector<DeferredCall> deferred_calls;
+
+        // Objects for which the command buffer has been added to dependents_.
+        std::vector<format::HandleId> dependencies;
+    };
+
+  private:
+    CommandBufferState* GetState(format::HandleId command_buffer);
+
+    void SetMode(CommandBufferState* state, Mode mode);
+
+    // Appends a call to the recording in progress, returning false if it no longer matches the previous recording.
+    bool AppendCall(CommandBufferState* state,
+                    format::ApiCallId   call_id,
+                    const ApiCallInfo&  call_info,
+                    const uint8_t*      parameter_buffer,
+                    size_t              buffer_size);
+
+    // Issues the held back calls of a command buffer that no longer matches its previous recording.
+    void IssueDeferredCalls(format::HandleId command_buffer, CommandBufferState* state);
+
+    void FinishRecording(format::HandleId command_buffer, CommandBufferState* state);
+
+    void ClearDependencies(format::HandleId command_buffer, CommandBufferState* state);
+
+    // Discards the current and previous recordings of a command buffer that is reset or freed.
+    void ResetState(format::HandleId command_buffer, CommandBufferState* state);
+
+  private:
+    IssueCallFunction                                                          issue_call_;
+    std::unordered_map<format::HandleId, CommandBufferState>                   command_buffers_;
+    std::unordered_map<format::HandleId, std::vector<format::HandleId>>        pool_command_buffers_;
+    std::unordered_map<format::HandleId, std::unordered_set<format::HandleId>> dependents_;
+    size_t                                                                     recording_count_{ 0 };
+    uint64_t                                                                   reused_count_{ 0 };
+    uint64_t                                                                   recorded_count_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_COMMAND_BUFFER_REUSE_TRACKER_H
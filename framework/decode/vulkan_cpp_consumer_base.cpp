@@ -408,6 +408,9 @@ void VulkanCppConsumerBase::Destroy()
 {
     EndFrameFile(frame_number_, frame_split_number_);
 
+    data_packer_.Close();
+    spv_saver_.Close();
+
     if (main_file_ != nullptr)
     {
         PrintOutGlobalVar();
@@ -23,76 +23,217 @@
 #include "util/file_path.h"
 #include "util/platform.h"
 
+#include <algorithm>
+#include <future>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+DataFilePacker::~DataFilePacker()
+{
+    Close();
+}
+
 void DataFilePacker::Initialize(const std::string& outDir,
                                 const std::string& prefix,
                                 const std::string& suffix,
                                 uint32_t           sizeLimitInBytes)
 {
+    Close();
+
     out_dir_             = outDir;
     prefix_              = prefix;
     suffix_              = suffix;
     size_limit_in_bytes_ = sizeLimitInBytes;
 
+    data_file_paths_.clear();
+    data_file_map_.clear();
+
     NewTargetFile();
 }
 
 const SavedFileInfo DataFilePacker::AddFileContents(const uint8_t* data, const size_t dataSize)
 {
-    const uint64_t hash_value = util::hash::GenerateCheckSum<uint64_t>(data, dataSize);
-    SavedFileInfo& data_entry = data_file_map_[hash_value];
+    const uint64_t          hash_value = HashContents(data, dataSize);
+    std::vector<DataEntry>& entries    = data_file_map_[hash_value];
 
-    if (data_entry.file_path.empty())
+    for (const DataEntry& entry : entries)
     {
-        // The binary contents is not found in any previous chunk.
-        if (current_data_file_.current_size > size_limit_in_bytes_)
+        if ((entry.size == dataSize) && CompareFileContents(entry, data))
         {
-            // Reached the current file size limit, create a new data chunk.
-            NewTargetFile();
+            return SavedFileInfo{ data_file_paths_[entry.file_index], entry.byte_offset };
         }
+    }
+
+    // The binary contents is not found in any previous chunk.
+    if (current_size_ > size_limit_in_bytes_)
+    {
+        // Reached the current file size limit, create a new data chunk.
+        NewTargetFile();
+    }
+
+    const DataEntry entry = { static_cast<uint32_t>(data_file_paths_.size() - 1), current_size_, dataSize };
+    entries.push_back(entry);
 
-        data_entry.file_path   = current_data_file_.file_path;
-        data_entry.byte_offset = current_data_file_.current_size;
+    WriteContentsToFile(dataSize, data);
 
-        WriteContentsToFile(
-            util::filepath::Join(out_dir_, data_entry.file_path), data_entry.byte_offset, dataSize, data);
+    current_size_ += dataSize;
 
-        current_data_file_.current_size += dataSize;
+    return SavedFileInfo{ data_file_paths_[entry.file_index], entry.byte_offset };
+}
+
+void DataFilePacker::Close()
+{
+    if (current_file_ != nullptr)
+    {
+        util::platform::FileClose(current_file_);
+        current_file_ = nullptr;
     }
 
-    return data_entry;
+    if (read_file_ != nullptr)
+    {
+        util::platform::FileClose(read_file_);
+        read_file_ = nullptr;
+    }
 }
 
 void DataFilePacker::NewTargetFile(void)
 {
-    current_data_file_ = SavedFile{ prefix_ + std::to_string(++data_file_counter_) + "." + suffix_, 0 };
+    if (current_file_ != nullptr)
+    {
+        util::platform::FileClose(current_file_);
+        current_file_ = nullptr;
+    }
+
+    // The file is created when the first blob is written to it.
+    data_file_paths_.push_back(prefix_ + std::to_string(data_file_paths_.size() + 1) + "." + suffix_);
+    current_size_ = 0;
 }
 
-void DataFilePacker::WriteContentsToFile(const std::string& file_path,
-                                         uint64_t           fileOffset,
-                                         uint64_t           size,
-                                         const uint8_t*     data)
+bool DataFilePacker::OpenTargetFile(void)
 {
-    FILE*   fp     = nullptr;
-    int32_t result = util::platform::FileOpen(&fp, file_path.c_str(), "ab");
+    const std::string file_path = util::filepath::Join(out_dir_, data_file_paths_.back());
 
-    if (result != 0)
+    int32_t result = util::platform::FileOpen(&current_file_, file_path.c_str(), "wb");
+    if ((result != 0) || (current_file_ == nullptr))
     {
         fprintf(stderr, "Error while opening file: %s\n", file_path.c_str());
-        return;
+        current_file_ = nullptr;
+        return false;
     }
 
-    util::platform::FileSeek(fp, fileOffset, util::platform::FileSeekCurrent);
+    // The buffer is reused by each data file, which is safe because the previous file is closed first.
+    write_buffer_.resize(kWriteBufferSize);
+    setvbuf(current_file_, write_buffer_.data(), _IOFBF, write_buffer_.size());
+
+    return true;
+}
+
+void DataFilePacker::WriteContentsToFile(uint64_t size, const uint8_t* data)
+{
+    if ((current_file_ == nullptr) && !OpenTargetFile())
+    {
+        return;
+    }
 
-    size_t written_size = util::platform::FileWrite(data, sizeof(uint8_t), size, fp);
+    size_t written_size = util::platform::FileWrite(data, sizeof(uint8_t), size, current_file_);
     if (written_size != size)
     {
-        fprintf(stderr, "Error while saving data into %s\n", file_path.c_str());
+        fprintf(stderr, "Error while saving data into %s\n", data_file_paths_.back().c_str());
+    }
+}
+
+uint64_t DataFilePacker::HashContents(const uint8_t* data, size_t size)
+{
+    if (size <= kParallelHashChunkSize)
+    {
+        return util::hash::ContentHash64::Generate(data, size);
+    }
+
+    if (hash_thread_pool_ == nullptr)
+    {
+        hash_thread_pool_ = std::make_unique<util::ThreadPool>();
+    }
+
+    const size_t                       chunk_count = (size + kParallelHashChunkSize - 1) / kParallelHashChunkSize;
+    std::vector<std::future<uint64_t>> pending;
+    pending.reserve(chunk_count);
+
+    for (size_t i = 0; i < chunk_count; ++i)
+    {
+        const uint8_t* chunk_data = data + (i * kParallelHashChunkSize);
+        const size_t   remaining  = size - (i * kParallelHashChunkSize);
+        const size_t   chunk_size = (remaining < kParallelHashChunkSize) ? remaining : kParallelHashChunkSize;
+
+        pending.push_back(hash_thread_pool_->Submit(
+            [chunk_data, chunk_size]() { return util::hash::ContentHash64::Generate(chunk_data, chunk_size); }));
+    }
+
+    // The chunk hashes are combined with a hash of their concatenation, seeded with the total size.
+    std::vector<uint64_t> chunk_hashes;
+    chunk_hashes.reserve(chunk_count);
+
+    for (auto& hash : pending)
+    {
+        chunk_hashes.push_back(hash.get());
+    }
+
+    return util::hash::ContentHash64::Generate(reinterpret_cast<const uint8_t*>(chunk_hashes.data()),
+                                               chunk_hashes.size() * sizeof(uint64_t),
+                                               static_cast<uint64_t>(size));
+}
+
+bool DataFilePacker::CompareFileContents(const DataEntry& entry, const uint8_t* data)
+{
+    // The stored copy may still be in the write buffer of the current file.
+    if ((current_file_ != nullptr) && (entry.file_index == (data_file_paths_.size() - 1)))
+    {
+        util::platform::FileFlush(current_file_);
+    }
+
+    if ((read_file_ != nullptr) && (read_file_index_ != entry.file_index))
+    {
+        util::platform::FileClose(read_file_);
+        read_file_ = nullptr;
+    }
+
+    if (read_file_ == nullptr)
+    {
+        const std::string file_path = util::filepath::Join(out_dir_, data_file_paths_[entry.file_index]);
+
+        int32_t result = util::platform::FileOpen(&read_file_, file_path.c_str(), "rb");
+        if ((result != 0) || (read_file_ == nullptr))
+        {
+            read_file_ = nullptr;
+            return false;
+        }
+
+        read_file_index_ = entry.file_index;
+    }
+
+    if (!util::platform::FileSeek(read_file_, entry.byte_offset, util::platform::FileSeekSet))
+    {
+        return false;
+    }
+
+    read_buffer_.resize(kReadBufferSize);
+
+    uint64_t remaining = entry.size;
+    while (remaining > 0)
+    {
+        const size_t read_size = static_cast<size_t>(std::min<uint64_t>(remaining, read_buffer_.size()));
+
+        if ((util::platform::FileRead(read_buffer_.data(), sizeof(uint8_t), read_size, read_file_) != read_size) ||
+            (util::platform::MemoryCompare(read_buffer_.data(), data, read_size) != 0))
+        {
+            return false;
+        }
+
+        data += read_size;
+        remaining -= read_size;
     }
 
-    util::platform::FileClose(fp);
+    return true;
 }
 
 GFXRECON_END_NAMESPACE(decode)
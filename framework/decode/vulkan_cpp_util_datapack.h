@@ -18,10 +18,14 @@
 #ifndef GFXRECON_DECODE_VULKAN_CPP_UTIL_DATAPACK_H
 #define GFXRECON_DECODE_VULKAN_CPP_UTIL_DATAPACK_H
 
+#include <cstdio>
+#include <memory>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 #include "util/defines.h"
+#include "util/thread_pool.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -32,10 +36,15 @@ struct SavedFileInfo
     uint64_t    byte_offset;
 };
 
+// Packs binary blobs into a sequence of data files, storing identical contents only once.  The current data file is
+// kept open with a large write buffer until the size limit is reached, and blobs with matching hashes are compared
+// byte for byte with the stored copy before they are treated as duplicates.
 class DataFilePacker
 {
   public:
-    DataFilePacker() : data_file_counter_(0) {}
+    DataFilePacker() {}
+
+    ~DataFilePacker();
 
     void                Initialize(const std::string& outDir,
                                    const std::string& prefix,
@@ -43,24 +52,50 @@ class DataFilePacker
                                    uint32_t           sizeLimitInBytes);
     const SavedFileInfo AddFileContents(const uint8_t* data, const size_t dataSize);
 
+    // Writes any buffered data and closes the open data files.
+    void Close();
+
   private:
-    void NewTargetFile(void);
-    void WriteContentsToFile(const std::string& filePath, uint64_t fileOffset, uint64_t size, const uint8_t* data);
+    static const size_t kWriteBufferSize       = 4 * 1024 * 1024;
+    static const size_t kReadBufferSize        = 1024 * 1024;
+    static const size_t kParallelHashChunkSize = 4 * 1024 * 1024;
 
-    struct SavedFile
+    struct DataEntry
     {
-        std::string file_path;
-        uint64_t    current_size;
+        uint32_t file_index;
+        uint64_t byte_offset;
+        uint64_t size;
     };
 
+  private:
+    void NewTargetFile(void);
+    bool OpenTargetFile(void);
+    void WriteContentsToFile(uint64_t size, const uint8_t* data);
+
+    // Blobs larger than kParallelHashChunkSize are hashed in chunks on the thread pool.
+    uint64_t HashContents(const uint8_t* data, size_t size);
+
+    bool CompareFileContents(const DataEntry& entry, const uint8_t* data);
+
+  private:
     std::string out_dir_;
     std::string prefix_;
     std::string suffix_;
-    uint32_t    size_limit_in_bytes_;
-    uint32_t    data_file_counter_;
+    uint32_t    size_limit_in_bytes_{ 0 };
+
+    // Data file paths, relative to the output directory and indexed by DataEntry::file_index.
+    std::vector<std::string> data_file_paths_;
+    FILE*                    current_file_{ nullptr };
+    uint64_t                 current_size_{ 0 };
+    std::vector<char>        write_buffer_;
+
+    // Data file that is currently open for duplicate verification.
+    FILE*                read_file_{ nullptr };
+    uint32_t             read_file_index_{ 0 };
+    std::vector<uint8_t> read_buffer_;
 
-    std::unordered_map<uint64_t, SavedFileInfo> data_file_map_;
-    SavedFile                                   current_data_file_;
+    std::unordered_map<uint64_t, std::vector<DataEntry>> data_file_map_;
+    std::unique_ptr<util::ThreadPool>                    hash_thread_pool_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
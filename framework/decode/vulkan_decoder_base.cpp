@@ -32,7 +32,7 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 void VulkanDecoderBase::WaitIdle()
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kWait))
     {
         consumer->WaitDevicesIdle();
     }
@@ -40,7 +40,7 @@ void VulkanDecoderBase::WaitIdle()
 
 void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessStateBeginMarker(frame_number);
     }
@@ -48,7 +48,7 @@ void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
 
 void VulkanDecoderBase::DispatchStateEndMarker(uint64_t frame_number)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessStateEndMarker(frame_number);
     }
@@ -56,7 +56,7 @@ void VulkanDecoderBase::DispatchStateEndMarker(uint64_t frame_number)
 
 void VulkanDecoderBase::DispatchFrameEndMarker(uint64_t frame_number)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessFrameEndMarker(frame_number);
     }
@@ -66,7 +66,7 @@ void VulkanDecoderBase::DispatchDisplayMessageCommand(format::ThreadId thread_id
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessDisplayMessageCommand(message);
     }
@@ -77,15 +77,30 @@ void VulkanDecoderBase::DispatchFillMemoryCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessFillMemoryCommand(memory_id, offset, size, data);
     }
 }
 
+void VulkanDecoderBase::DispatchFillMemoryDeltaCommand(format::ThreadId                   thread_id,
+                                                       uint64_t                           memory_id,
+                                                       uint64_t                           offset,
+                                                       uint64_t                           span_count,
+                                                       const format::FillMemoryDeltaSpan* spans,
+                                                       const uint8_t*                     data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
+    {
+        consumer->ProcessFillMemoryDeltaCommand(memory_id, offset, span_count, spans, data);
+    }
+}
+
 void VulkanDecoderBase::DispatchExeFileInfo(format::ThreadId thread_id, format::ExeFileInfoBlock& info)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->Process_ExeFileInfo(info.info_record);
     }
@@ -94,7 +109,7 @@ void VulkanDecoderBase::DispatchExeFileInfo(format::ThreadId thread_id, format::
 void VulkanDecoderBase::DispatchFillMemoryResourceValueCommand(
     const format::FillMemoryResourceValueCommandHeader& command_header, const uint8_t* data)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessFillMemoryResourceValueCommand(command_header, data);
     }
@@ -107,7 +122,7 @@ void VulkanDecoderBase::DispatchResizeWindowCommand(format::ThreadId thread_id,
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessResizeWindowCommand(surface_id, width, height);
     }
@@ -118,7 +133,7 @@ void VulkanDecoderBase::DispatchResizeWindowCommand2(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessResizeWindowCommand2(surface_id, width, height, pre_transform);
     }
@@ -138,7 +153,7 @@ void VulkanDecoderBase::DispatchCreateHardwareBufferCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessCreateHardwareBufferCommand(
             memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
@@ -149,7 +164,7 @@ void VulkanDecoderBase::DispatchDestroyHardwareBufferCommand(format::ThreadId th
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessDestroyHardwareBufferCommand(buffer_id);
     }
@@ -161,7 +176,7 @@ void VulkanDecoderBase::DispatchCreateHeapAllocationCommand(format::ThreadId thr
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessCreateHeapAllocationCommand(allocation_id, allocation_size);
     }
@@ -179,7 +194,7 @@ void VulkanDecoderBase::DispatchSetDevicePropertiesCommand(format::ThreadId   th
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessSetDevicePropertiesCommand(physical_device_id,
                                                     api_version,
@@ -200,7 +215,7 @@ void VulkanDecoderBase::DispatchSetDeviceMemoryPropertiesCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessSetDeviceMemoryPropertiesCommand(physical_device_id, memory_types, memory_heaps);
     }
@@ -213,7 +228,7 @@ void VulkanDecoderBase::DispatchSetOpaqueAddressCommand(format::ThreadId thread_
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessSetOpaqueAddressCommand(device_id, object_id, address);
     }
@@ -227,7 +242,7 @@ void VulkanDecoderBase::DispatchSetRayTracingShaderGroupHandlesCommand(format::T
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessSetRayTracingShaderGroupHandlesCommand(device_id, pipeline_id, data_size, data);
     }
@@ -242,7 +257,7 @@ void VulkanDecoderBase::DispatchSetSwapchainImageStateCommand(
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessSetSwapchainImageStateCommand(device_id, swapchain_id, last_presented_image, image_state);
     }
@@ -255,7 +270,7 @@ void VulkanDecoderBase::DispatchBeginResourceInitCommand(format::ThreadId thread
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessBeginResourceInitCommand(device_id, max_resource_size, max_copy_size);
     }
@@ -265,7 +280,7 @@ void VulkanDecoderBase::DispatchEndResourceInitCommand(format::ThreadId thread_i
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessEndResourceInitCommand(device_id);
     }
@@ -279,7 +294,7 @@ void VulkanDecoderBase::DispatchInitBufferCommand(format::ThreadId thread_id,
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessInitBufferCommand(device_id, buffer_id, data_size, data);
     }
@@ -296,7 +311,7 @@ void VulkanDecoderBase::DispatchInitImageCommand(format::ThreadId             th
 {
     GFXRECON_UNREFERENCED_PARAMETER(thread_id);
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessInitImageCommand(device_id, image_id, data_size, aspect, layout, level_sizes, data);
     }
@@ -308,7 +323,7 @@ void VulkanDecoderBase::DispatchInitImageCommand(format::ThreadId             th
 void VulkanDecoderBase::DispatchInitSubresourceCommand(const format::InitSubresourceCommandHeader& command_header,
                                                        const uint8_t*                              data)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessInitSubresourceCommand(command_header, data);
     }
@@ -333,7 +348,7 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplate(const ApiCall
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers())
     {
         consumer->Process_vkUpdateDescriptorSetWithTemplate(
             call_info, device, descriptorSet, descriptorUpdateTemplate, &pData);
@@ -363,7 +378,7 @@ size_t VulkanDecoderBase::Decode_vkCmdPushDescriptorSetWithTemplateKHR(const Api
     bytes_read += ValueDecoder::DecodeUInt32Value((parameter_buffer + bytes_read), (buffer_size - bytes_read), &set);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdPushDescriptorSetWithTemplateKHR(
             call_info, commandBuffer, descriptorUpdateTemplate, layout, set, &pData);
@@ -388,7 +403,7 @@ size_t VulkanDecoderBase::Decode_vkCmdPushDescriptorSetWithTemplate2KHR(const Ap
     bytes_read += pPushDescriptorSetWithTemplateInfo.GetMetaStructPointer()->pData.Decode(
         (parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers())
     {
         consumer->Process_vkCmdPushDescriptorSetWithTemplate2KHR(
             call_info, commandBuffer, &pPushDescriptorSetWithTemplateInfo);
@@ -416,7 +431,7 @@ size_t VulkanDecoderBase::Decode_vkUpdateDescriptorSetWithTemplateKHR(const ApiC
         (parameter_buffer + bytes_read), (buffer_size - bytes_read), &descriptorUpdateTemplate);
     bytes_read += pData.Decode((parameter_buffer + bytes_read), (buffer_size - bytes_read));
 
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers())
     {
         consumer->Process_vkUpdateDescriptorSetWithTemplateKHR(
             call_info, device, descriptorSet, descriptorUpdateTemplate, &pData);
@@ -545,7 +560,7 @@ void VulkanDecoderBase::DecodeFunctionCall(format::ApiCallId  call_id,
 void VulkanDecoderBase::DispatchSetTlasToBlasDependencyCommand(format::HandleId                     tlas,
                                                                const std::vector<format::HandleId>& blases)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->ProcessSetTlasToBlasRelationCommand(tlas, blases);
     }
@@ -553,11 +568,34 @@ void VulkanDecoderBase::DispatchSetTlasToBlasDependencyCommand(format::HandleId
 
 void VulkanDecoderBase::SetCurrentBlockIndex(uint64_t block_index)
 {
-    for (auto consumer : consumers_)
+    for (auto consumer : GetConsumers(graphics::ReplayCostTracker::kConsumer))
     {
         consumer->SetCurrentBlockIndex(block_index);
     }
 }
 
+graphics::ReplayCostTracker::Category VulkanDecoderBase::GetConsumerCostCategory(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkQueueWaitIdle:
+        case format::ApiCallId::ApiCall_vkDeviceWaitIdle:
+        case format::ApiCallId::ApiCall_vkWaitForFences:
+        case format::ApiCallId::ApiCall_vkWaitSemaphores:
+        case format::ApiCallId::ApiCall_vkWaitSemaphoresKHR:
+        case format::ApiCallId::ApiCall_vkWaitForPresentKHR:
+        case format::ApiCallId::ApiCall_vkAcquireNextImageKHR:
+        case format::ApiCallId::ApiCall_vkAcquireNextImage2KHR:
+        case format::ApiCallId::ApiCall_vkQueuePresentKHR:
+        // Replay waits for these queries to complete when they completed during capture.
+        case format::ApiCallId::ApiCall_vkGetFenceStatus:
+        case format::ApiCallId::ApiCall_vkGetEventStatus:
+        case format::ApiCallId::ApiCall_vkGetQueryPoolResults:
+            return graphics::ReplayCostTracker::kWait;
+        default:
+            return graphics::ReplayCostTracker::kConsumer;
+    }
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -29,6 +29,7 @@
 #include "format/format.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_consumer.h"
+#include "graphics/replay_cost_tracker.h"
 #include "util/defines.h"
 #include "decoder_util.h"
 
@@ -48,30 +49,46 @@ class VulkanDecoderBase : public ApiDecoder
 
     virtual ~VulkanDecoderBase() override {}
 
-    void AddConsumer(VulkanConsumer* consumer) { consumers_.push_back(consumer); }
+    void AddConsumer(VulkanConsumer* consumer)
+    {
+        consumers_.push_back(consumer);
+        call_filter_.Update(consumers_);
+    }
 
     void RemoveConsumer(VulkanConsumer* consumer)
     {
         consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer));
+        call_filter_.Update(consumers_);
     }
 
     virtual void WaitIdle() override;
 
     virtual bool IsComplete(uint64_t block_index) override
     {
-        return decode::IsComplete<VulkanConsumer*>(consumers_, block_index);
+        size_t consumer_count = consumers_.size();
+        bool   complete       = decode::IsComplete<VulkanConsumer*>(consumers_, block_index);
+
+        // Calls that were only processed by the completed consumers no longer need to be decoded.
+        if (consumers_.size() != consumer_count)
+        {
+            call_filter_.Update(consumers_);
+        }
+
+        return complete;
     }
 
     virtual bool SupportsApiCall(format::ApiCallId call_id) override
     {
-        return (format::GetApiCallFamily(call_id) == format::ApiFamilyId::ApiFamily_Vulkan);
+        return (format::GetApiCallFamily(call_id) == format::ApiFamilyId::ApiFamily_Vulkan) &&
+               call_filter_.AcceptsApiCall(call_id);
     }
 
     virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override
     {
         // For backwards compatibility, an encoded API of ApiFamily_None indicates the Vulkan API.
         format::ApiFamilyId api = format::GetMetaDataApi(meta_data_id);
-        return (api == format::ApiFamilyId::ApiFamily_None) || (api == format::ApiFamilyId::ApiFamily_Vulkan);
+        return ((api == format::ApiFamilyId::ApiFamily_None) || (api == format::ApiFamilyId::ApiFamily_Vulkan)) &&
+               call_filter_.AcceptsMetaDataType(format::GetMetaDataType(meta_data_id));
     }
 
     virtual void DecodeFunctionCall(format::ApiCallId  call_id,
@@ -90,6 +107,13 @@ class VulkanDecoderBase : public ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual void DispatchFillMemoryDeltaCommand(format::ThreadId                   thread_id,
+                                                uint64_t                           memory_id,
+                                                uint64_t                           offset,
+                                                uint64_t                           span_count,
+                                                const format::FillMemoryDeltaSpan* spans,
+                                                const uint8_t*                     data) override;
+
     virtual void
     DispatchFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
                                            const uint8_t*                                      data) override;
@@ -197,8 +221,50 @@ class VulkanDecoderBase : public ApiDecoder
 
     virtual void SetCurrentBlockIndex(uint64_t block_index) override;
 
+    virtual void SetCurrentApiCallId(format::ApiCallId api_call_id) override { current_api_call_id_ = api_call_id; }
+
+    // Attributes the time spent in consumer calls to the consumer replay stage, or to the wait replay stage for API
+    // calls that wait for the device.
+    void SetCostTracker(graphics::ReplayCostTracker* cost_tracker) { cost_tracker_ = cost_tracker; }
+
   protected:
-    const std::vector<VulkanConsumer*>& GetConsumers() const { return consumers_; }
+    // Consumer list for the decode functions.  The time spent in the consumer calls made while iterating over the list
+    // is attributed to the replay stage of the current API call.
+    class ConsumerRange
+    {
+      public:
+        ConsumerRange(const std::vector<VulkanConsumer*>&   consumers,
+                      graphics::ReplayCostTracker*          cost_tracker,
+                      graphics::ReplayCostTracker::Category category) :
+            consumers_(consumers),
+            cost_scope_(cost_tracker, category)
+        {}
+
+        std::vector<VulkanConsumer*>::const_iterator begin() const { return consumers_.begin(); }
+
+        std::vector<VulkanConsumer*>::const_iterator end() const { return consumers_.end(); }
+
+      private:
+        const std::vector<VulkanConsumer*>& consumers_;
+        graphics::ReplayCostTracker::Scope  cost_scope_;
+    };
+
+    ConsumerRange GetConsumers() const
+    {
+        return ConsumerRange(consumers_,
+                             cost_tracker_,
+                             (cost_tracker_ != nullptr) ? GetConsumerCostCategory(current_api_call_id_)
+                                                        : graphics::ReplayCostTracker::kConsumer);
+    }
+
+    // Consumer list for the meta-data dispatch functions, which are not associated with the current API call.  The time
+    // spent in the consumer calls is attributed to the specified replay stage.
+    ConsumerRange GetConsumers(graphics::ReplayCostTracker::Category category) const
+    {
+        return ConsumerRange(consumers_, cost_tracker_, category);
+    }
+
+    static graphics::ReplayCostTracker::Category GetConsumerCostCategory(format::ApiCallId call_id);
 
   private:
     size_t Decode_vkUpdateDescriptorSetWithTemplate(const ApiCallInfo& call_info,
@@ -227,6 +293,9 @@ class VulkanDecoderBase : public ApiDecoder
 
   private:
     std::vector<VulkanConsumer*> consumers_;
+    ConsumerCallFilter           call_filter_;
+    format::ApiCallId            current_api_call_id_{ format::ApiCallId::ApiCall_Unknown };
+    graphics::ReplayCostTracker* cost_tracker_{ nullptr };
 
     struct DeferredOperationFunctionCallData
     {
@@ -418,7 +418,7 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
 
             size_t copy_size = static_cast<size_t>(size);
 
-            util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            util::platform::MappedMemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
 
             result = VK_SUCCESS;
         }
@@ -57,6 +57,17 @@ class VulkanDetectionConsumer : public VulkanConsumer
         return ((block_limit_ != kNoBlockLimit) && (block_index > block_limit_)) || WasVulkanAPIDetected();
     }
 
+    virtual bool GetProcessedApiCalls(std::unordered_set<format::ApiCallId>* api_calls) const override
+    {
+        api_calls->insert(format::ApiCallId::ApiCall_vkCreateDevice);
+        return true;
+    }
+
+    virtual bool GetProcessedMetaDataTypes(std::unordered_set<format::MetaDataType>* meta_data_types) const override
+    {
+        return true;
+    }
+
   private:
     const uint64_t block_limit_;
     bool           vulkan_consumer_usage_;
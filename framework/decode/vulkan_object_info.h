@@ -224,6 +224,9 @@ struct InstanceInfo : public VulkanObjectInfo<VkInstance>
     std::vector<VkPhysicalDevice> replay_devices;
 
     std::unordered_map<VkPhysicalDevice, ReplayDeviceInfo> replay_device_info;
+
+    // Dispatch table cached on first use by the replay consumer.
+    mutable const encode::VulkanInstanceTable* instance_table{ nullptr };
 };
 
 struct PhysicalDeviceInfo : public VulkanObjectInfo<VkPhysicalDevice>
@@ -245,6 +248,9 @@ struct PhysicalDeviceInfo : public VulkanObjectInfo<VkPhysicalDevice>
 
     // Closest matching replay device.
     ReplayDeviceInfo* replay_device_info{ nullptr };
+
+    // Dispatch table cached on first use by the replay consumer.
+    mutable const encode::VulkanInstanceTable* instance_table{ nullptr };
 };
 
 struct DeviceInfo : public VulkanObjectInfo<VkDevice>
@@ -269,6 +275,9 @@ struct DeviceInfo : public VulkanObjectInfo<VkDevice>
     std::vector<bool>                                      queue_family_index_enabled;
 
     std::vector<VkPhysicalDevice> replay_device_group;
+
+    // Dispatch table cached on first use by the replay consumer.
+    mutable const encode::VulkanDeviceTable* device_table{ nullptr };
 };
 
 struct QueueInfo : public VulkanObjectInfo<VkQueue>
@@ -276,6 +285,9 @@ struct QueueInfo : public VulkanObjectInfo<VkQueue>
     std::unordered_map<uint32_t, size_t> array_counts;
     uint32_t                             family_index;
     uint32_t                             queue_index;
+
+    // Dispatch table cached on first use by the replay consumer.
+    mutable const encode::VulkanDeviceTable* device_table{ nullptr };
 };
 
 struct SemaphoreInfo : public VulkanObjectInfo<VkSemaphore>
@@ -549,6 +561,9 @@ struct CommandBufferInfo : public VulkanPoolObjectInfo<VkCommandBuffer>
     bool                                                is_frame_boundary{ false };
     std::vector<format::HandleId>                       frame_buffer_ids;
     std::unordered_map<format::HandleId, VkImageLayout> image_layout_barriers;
+
+    // Dispatch table cached on first use by the replay consumer.
+    mutable const encode::VulkanDeviceTable* device_table{ nullptr };
 };
 
 struct RenderPassInfo : public VulkanObjectInfo<VkRenderPass>
@@ -275,6 +275,7 @@ void VulkanRebindAllocator::DestroyBuffer(VkBuffer                     buffer,
         if (memory_alloc_info != nullptr)
         {
             memory_alloc_info->original_buffers.erase(buffer);
+            memory_alloc_info->bound_resources.Remove(resource_alloc_info->original_offset, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -338,6 +339,7 @@ void VulkanRebindAllocator::DestroyImage(VkImage                      image,
         if (memory_alloc_info != nullptr)
         {
             memory_alloc_info->original_images.erase(image);
+            memory_alloc_info->bound_resources.Remove(resource_alloc_info->original_offset, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -508,16 +510,14 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer
                 }
 
                 memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                memory_alloc_info->bound_resources.Insert(
+                    resource_alloc_info->original_offset, resource_alloc_info->size, resource_alloc_info);
 
                 if (memory_alloc_info->original_content != nullptr)
                 {
                     // Memory has been mapped and written prior to bind.  Copy the original content to the new
                     // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
+                    WriteOriginalContent(resource_alloc_info);
                 }
 
                 (*bind_memory_properties) = property_flags;
@@ -597,14 +597,12 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                         {
                             // Memory has been mapped and written prior to bind.  Copy the original content to the new
                             // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
+                            WriteOriginalContent(resource_alloc_info);
                         }
 
                         memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                        memory_alloc_info->bound_resources.Insert(
+                            resource_alloc_info->original_offset, resource_alloc_info->size, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -676,16 +674,14 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage
                 }
 
                 memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                memory_alloc_info->bound_resources.Insert(
+                    resource_alloc_info->original_offset, resource_alloc_info->size, resource_alloc_info);
 
                 if (memory_alloc_info->original_content != nullptr)
                 {
                     // Memory has been mapped and written prior to bind.  Copy the original content to the new
                     // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
+                    WriteOriginalContent(resource_alloc_info);
                 }
 
                 (*bind_memory_properties) = property_flags;
@@ -766,14 +762,12 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                         {
                             // Memory has been mapped and written prior to bind.  Copy the original content to the new
                             // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
+                            WriteOriginalContent(resource_alloc_info);
                         }
 
                         memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                        memory_alloc_info->bound_resources.Insert(
+                            resource_alloc_info->original_offset, resource_alloc_info->size, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -851,33 +845,25 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
         {
             if (memory_alloc_info->original_content == nullptr)
             {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_alloc_info->allocation_size);
-                size_t allocation_size = static_cast<size_t>(memory_alloc_info->allocation_size);
-
-                memory_alloc_info->original_content = std::make_unique<uint8_t[]>(allocation_size);
+                // Only the pages of the reconstructed memory that are written are allocated.
+                memory_alloc_info->original_content =
+                    std::make_unique<ShadowMemory>(memory_alloc_info->allocation_size);
             }
 
             // Update the reconstructed memory, which is written to memory allocations created at resource bind to
             // ensure they contain the correct data.
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
-            size_t   copy_size = static_cast<size_t>(size);
-            uint8_t* copy_dst  = memory_alloc_info->original_content.get() + memory_alloc_info->mapped_offset + offset;
-
-            util::platform::MemoryCopy(copy_dst, copy_size, data, copy_size);
+            memory_alloc_info->original_content->Write(
+                memory_alloc_info->mapped_offset + offset, data, static_cast<size_t>(size));
 
             VkDeviceSize write_start = memory_alloc_info->mapped_offset + offset;
             VkDeviceSize write_end   = write_start + size;
 
             // Copy to the resources that were bound to this range at capture.
-            for (const auto& entry : memory_alloc_info->original_buffers)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
-
-            for (const auto& entry : memory_alloc_info->original_images)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
+            memory_alloc_info->bound_resources.ForEachOverlap(
+                write_start, write_end, [&](ResourceAllocInfo* resource_alloc_info) {
+                    UpdateBoundResource(resource_alloc_info, write_start, write_end, data);
+                });
 
             result = VK_SUCCESS;
         }
@@ -944,10 +930,10 @@ void VulkanRebindAllocator::WriteBoundResourceDirect(
 {
     if (!resource_alloc_info->is_image)
     {
-        util::platform::MemoryCopy(static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset,
-                                   data_size,
-                                   data + src_offset,
-                                   data_size);
+        util::platform::MappedMemoryCopy(static_cast<uint8_t*>(resource_alloc_info->mapped_pointer) + dst_offset,
+                                         data_size,
+                                         data + src_offset,
+                                         data_size);
     }
     else
     {
@@ -1235,6 +1221,40 @@ void VulkanRebindAllocator::UpdateBoundResource(ResourceAllocInfo* resource_allo
     }
 }
 
+void VulkanRebindAllocator::WriteOriginalContent(ResourceAllocInfo* resource_alloc_info)
+{
+    assert((resource_alloc_info != nullptr) && (resource_alloc_info->memory_info != nullptr));
+
+    const ShadowMemory* original_content = resource_alloc_info->memory_info->original_content.get();
+    const VkDeviceSize  resource_start   = resource_alloc_info->original_offset;
+
+    if ((original_content == nullptr) || !original_content->IsWritten(resource_start, resource_alloc_info->size))
+    {
+        return;
+    }
+
+    if (resource_alloc_info->is_image)
+    {
+        // Image writes through a staging buffer must start at the beginning of the image, so the image is written in
+        // a single copy, with zeros for the pages that were not written.
+        const VkDeviceSize available = original_content->GetSize() - resource_start;
+        const VkDeviceSize data_size = (available < resource_alloc_info->size) ? available : resource_alloc_info->size;
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+        std::vector<uint8_t> data(static_cast<size_t>(data_size));
+        original_content->Read(resource_start, data.size(), data.data());
+
+        WriteBoundResource(resource_alloc_info, 0, 0, data_size, data.data());
+    }
+    else
+    {
+        original_content->ForEachWrittenRange(
+            resource_start, resource_alloc_info->size, [&](uint64_t offset, const uint8_t* data, size_t size) {
+                UpdateBoundResource(resource_alloc_info, offset, offset + size, data);
+            });
+    }
+}
+
 VkResult VulkanRebindAllocator::UpdateMappedMemoryRange(
     ResourceAllocInfo* resource_alloc_info,
     VkDeviceSize       oiriginal_start,
@@ -1290,21 +1310,14 @@ VkResult VulkanRebindAllocator::UpdateMappedMemoryRanges(
                 VkDeviceSize range_start = memory_ranges[i].offset;
                 VkDeviceSize range_end   = range_start + size;
 
-                for (const auto& entry : memory_alloc_info->original_buffers)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
-
-                for (const auto& entry : memory_alloc_info->original_images)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
+                memory_alloc_info->bound_resources.ForEachOverlap(
+                    range_start, range_end, [&](ResourceAllocInfo* resource_alloc_info) {
+                        if (UpdateMappedMemoryRange(resource_alloc_info, range_start, range_end, update_func) !=
+                            VK_SUCCESS)
+                        {
+                            result = VK_ERROR_MEMORY_MAP_FAILED;
+                        }
+                    });
             }
         }
     }
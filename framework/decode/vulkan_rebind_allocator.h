@@ -23,6 +23,8 @@
 #ifndef GFXRECON_DECODE_VULKAN_REBIND_ALLOCATOR_H
 #define GFXRECON_DECODE_VULKAN_REBIND_ALLOCATOR_H
 
+#include "decode/memory_range_index.h"
+#include "decode/shadow_memory.h"
 #include "decode/vulkan_resource_allocator.h"
 #include "util/defines.h"
 
@@ -319,9 +321,12 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         uint32_t                                         original_index{ std::numeric_limits<uint32_t>::max() };
         bool                                             is_mapped{ false };
         VkDeviceSize                                     mapped_offset{ 0 };
-        std::unique_ptr<uint8_t[]>                       original_content;
+        std::unique_ptr<ShadowMemory>                    original_content;
         std::unordered_map<VkBuffer, ResourceAllocInfo*> original_buffers;
         std::unordered_map<VkImage, ResourceAllocInfo*>  original_images;
+
+        // Buffers and images by the range of the original memory they were bound to at capture.
+        MemoryRangeIndex<ResourceAllocInfo*> bound_resources;
     };
 
   private:
@@ -359,6 +364,9 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
                              VkDeviceSize       write_end,
                              const uint8_t*     data);
 
+    // Copies the content that was written to the original memory range of a resource before it was bound.
+    void WriteOriginalContent(ResourceAllocInfo* resource_alloc_info);
+
     VkResult UpdateMappedMemoryRange(ResourceAllocInfo* resource_alloc_info,
                                      VkDeviceSize       oiriginal_start,
                                      VkDeviceSize       original_end,
@@ -383,6 +383,39 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
     }
 }
 
+void VulkanReplayConsumerBase::ProcessFillMemoryDeltaCommand(uint64_t                           memory_id,
+                                                             uint64_t                           offset,
+                                                             uint64_t                           span_count,
+                                                             const format::FillMemoryDeltaSpan* spans,
+                                                             const uint8_t*                     data)
+{
+    const DeviceMemoryInfo* memory_info = object_info_table_.GetDeviceMemoryInfo(memory_id);
+
+    if ((memory_info == nullptr) || (memory_info->allocator == nullptr))
+    {
+        // Hardware buffer memory and missing objects are handled, and reported, by the per-span fill memory commands.
+        VulkanConsumer::ProcessFillMemoryDeltaCommand(memory_id, offset, span_count, spans, data);
+        return;
+    }
+
+    // Look up the memory object once and write each changed span to the mapped memory.
+    auto     allocator = memory_info->allocator;
+    VkResult result    = VK_SUCCESS;
+
+    for (uint64_t i = 0; (i < span_count) && (result == VK_SUCCESS); ++i)
+    {
+        result = allocator->WriteMappedMemoryRange(
+            memory_info->allocator_data, offset + spans[i].offset, spans[i].size, data);
+        data += spans[i].size;
+    }
+
+    if (result == VK_ERROR_MEMORY_MAP_FAILED)
+    {
+        GFXRECON_LOG_WARNING("Skipping memory fill for VkDeviceMemory object (ID = %" PRIu64 ") that is not mapped",
+                             memory_id);
+    }
+}
+
 void VulkanReplayConsumerBase::ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height)
 {
     // We need to find the surface associated with this ID, and then lookup its window.
@@ -742,6 +775,8 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
                                                                uint64_t         max_resource_size,
                                                                uint64_t         max_copy_size)
 {
+    graphics::ReplayCostTracker::Scope cost_scope(GetCostTracker(), graphics::ReplayCostTracker::kResourceInit);
+
     GFXRECON_UNREFERENCED_PARAMETER(max_resource_size);
 
     DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
@@ -787,10 +822,22 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
 
 void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId device_id)
 {
+    graphics::ReplayCostTracker::Scope cost_scope(GetCostTracker(), graphics::ReplayCostTracker::kResourceInit);
+
     DeviceInfo* device_info = object_info_table_.GetDeviceInfo(device_id);
 
     if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
     {
+        VkResult result = device_info->resource_initializer->SubmitPendingCommands();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("State snapshot resource initialization commands failed for VkDevice object (ID = "
+                                 "%" PRIu64 ", handle = 0x%" PRIx64 ")",
+                                 device_id,
+                                 device_info->handle);
+        }
+
         device_info->resource_initializer.reset();
     }
 }
@@ -800,6 +847,8 @@ void VulkanReplayConsumerBase::ProcessInitBufferCommand(format::HandleId device_
                                                         uint64_t         data_size,
                                                         const uint8_t*   data)
 {
+    graphics::ReplayCostTracker::Scope cost_scope(GetCostTracker(), graphics::ReplayCostTracker::kResourceInit);
+
     DeviceInfo*       device_info = object_info_table_.GetDeviceInfo(device_id);
     const BufferInfo* buffer_info = object_info_table_.GetBufferInfo(buffer_id);
 
@@ -877,6 +926,8 @@ void VulkanReplayConsumerBase::ProcessInitImageCommand(format::HandleId
                                                        const std::vector<uint64_t>& level_sizes,
                                                        const uint8_t*               data)
 {
+    graphics::ReplayCostTracker::Scope cost_scope(GetCostTracker(), graphics::ReplayCostTracker::kResourceInit);
+
     DeviceInfo*      device_info = object_info_table_.GetDeviceInfo(device_id);
     const ImageInfo* image_info  = object_info_table_.GetImageInfo(image_id);
 
@@ -83,6 +83,11 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
 
+    graphics::ReplayCostTracker* GetCostTracker() const
+    {
+        return (fps_info_ != nullptr) ? fps_info_->GetCostTracker() : nullptr;
+    }
+
     virtual void WaitDevicesIdle() override;
 
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
@@ -94,6 +99,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     virtual void
     ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual void ProcessFillMemoryDeltaCommand(uint64_t                           memory_id,
+                                               uint64_t                           offset,
+                                               uint64_t                           span_count,
+                                               const format::FillMemoryDeltaSpan* spans,
+                                               const uint8_t*                     data) override;
+
     virtual void ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height) override;
 
     virtual void ProcessResizeWindowCommand2(format::HandleId surface_id,
@@ -218,6 +229,27 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     const encode::VulkanDeviceTable* GetDeviceTable(const void* handle) const;
 
+    // The dispatch table for a dispatchable object is looked up once and cached with the object's info, so that API
+    // calls do not require a dispatch table lookup.
+    const encode::VulkanInstanceTable* GetInstanceTable(const InstanceInfo* info) const
+    {
+        return GetCachedInstanceTable(info);
+    }
+
+    const encode::VulkanInstanceTable* GetInstanceTable(const PhysicalDeviceInfo* info) const
+    {
+        return GetCachedInstanceTable(info);
+    }
+
+    const encode::VulkanDeviceTable* GetDeviceTable(const DeviceInfo* info) const { return GetCachedDeviceTable(info); }
+
+    const encode::VulkanDeviceTable* GetDeviceTable(const QueueInfo* info) const { return GetCachedDeviceTable(info); }
+
+    const encode::VulkanDeviceTable* GetDeviceTable(const CommandBufferInfo* info) const
+    {
+        return GetCachedDeviceTable(info);
+    }
+
     void* PreProcessExternalObject(uint64_t object_id, format::ApiCallId call_id, const char* call_name);
 
     void PostProcessExternalObject(
@@ -235,6 +267,24 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         return handle_mapping::MapHandle(id, object_info_table_, MapFunc);
     }
 
+    // Maps a handle ID with an object info that was already retrieved for the ID.
+    template <typename T>
+    typename T::HandleType MapHandle(format::HandleId id, const T* info) const
+    {
+        typename T::HandleType handle = VK_NULL_HANDLE;
+
+        if (info != nullptr)
+        {
+            handle = info->handle;
+        }
+        else if (id != format::kNullHandleId)
+        {
+            GFXRECON_LOG_WARNING("Failed to map handle for object id %" PRIu64, id);
+        }
+
+        return handle;
+    }
+
     uint64_t MapHandle(uint64_t object, VkObjectType object_type)
     {
         return handle_mapping::MapHandle(object, object_type, object_info_table_);
@@ -1139,6 +1189,32 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     PFN_vkCreateDevice GetCreateDeviceProc(VkPhysicalDevice physical_device);
 
+    template <typename T>
+    const encode::VulkanInstanceTable* GetCachedInstanceTable(const T* info) const
+    {
+        assert(info != nullptr);
+
+        if (info->instance_table == nullptr)
+        {
+            info->instance_table = GetInstanceTable(info->handle);
+        }
+
+        return info->instance_table;
+    }
+
+    template <typename T>
+    const encode::VulkanDeviceTable* GetCachedDeviceTable(const T* info) const
+    {
+        assert(info != nullptr);
+
+        if (info->device_table == nullptr)
+        {
+            info->device_table = GetDeviceTable(info->handle);
+        }
+
+        return info->device_table;
+    }
+
     void SetInstancePhysicalDeviceEntries(InstanceInfo*           instance_info,
                                           size_t                  capture_device_count,
                                           const format::HandleId* capture_devices,
@@ -48,7 +48,7 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                                              VulkanObjectInfoTable&     object_info_table) :
     QueueSubmit_indices_(options.QueueSubmit_Indices),
     recording_(false), dump_resources_before_(options.dump_resources_before), object_info_table_(object_info_table),
-    output_json_per_command(options.dump_resources_json_per_command), dump_json_(options)
+    output_json_per_command(options.dump_resources_json_per_command), dump_json_(options, file_writer_)
 {
     capture_filename = std::filesystem::path(options.capture_filename).stem().string();
 
@@ -76,6 +76,7 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                                                object_info_table,
                                                                options,
                                                                dump_json_,
+                                                               file_writer_,
                                                                capture_filename));
         }
 
@@ -93,6 +94,7 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                               object_info_table_,
                                               options,
                                               dump_json_,
+                                              file_writer_,
                                               capture_filename));
         }
     }
@@ -105,6 +107,7 @@ VulkanReplayDumpResourcesBase::~VulkanReplayDumpResourcesBase()
 
 void VulkanReplayDumpResourcesBase::Release()
 {
+    file_writer_.Flush();
     dump_json_.Close();
     draw_call_contexts.clear();
     dispatch_ray_contexts.clear();
@@ -342,6 +342,7 @@ class VulkanReplayDumpResourcesBase
     bool                          recording_;
     bool                          dump_resources_before_;
     VulkanObjectInfoTable&        object_info_table_;
+    DumpResourcesFileWriter       file_writer_;
     VulkanReplayDumpResourcesJson dump_json_;
     bool                          output_json_per_command;
 
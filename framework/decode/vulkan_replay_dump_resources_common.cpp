@@ -24,12 +24,19 @@
 #include "util/logging.h"
 #include "util/image_writer.h"
 #include "util/buffer_writer.h"
+#include "util/file_path.h"
+#include "util/hash.h"
 #include "generated/generated_vulkan_enum_to_string.h"
 #include "graphics/vulkan_resources_util.h"
 #include "vulkan/vulkan_core.h"
 #include "Vulkan-Utility-Libraries/vk_format_utils.h"
 
 #include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -438,6 +445,314 @@ uint32_t FindGreatestVertexIndex(const std::vector<uint8_t>& index_data,
     }
 }
 
+static uint64_t CombineHash(uint64_t hash, uint64_t value)
+{
+    return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+}
+
+void DumpResourcesFileWriter::WriteBuffer(const std::string& filename, std::vector<uint8_t>&& data)
+{
+    auto shared_data = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+    WriteBuffer(filename, shared_data, 0, shared_data->size());
+}
+
+void DumpResourcesFileWriter::WriteBuffer(const std::string&                          filename,
+                                          std::shared_ptr<const std::vector<uint8_t>> data,
+                                          size_t                                      offset,
+                                          size_t                                      size)
+{
+    assert(data != nullptr);
+    assert((offset + size) <= data->size());
+
+    std::string write_filename;
+    if (IsDuplicate(filename, MakeFileContent(FileEncoding{}, data, offset, size), &write_filename))
+    {
+        return;
+    }
+
+    Submit(size, [write_filename, data, offset, size]() {
+        util::bufferwriter::WriteBuffer(write_filename, data->data() + offset, size);
+    });
+}
+
+void DumpResourcesFileWriter::WriteImage(const std::string&                          filename,
+                                         VkFormat                                    format,
+                                         util::imagewriter::DataFormats              output_image_format,
+                                         util::ScreenshotFormat                      image_file_format,
+                                         uint32_t                                    width,
+                                         uint32_t                                    height,
+                                         uint32_t                                    stride,
+                                         std::shared_ptr<const std::vector<uint8_t>> data,
+                                         size_t                                      offset,
+                                         size_t                                      size)
+{
+    assert(data != nullptr);
+    assert((offset + size) <= data->size());
+
+    FileEncoding encoding;
+    encoding.is_image            = true;
+    encoding.format              = format;
+    encoding.output_image_format = output_image_format;
+    encoding.image_file_format   = image_file_format;
+    encoding.width               = width;
+    encoding.height              = height;
+    encoding.stride              = stride;
+
+    std::string write_filename;
+    if (IsDuplicate(filename, MakeFileContent(encoding, data, offset, size), &write_filename))
+    {
+        return;
+    }
+
+    Submit(size, [write_filename, encoding, data, offset, size]() {
+        const uint8_t* image_data = data->data() + offset;
+
+        if (encoding.output_image_format == util::imagewriter::DataFormats::kFormat_ASTC)
+        {
+            VKU_FORMAT_INFO format_info = vkuGetFormatInfo(encoding.format);
+
+            util::imagewriter::WriteAstcImage(write_filename,
+                                              encoding.width,
+                                              encoding.height,
+                                              1,
+                                              format_info.block_extent.width,
+                                              format_info.block_extent.height,
+                                              format_info.block_extent.depth,
+                                              image_data,
+                                              size);
+        }
+        else if (encoding.image_file_format == util::ScreenshotFormat::kBmp)
+        {
+            util::imagewriter::WriteBmpImage(write_filename,
+                                             encoding.width,
+                                             encoding.height,
+                                             size,
+                                             image_data,
+                                             encoding.stride,
+                                             encoding.output_image_format);
+        }
+        else if (encoding.image_file_format == util::ScreenshotFormat::kPng)
+        {
+            util::imagewriter::WritePngImage(write_filename,
+                                             encoding.width,
+                                             encoding.height,
+                                             size,
+                                             image_data,
+                                             encoding.stride,
+                                             encoding.output_image_format);
+        }
+    });
+}
+
+void DumpResourcesFileWriter::Flush()
+{
+    for (auto& write : pending_writes_)
+    {
+        write.first.wait();
+    }
+
+    pending_writes_.clear();
+    pending_bytes_ = 0;
+}
+
+std::string DumpResourcesFileWriter::GetWrittenFilename(const std::string& filename) const
+{
+    auto entry = filename_aliases_.find(filename);
+    return (entry != filename_aliases_.end()) ? entry->second : filename;
+}
+
+bool DumpResourcesFileWriter::FileEncoding::operator==(const FileEncoding& other) const
+{
+    return (is_image == other.is_image) && (format == other.format) &&
+           (output_image_format == other.output_image_format) && (image_file_format == other.image_file_format) &&
+           (width == other.width) && (height == other.height) && (stride == other.stride);
+}
+
+DumpResourcesFileWriter::FileContent
+DumpResourcesFileWriter::MakeFileContent(const FileEncoding&                         encoding,
+                                         std::shared_ptr<const std::vector<uint8_t>> data,
+                                         size_t                                      offset,
+                                         size_t                                      size)
+{
+    // The encoding parameters seed the hash, so that the same data encoded differently has a different key.
+    uint64_t seed = 0;
+    if (encoding.is_image)
+    {
+        seed = CombineHash(seed, encoding.format);
+        seed = CombineHash(seed, encoding.output_image_format);
+        seed = CombineHash(seed, static_cast<uint64_t>(encoding.image_file_format));
+        seed = CombineHash(seed, encoding.width);
+        seed = CombineHash(seed, encoding.height);
+        seed = CombineHash(seed, encoding.stride);
+    }
+
+    FileContent content;
+    content.key      = ContentKey(size, util::hash::ContentHash64::Generate(data->data() + offset, size, seed));
+    content.encoding = encoding;
+    content.data     = std::move(data);
+    content.offset   = offset;
+
+    return content;
+}
+
+bool DumpResourcesFileWriter::IsDuplicate(const std::string& filename,
+                                          FileContent&&      content,
+                                          std::string*       write_filename)
+{
+    assert(write_filename != nullptr);
+
+    // Equal keys are only treated as duplicates when the retained data of the previous write is identical.
+    auto content_entry = content_files_.find(content.key);
+    if (content_entry != content_files_.end())
+    {
+        auto previous_entry = file_contents_.find(content_entry->second);
+        if (previous_entry != file_contents_.end())
+        {
+            const FileContent& previous = previous_entry->second;
+            const size_t       size     = content.key.first;
+
+            if ((previous.data != nullptr) && (previous.encoding == content.encoding) &&
+                ((size == 0) ||
+                 (memcmp(previous.data->data() + previous.offset, content.data->data() + content.offset, size) == 0)))
+            {
+                if (content_entry->second == filename)
+                {
+                    filename_aliases_.erase(filename);
+                }
+                else
+                {
+                    filename_aliases_[filename] = content_entry->second;
+                }
+
+                return true;
+            }
+        }
+    }
+
+    // When a file is written again, other files may still refer to its previous content.  The new content is then
+    // written to a file with a unique name, so that the file names that were already resolved remain valid.
+    *write_filename = filename;
+
+    if (file_contents_.find(filename) != file_contents_.end())
+    {
+        if (IsReferenced(filename))
+        {
+            *write_filename = util::filepath::InsertFilenamePostfix(filename, "_" + std::to_string(++next_content_id_));
+        }
+        else
+        {
+            ReleaseContent(filename);
+        }
+    }
+
+    if (*write_filename == filename)
+    {
+        filename_aliases_.erase(filename);
+    }
+    else
+    {
+        filename_aliases_[filename] = *write_filename;
+    }
+
+    RetainContent(*write_filename, std::move(content));
+
+    return false;
+}
+
+bool DumpResourcesFileWriter::IsReferenced(const std::string& filename) const
+{
+    for (const auto& alias : filename_aliases_)
+    {
+        if (alias.second == filename)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DumpResourcesFileWriter::ReleaseContent(const std::string& filename)
+{
+    auto file_entry = file_contents_.find(filename);
+    if (file_entry != file_contents_.end())
+    {
+        const FileContent& previous = file_entry->second;
+
+        auto content_entry = content_files_.find(previous.key);
+        if ((content_entry != content_files_.end()) && (content_entry->second == filename))
+        {
+            content_files_.erase(content_entry);
+        }
+
+        if (previous.data != nullptr)
+        {
+            retained_bytes_ -= previous.key.first;
+        }
+
+        file_contents_.erase(file_entry);
+    }
+}
+
+void DumpResourcesFileWriter::RetainContent(const std::string& filename, FileContent&& content)
+{
+    const size_t size = content.key.first;
+
+    content.id = ++next_content_id_;
+    retained_contents_.emplace_back(filename, content.id);
+    retained_bytes_ += size;
+
+    content_files_[content.key] = filename;
+    file_contents_[filename]    = std::move(content);
+
+    // Release the data of the oldest writes, which can then no longer be referenced by new writes.  The entries of
+    // files that were written again since the data was retained are stale, and only need to be removed.
+    while ((retained_bytes_ > kMaxRetainedBytes) && !retained_contents_.empty())
+    {
+        const auto& oldest     = retained_contents_.front();
+        auto        file_entry = file_contents_.find(oldest.first);
+
+        if ((file_entry != file_contents_.end()) && (file_entry->second.id == oldest.second) &&
+            (file_entry->second.data != nullptr))
+        {
+            FileContent& retained = file_entry->second;
+
+            auto content_entry = content_files_.find(retained.key);
+            if ((content_entry != content_files_.end()) && (content_entry->second == file_entry->first))
+            {
+                content_files_.erase(content_entry);
+            }
+
+            retained_bytes_ -= retained.key.first;
+            retained.data = nullptr;
+        }
+
+        retained_contents_.pop_front();
+    }
+}
+
+void DumpResourcesFileWriter::Submit(size_t size, std::function<void()> write)
+{
+    // Worker threads are only started when resources are actually dumped.
+    if (thread_pool_ == nullptr)
+    {
+        thread_pool_ = std::make_unique<util::ThreadPool>();
+    }
+
+    // Release completed writes, then wait for the oldest writes while too much data is pending.
+    while (!pending_writes_.empty() &&
+           ((pending_bytes_ > kMaxPendingBytes) ||
+            (pending_writes_.front().first.wait_for(std::chrono::seconds(0)) == std::future_status::ready)))
+    {
+        pending_writes_.front().first.wait();
+        pending_bytes_ -= pending_writes_.front().second;
+        pending_writes_.pop_front();
+    }
+
+    pending_writes_.emplace_back(thread_pool_->Submit(std::move(write)), size);
+    pending_bytes_ += size;
+}
+
 VkResult DumpImageToFile(const ImageInfo*                   image_info,
                          const DeviceInfo*                  device_info,
                          const encode::VulkanDeviceTable*   device_table,
@@ -447,6 +762,7 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
                          float                              scale,
                          std::vector<bool>&                 scaling_supported,
                          util::ScreenshotFormat             image_file_format,
+                         DumpResourcesFileWriter&           file_writer,
                          bool                               dump_all_subresources,
                          VkImageLayout                      layout,
                          const VkExtent3D*                  extent_p)
@@ -477,12 +793,21 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
                              (extent_p != nullptr) ? extent_p->height : image_info->extent.height,
                              (extent_p != nullptr) ? extent_p->depth : image_info->extent.depth };
 
+    const util::imagewriter::DataFormats output_image_format = VkFormatToImageWriterDataFormat(image_info->format);
+
+    if (output_image_format == util::imagewriter::DataFormats::kFormat_UNSPECIFIED)
+    {
+        GFXRECON_LOG_WARNING("%s format is not handled. Images with that format will be dump as a plain binary file.",
+                             util::ToString<VkFormat>(image_info->format).c_str());
+    }
+
     uint32_t f = 0;
     for (size_t i = 0; i < aspects.size(); ++i)
     {
         const VkImageAspectFlagBits aspect = aspects[i];
 
-        std::vector<uint8_t>  data;
+        // The data is shared by the pending writes of all subresources and released when the last write completes.
+        auto                  data = std::make_shared<std::vector<uint8_t>>();
         std::vector<uint64_t> subresource_offsets;
         std::vector<uint64_t> subresource_sizes;
         bool                  scaled;
@@ -499,7 +824,7 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
             (layout == VK_IMAGE_LAYOUT_MAX_ENUM) ? image_info->intermediate_layout : layout,
             image_info->queue_family_index,
             aspect,
-            data,
+            *data,
             subresource_offsets,
             subresource_sizes,
             scaled,
@@ -519,8 +844,6 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
             return res;
         }
 
-        const util::imagewriter::DataFormats output_image_format = VkFormatToImageWriterDataFormat(image_info->format);
-
         if ((image_info->level_count == 1 && image_info->layer_count == 1) || !dump_all_subresources)
         {
             std::string filename = filenames[f++];
@@ -546,49 +869,21 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
                 const uint32_t stride     = texel_size * scaled_extent.width;
 
                 filename += ImageFileExtension(image_info->format, image_file_format);
-                if (output_image_format == util::imagewriter::DataFormats::kFormat_ASTC)
-                {
-                    VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
-
-                    util::imagewriter::WriteAstcImage(filename,
-                                                      scaled_extent.width,
-                                                      scaled_extent.width,
-                                                      1,
-                                                      format_info.block_extent.width,
-                                                      format_info.block_extent.height,
-                                                      format_info.block_extent.depth,
-                                                      data.data(),
-                                                      subresource_sizes[0]);
-                }
-                else if (image_file_format == util::ScreenshotFormat::kBmp)
-                {
-                    util::imagewriter::WriteBmpImage(filename,
-                                                     scaled_extent.width,
-                                                     scaled_extent.height,
-                                                     subresource_sizes[0],
-                                                     data.data(),
-                                                     stride,
-                                                     output_image_format);
-                }
-                else if (image_file_format == util::ScreenshotFormat::kPng)
-                {
-                    util::imagewriter::WritePngImage(filename,
-                                                     scaled_extent.width,
-                                                     scaled_extent.height,
-                                                     subresource_sizes[0],
-                                                     data.data(),
-                                                     stride,
-                                                     output_image_format);
-                }
+                file_writer.WriteImage(filename,
+                                       image_info->format,
+                                       output_image_format,
+                                       image_file_format,
+                                       scaled_extent.width,
+                                       scaled_extent.height,
+                                       stride,
+                                       data,
+                                       0,
+                                       static_cast<size_t>(subresource_sizes[0]));
             }
             else
             {
-                GFXRECON_LOG_WARNING(
-                    "%s format is not handled. Images with that format will be dump as a plain binary file.",
-                    util::ToString<VkFormat>(image_info->format).c_str());
-
                 filename = filename + std::string(".bin");
-                util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+                file_writer.WriteBuffer(filename, data, 0, data->size());
             }
         }
         else
@@ -603,8 +898,8 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
                         continue;
 
                     const uint32_t sub_res_idx = mip * image_info->layer_count + layer;
-                    const void*    data_offset = reinterpret_cast<const void*>(
-                        reinterpret_cast<const uint8_t*>(data.data()) + subresource_offsets[sub_res_idx]);
+                    const size_t   data_offset = static_cast<size_t>(subresource_offsets[sub_res_idx]);
+                    const size_t   data_size   = static_cast<size_t>(subresource_sizes[sub_res_idx]);
 
                     if (output_image_format != util::imagewriter::DataFormats::kFormat_UNSPECIFIED)
                     {
@@ -628,48 +923,20 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
                         const uint32_t stride     = texel_size * scaled_extent.width;
 
                         filename += ImageFileExtension(image_info->format, image_file_format);
-                        if (output_image_format == util::imagewriter::DataFormats::kFormat_ASTC)
-                        {
-                            VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
-
-                            util::imagewriter::WriteAstcImage(filename,
-                                                              scaled_extent.width,
-                                                              scaled_extent.width,
-                                                              1,
-                                                              format_info.block_extent.width,
-                                                              format_info.block_extent.height,
-                                                              format_info.block_extent.depth,
-                                                              data.data(),
-                                                              subresource_sizes[sub_res_idx]);
-                        }
-                        else if (image_file_format == util::ScreenshotFormat::kBmp)
-                        {
-                            util::imagewriter::WriteBmpImage(filename,
-                                                             scaled_extent.width,
-                                                             scaled_extent.height,
-                                                             subresource_sizes[sub_res_idx],
-                                                             data_offset,
-                                                             stride,
-                                                             output_image_format);
-                        }
-                        else if (image_file_format == util::ScreenshotFormat::kPng)
-                        {
-                            util::imagewriter::WritePngImage(filename,
-                                                             scaled_extent.width,
-                                                             scaled_extent.height,
-                                                             subresource_sizes[sub_res_idx],
-                                                             data_offset,
-                                                             stride,
-                                                             output_image_format);
-                        }
+                        file_writer.WriteImage(filename,
+                                               image_info->format,
+                                               output_image_format,
+                                               image_file_format,
+                                               scaled_extent.width,
+                                               scaled_extent.height,
+                                               stride,
+                                               data,
+                                               data_offset,
+                                               data_size);
                     }
                     else
                     {
-                        GFXRECON_LOG_WARNING(
-                            "%s format is not handled. Images with that format will be dump as a plain binary file.",
-                            util::ToString<VkFormat>(image_info->format).c_str());
-
-                        util::bufferwriter::WriteBuffer(filename, data_offset, subresource_sizes[sub_res_idx]);
+                        file_writer.WriteBuffer(filename, data, data_offset, data_size);
                     }
                 }
             }
@@ -681,6 +948,54 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
     return VK_SUCCESS;
 }
 
+VkResult DumpBuffersToFiles(graphics::VulkanResourcesUtil&       resource_util,
+                            const std::vector<BufferFileRegion>& regions,
+                            DumpResourcesFileWriter&             file_writer)
+{
+    std::map<uint32_t, std::vector<const BufferFileRegion*>> queue_family_regions;
+    for (const auto& region : regions)
+    {
+        if (region.size > 0)
+        {
+            queue_family_regions[region.queue_family_index].push_back(&region);
+        }
+        else
+        {
+            file_writer.WriteBuffer(region.filename, std::vector<uint8_t>());
+        }
+    }
+
+    for (const auto& entry : queue_family_regions)
+    {
+        std::vector<graphics::VulkanResourcesUtil::BufferReadRegion> read_regions;
+        read_regions.reserve(entry.second.size());
+
+        for (const BufferFileRegion* region : entry.second)
+        {
+            read_regions.push_back({ region->buffer, region->size, region->offset });
+        }
+
+        auto     data = std::make_shared<std::vector<uint8_t>>();
+        VkResult res  = resource_util.ReadFromBufferResources(read_regions, entry.first, *data);
+        if (res != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Reading from buffer resources failed (%s).", util::ToString<VkResult>(res).c_str())
+            return res;
+        }
+
+        // The contents of the regions are stored consecutively, in the order of the read regions.
+        size_t data_offset = 0;
+        for (const BufferFileRegion* region : entry.second)
+        {
+            const size_t size = static_cast<size_t>(region->size);
+            file_writer.WriteBuffer(region->filename, data, data_offset, size);
+            data_offset += size;
+        }
+    }
+
+    return VK_SUCCESS;
+}
+
 bool CheckDescriptorCompatibility(VkDescriptorType desc_type_a, VkDescriptorType desc_type_b)
 {
     switch (desc_type_a)
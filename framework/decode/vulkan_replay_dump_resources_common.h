@@ -24,10 +24,24 @@
 #define GFXRECON_GENERATED_VULKAN_REPLAY_DUMP_RESOURCES_COMMON_H
 
 #include "decode/vulkan_object_info_table.h"
+#include "graphics/vulkan_resources_util.h"
 #include "vulkan/vulkan_core.h"
 #include "util/defines.h"
 #include "util/image_writer.h"
 #include "util/options.h"
+#include "util/thread_pool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -90,6 +104,113 @@ uint32_t FindGreatestVertexIndex(const std::vector<uint8_t>& index_data,
                                  uint32_t                    first_index,
                                  VkIndexType                 type);
 
+// Writes the files of dumped resources on worker threads, so that replay can continue while images are encoded.  The
+// amount of data held by pending writes is limited, so that dumping many large resources does not exhaust memory.
+//
+// Resources that are unchanged between dumps are only written once: a write with the same size and content hash as a
+// previous write is compared with the data of that write, and refers to the file of that write instead of creating a
+// new file when the data is identical.
+class DumpResourcesFileWriter
+{
+  public:
+    // When the data held by pending writes exceeds this size, new writes wait for the oldest writes to complete.
+    static const size_t kMaxPendingBytes = 256 * 1024 * 1024;
+
+    // The data of previous writes is kept for comparison with new writes up to this size.  Writes with data that is no
+    // longer kept are not deduplicated.
+    static const size_t kMaxRetainedBytes = 256 * 1024 * 1024;
+
+    DumpResourcesFileWriter() : pending_bytes_(0), retained_bytes_(0), next_content_id_(0) {}
+
+    ~DumpResourcesFileWriter() { Flush(); }
+
+    void WriteBuffer(const std::string& filename, std::vector<uint8_t>&& data);
+
+    // Writes size bytes of data starting at offset.  The data may be shared with other pending writes.
+    void WriteBuffer(const std::string&                          filename,
+                     std::shared_ptr<const std::vector<uint8_t>> data,
+                     size_t                                      offset,
+                     size_t                                      size);
+
+    // Encodes size bytes of data starting at offset as an image file with the format selected by
+    // output_image_format and image_file_format.
+    void WriteImage(const std::string&                          filename,
+                    VkFormat                                    format,
+                    util::imagewriter::DataFormats              output_image_format,
+                    util::ScreenshotFormat                      image_file_format,
+                    uint32_t                                    width,
+                    uint32_t                                    height,
+                    uint32_t                                    stride,
+                    std::shared_ptr<const std::vector<uint8_t>> data,
+                    size_t                                      offset,
+                    size_t                                      size);
+
+    // Waits for all pending writes to complete.
+    void Flush();
+
+    // Returns the name of the file that holds the content written for filename, which is a different file when the
+    // same content was previously written to it, or when filename was written again while other file names referred
+    // to its previous content.
+    std::string GetWrittenFilename(const std::string& filename) const;
+
+  private:
+    // Parameters used to encode the data of a write.  Identical data produces a different file when it is encoded with
+    // different parameters.
+    struct FileEncoding
+    {
+        bool                           is_image{ false };
+        VkFormat                       format{ VK_FORMAT_UNDEFINED };
+        util::imagewriter::DataFormats output_image_format{ util::imagewriter::DataFormats::kFormat_UNSPECIFIED };
+        util::ScreenshotFormat         image_file_format{ util::ScreenshotFormat::kBmp };
+        uint32_t                       width{ 0 };
+        uint32_t                       height{ 0 };
+        uint32_t                       stride{ 0 };
+
+        bool operator==(const FileEncoding& other) const;
+    };
+
+    // Data size and hash, which identify the content of a write.
+    typedef std::pair<size_t, uint64_t> ContentKey;
+
+    struct FileContent
+    {
+        ContentKey                                  key;
+        FileEncoding                                encoding;
+        std::shared_ptr<const std::vector<uint8_t>> data; // Reset when the data is no longer retained.
+        size_t                                      offset{ 0 };
+        uint64_t                                    id{ 0 };
+    };
+
+    static FileContent MakeFileContent(const FileEncoding&                         encoding,
+                                       std::shared_ptr<const std::vector<uint8_t>> data,
+                                       size_t                                      offset,
+                                       size_t                                      size);
+
+    // Returns true when identical content was already written, in which case filename refers to that file.  Otherwise
+    // returns false and sets write_filename to the file that the content must be written to.
+    bool IsDuplicate(const std::string& filename, FileContent&& content, std::string* write_filename);
+
+    // Returns true when another file name refers to the content of filename.
+    bool IsReferenced(const std::string& filename) const;
+
+    void ReleaseContent(const std::string& filename);
+
+    void RetainContent(const std::string& filename, FileContent&& content);
+
+    void Submit(size_t size, std::function<void()> write);
+
+  private:
+    std::unique_ptr<util::ThreadPool>                thread_pool_;
+    std::deque<std::pair<std::future<void>, size_t>> pending_writes_;
+    size_t                                           pending_bytes_;
+    std::map<ContentKey, std::string>                content_files_;     // Content key to the file holding it.
+    std::unordered_map<std::string, FileContent>     file_contents_;     // File name to the content written to it.
+    std::unordered_map<std::string, std::string>     filename_aliases_;  // File name to the file holding its content.
+    std::deque<std::pair<std::string, uint64_t>>     retained_contents_; // Files with retained data, oldest first.
+    size_t                                           retained_bytes_;
+    uint64_t                                         next_content_id_;
+};
+
 VkResult DumpImageToFile(const ImageInfo*                   image_info,
                          const DeviceInfo*                  device_info,
                          const encode::VulkanDeviceTable*   device_table,
@@ -99,10 +220,25 @@ VkResult DumpImageToFile(const ImageInfo*                   image_info,
                          float                              scale,
                          std::vector<bool>&                 scaling_supported,
                          util::ScreenshotFormat             image_file_format,
+                         DumpResourcesFileWriter&           file_writer,
                          bool                               dump_all_subresources = false,
                          VkImageLayout                      layout                = VK_IMAGE_LAYOUT_MAX_ENUM,
                          const VkExtent3D*                  extent_p              = nullptr);
 
+struct BufferFileRegion
+{
+    VkBuffer     buffer;
+    uint32_t     queue_family_index;
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    std::string  filename;
+};
+
+// Reads the buffer regions with a single queue submission for each queue family, then writes each region to its file.
+VkResult DumpBuffersToFiles(graphics::VulkanResourcesUtil&       resource_util,
+                            const std::vector<BufferFileRegion>& regions,
+                            DumpResourcesFileWriter&             file_writer);
+
 bool CheckDescriptorCompatibility(VkDescriptorType desc_type_a, VkDescriptorType desc_type_b);
 
 std::string ShaderStageToStr(VkShaderStageFlagBits shader_stage);
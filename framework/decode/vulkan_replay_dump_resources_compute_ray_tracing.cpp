@@ -38,6 +38,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <sstream>
 #include <vector>
 #include <vulkan/vulkan_core.h>
@@ -53,6 +54,7 @@ DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vect
                                                                  VulkanObjectInfoTable&         object_info_table,
                                                                  const VulkanReplayOptions&     options,
                                                                  VulkanReplayDumpResourcesJson& dump_json,
+                                                                 DumpResourcesFileWriter&       file_writer,
                                                                  std::string                    capture_filename) :
     original_command_buffer_info(nullptr),
     DR_command_buffer(VK_NULL_HANDLE), dispatch_indices(dispatch_indices),
@@ -61,7 +63,7 @@ DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vect
     image_file_format(options.dump_resources_image_format), dump_resources_scale(options.dump_resources_scale),
     device_table(nullptr), parent_device(VK_NULL_HANDLE), instance_table(nullptr), object_info_table(object_info_table),
     replay_device_phys_mem_props(nullptr), current_dispatch_index(0), current_trace_rays_index(0), dump_json(dump_json),
-    output_json_per_command(options.dump_resources_json_per_command),
+    file_writer(file_writer), output_json_per_command(options.dump_resources_json_per_command),
     dump_immutable_resources(options.dump_resources_dump_immutable_resources),
     dump_all_image_subresources(options.dump_resources_dump_all_image_subresources), capture_filename(capture_filename)
 {}
@@ -1113,6 +1115,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                                            dump_resources_scale,
                                            scaling_supported,
                                            image_file_format,
+                                           file_writer,
                                            false,
                                            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
             if (res != VK_SUCCESS)
@@ -1132,25 +1135,15 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
         }
 
         // Dump buffers
+        std::vector<BufferFileRegion> buffer_regions;
+        buffer_regions.reserve(mutable_resources_clones_before.buffers.size());
+
         for (size_t i = 0; i < mutable_resources_clones_before.buffers.size(); ++i)
         {
             const BufferInfo* buffer_info = mutable_resources_clones_before.buffers[i].original_buffer;
             assert(buffer_info != nullptr);
             assert(mutable_resources_clones_before.buffers[i].buffer != VK_NULL_HANDLE);
 
-            std::vector<uint8_t> data;
-
-            VkResult res = resource_util.ReadFromBufferResource(mutable_resources_clones_before.buffers[i].buffer,
-                                                                buffer_info->size,
-                                                                0,
-                                                                buffer_info->queue_family_index,
-                                                                data);
-            if (res != VK_SUCCESS)
-            {
-                GFXRECON_LOG_ERROR("Reading from buffer resource failed (%s)", util::ToString<VkResult>(res).c_str())
-                return res;
-            }
-
             const uint32_t              desc_set    = mutable_resources_clones_before.buffers[i].desc_set;
             const uint32_t              binding     = mutable_resources_clones_before.buffers[i].desc_binding;
             const uint32_t              array_index = mutable_resources_clones_before.buffers[i].array_index;
@@ -1158,7 +1151,18 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
 
             std::string filename = GenerateDispatchTraceRaysBufferFilename(
                 is_dispatch, qs_index, bcb_index, cmd_index, desc_set, binding, array_index, stage, true);
-            util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+
+            buffer_regions.push_back({ mutable_resources_clones_before.buffers[i].buffer,
+                                       buffer_info->queue_family_index,
+                                       0,
+                                       buffer_info->size,
+                                       std::move(filename) });
+        }
+
+        VkResult res = DumpBuffersToFiles(resource_util, buffer_regions, file_writer);
+        if (res != VK_SUCCESS)
+        {
+            return res;
         }
     }
 
@@ -1199,6 +1203,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       file_writer,
                                        false,
                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
         if (res != VK_SUCCESS)
@@ -1218,20 +1223,14 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
     }
 
     // Dump buffers
+    std::vector<BufferFileRegion> buffer_regions;
+    buffer_regions.reserve(mutable_resources_clones.buffers.size());
+
     for (size_t i = 0; i < mutable_resources_clones.buffers.size(); ++i)
     {
         assert(mutable_resources_clones.buffers[i].original_buffer != nullptr);
         assert(mutable_resources_clones.buffers[i].buffer != VK_NULL_HANDLE);
-        const BufferInfo*    buffer_info = mutable_resources_clones.buffers[i].original_buffer;
-        std::vector<uint8_t> data;
-
-        VkResult res = resource_util.ReadFromBufferResource(
-            mutable_resources_clones.buffers[i].buffer, buffer_info->size, 0, buffer_info->queue_family_index, data);
-        if (res != VK_SUCCESS)
-        {
-            GFXRECON_LOG_ERROR("Reading from buffer resource failed (%s)", util::ToString<VkResult>(res).c_str())
-            return res;
-        }
+        const BufferInfo* buffer_info = mutable_resources_clones.buffers[i].original_buffer;
 
         const uint32_t              desc_set    = mutable_resources_clones.buffers[i].desc_set;
         const uint32_t              binding     = mutable_resources_clones.buffers[i].desc_binding;
@@ -1240,10 +1239,15 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
 
         std::string filename = GenerateDispatchTraceRaysBufferFilename(
             is_dispatch, qs_index, bcb_index, cmd_index, desc_set, binding, array_index, stage, false);
-        util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+
+        buffer_regions.push_back({ mutable_resources_clones.buffers[i].buffer,
+                                   buffer_info->queue_family_index,
+                                   0,
+                                   buffer_info->size,
+                                   std::move(filename) });
     }
 
-    return VK_SUCCESS;
+    return DumpBuffersToFiles(resource_util, buffer_regions, file_writer);
 }
 
 bool DispatchTraceRaysDumpingContext::IsRecording() const
@@ -1664,6 +1668,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       file_writer,
                                        dump_all_image_subresources);
         if (res != VK_SUCCESS)
         {
@@ -1690,6 +1695,9 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
                                                 *instance_table,
                                                 *phys_dev_info->replay_device_info->memory_properties);
 
+    std::vector<BufferFileRegion> buffer_regions;
+    buffer_regions.reserve(buffer_descriptors.size());
+
     for (const auto& buf : buffer_descriptors)
     {
         const BufferInfo*  buffer_info = buf.first;
@@ -1697,17 +1705,10 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
         const VkDeviceSize range       = buf.second.range;
         const VkDeviceSize size        = range == VK_WHOLE_SIZE ? buffer_info->size - offset : range;
 
-        std::vector<uint8_t> data;
-        VkResult             res = resource_util.ReadFromBufferResource(
-            buffer_info->handle, size, offset, buffer_info->queue_family_index, data);
-        if (res != VK_SUCCESS)
-        {
-            GFXRECON_LOG_ERROR("Reading from buffer resource failed (%s)", util::ToString<VkResult>(res).c_str())
-            return res;
-        }
+        std::string filename = GenerateBufferDescriptorFilename(qs_index, bcb_index, buffer_info->capture_id);
 
-        const std::string filename = GenerateBufferDescriptorFilename(qs_index, bcb_index, buffer_info->capture_id);
-        util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+        buffer_regions.push_back(
+            { buffer_info->handle, buffer_info->queue_family_index, offset, size, std::move(filename) });
     }
 
     for (const auto& iub : inline_uniform_blocks)
@@ -1717,7 +1718,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
         util::bufferwriter::WriteBuffer(filename, iub.second.data->data(), iub.second.data->size());
     }
 
-    return VK_SUCCESS;
+    return DumpBuffersToFiles(resource_util, buffer_regions, file_writer);
 }
 
 VkResult DispatchTraceRaysDumpingContext::CopyDispatchIndirectParameters(uint64_t index)
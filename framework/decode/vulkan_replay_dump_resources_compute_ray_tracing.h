@@ -51,6 +51,7 @@ class DispatchTraceRaysDumpingContext
                                     VulkanObjectInfoTable&         object_info_table,
                                     const VulkanReplayOptions&     options,
                                     VulkanReplayDumpResourcesJson& dump_json,
+                                    DumpResourcesFileWriter&       file_writer,
                                     std::string                    capture_filename);
 
     ~DispatchTraceRaysDumpingContext();
@@ -187,6 +188,7 @@ class DispatchTraceRaysDumpingContext
     util::ScreenshotFormat         image_file_format;
     float                          dump_resources_scale;
     VulkanReplayDumpResourcesJson& dump_json;
+    DumpResourcesFileWriter&       file_writer;
     bool                           output_json_per_command;
     bool                           dump_immutable_resources;
     bool                           dump_all_image_subresources;
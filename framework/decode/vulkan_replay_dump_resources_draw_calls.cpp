@@ -58,6 +58,7 @@ DrawCallsDumpingContext::DrawCallsDumpingContext(const std::vector<uint64_t>&
                                                  VulkanObjectInfoTable&                    object_info_table,
                                                  const VulkanReplayOptions&                options,
                                                  VulkanReplayDumpResourcesJson&            dump_json,
+                                                 DumpResourcesFileWriter&                  file_writer,
                                                  std::string                               capture_filename) :
     original_command_buffer_info(nullptr),
     current_cb_index(0), dc_indices(dc_indices), RP_indices(rp_indices), active_renderpass(nullptr),
@@ -66,7 +67,7 @@ DrawCallsDumpingContext::DrawCallsDumpingContext(const std::vector<uint64_t>&
     device_table(nullptr), instance_table(nullptr), object_info_table(object_info_table),
     replay_device_phys_mem_props(nullptr), dump_resource_path(options.dump_resources_output_dir),
     image_file_format(options.dump_resources_image_format), dump_resources_scale(options.dump_resources_scale),
-    dump_json(dump_json), dump_depth(options.dump_resources_dump_depth),
+    dump_json(dump_json), file_writer(file_writer), dump_depth(options.dump_resources_dump_depth),
     color_attachment_to_dump(options.dump_resources_color_attachment_index),
     dump_vertex_index_buffers(options.dump_resources_dump_vertex_index_buffer),
     output_json_per_command(options.dump_resources_json_per_command),
@@ -846,10 +847,17 @@ VkResult DrawCallsDumpingContext::DumpDrawCalls(
             }
         }
 
-        if (!dump_resources_before || dump_resources_before && !(cb % 2))
+        // With dump_resources_before, each draw call is dumped by an even "before" command buffer followed by an odd
+        // "after" command buffer. Its json entry refers to the files of both, so it is generated once the "after" files
+        // have been written and the file writer can resolve their names.
+        if (!dump_resources_before)
         {
             GenerateOutputJsonDrawCallInfo(qs_index, bcb_index, cb, rp, sp);
         }
+        else if (cb % 2)
+        {
+            GenerateOutputJsonDrawCallInfo(qs_index, bcb_index, cb - 1, rp, sp);
+        }
 
         res = RevertRenderTargetImageLayouts(queue, cb);
         if (res != VK_SUCCESS)
@@ -1202,7 +1210,7 @@ void DrawCallsDumpingContext::GenerateOutputJsonDrawCallInfo(
 
                     json_entry[i]["bufferId"]            = vb_binding_buffer->second.buffer_info->capture_id;
                     json_entry[i]["vertexBufferBinding"] = vb_binding.first;
-                    json_entry[i]["file"]                = vb_filename;
+                    json_entry[i]["file"]                = file_writer.GetWrittenFilename(vb_filename);
                     ++i;
                 }
             }
@@ -1529,6 +1537,7 @@ VkResult DrawCallsDumpingContext::DumpRenderTargetAttachments(
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       file_writer,
                                        dump_all_image_subresources,
                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                        &extent);
@@ -1572,6 +1581,7 @@ VkResult DrawCallsDumpingContext::DumpRenderTargetAttachments(
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       file_writer,
                                        dump_all_image_subresources,
                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                        &extent);
@@ -1824,6 +1834,7 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       file_writer,
                                        dump_all_image_subresources);
         if (res != VK_SUCCESS)
         {
@@ -1850,6 +1861,9 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
                                                 *instance_table,
                                                 *phys_dev_info->replay_device_info->memory_properties);
 
+    std::vector<BufferFileRegion> buffer_regions;
+    buffer_regions.reserve(buffer_descriptors.size());
+
     for (const auto& buf : buffer_descriptors)
     {
         const BufferInfo*  buffer_info = buf.first;
@@ -1857,19 +1871,10 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
         const VkDeviceSize range       = buf.second.range;
         const VkDeviceSize size        = range == VK_WHOLE_SIZE ? buffer_info->size - offset : range;
 
-        std::vector<uint8_t> data;
-        VkResult             res = resource_util.ReadFromBufferResource(
-            buffer_info->handle, size, offset, buffer_info->queue_family_index, data);
-        if (res != VK_SUCCESS)
-        {
-            GFXRECON_LOG_ERROR("Reading from buffer resource %" PRIu64 " failed (%s).",
-                               buffer_info->capture_id,
-                               util::ToString<VkResult>(res).c_str())
-            return res;
-        }
+        std::string filename = GenerateBufferDescriptorFilename(qs_index, bcb_index, rp, buffer_info->capture_id);
 
-        const std::string filename = GenerateBufferDescriptorFilename(qs_index, bcb_index, rp, buffer_info->capture_id);
-        util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+        buffer_regions.push_back(
+            { buffer_info->handle, buffer_info->queue_family_index, offset, size, std::move(filename) });
     }
 
     for (const auto& iub : inline_uniform_blocks)
@@ -1879,7 +1884,7 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
         util::bufferwriter::WriteBuffer(filename, iub.second.data->data(), iub.second.data->size());
     }
 
-    return VK_SUCCESS;
+    return DumpBuffersToFiles(resource_util, buffer_regions, file_writer);
 }
 
 std::string DrawCallsDumpingContext::GenerateIndexBufferFilename(uint64_t    qs_index,
@@ -2220,9 +2225,6 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
                 return res;
             }
 
-            std::string filename = GenerateIndexBufferFilename(qs_index, bcb_index, dc_index, index_type);
-            util::bufferwriter::WriteBuffer(filename, index_data.data(), index_data.size());
-
             for (const auto& pairs : index_count_first_index_pairs)
             {
                 const uint32_t gvi = FindGreatestVertexIndex(index_data, pairs.first, pairs.second, index_type);
@@ -2231,6 +2233,9 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
                     greatest_vertex_index = gvi;
                 }
             }
+
+            std::string filename = GenerateIndexBufferFilename(qs_index, bcb_index, dc_index, index_type);
+            file_writer.WriteBuffer(filename, std::move(index_data));
         }
     }
 
@@ -2398,7 +2403,7 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
                 }
 
                 std::string filename = GenerateVertexBufferFilename(qs_index, bcb_index, dc_index, binding);
-                util::bufferwriter::WriteBuffer(filename, vb_data.data(), vb_data.size());
+                file_writer.WriteBuffer(filename, std::move(vb_data));
             }
         }
     }
@@ -49,6 +49,7 @@ class DrawCallsDumpingContext
                             VulkanObjectInfoTable&                    object_info_table,
                             const VulkanReplayOptions&                options,
                             VulkanReplayDumpResourcesJson&            dump_json,
+                            DumpResourcesFileWriter&                  file_writer,
                             std::string                               capture_filename);
 
     ~DrawCallsDumpingContext();
@@ -255,6 +256,7 @@ class DrawCallsDumpingContext
     util::ScreenshotFormat             image_file_format;
     float                              dump_resources_scale;
     VulkanReplayDumpResourcesJson&     dump_json;
+    DumpResourcesFileWriter&           file_writer;
     bool                               dump_depth;
     int32_t                            color_attachment_to_dump;
     bool                               dump_vertex_index_buffers;
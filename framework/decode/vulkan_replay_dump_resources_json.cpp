@@ -30,8 +30,9 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-VulkanReplayDumpResourcesJson::VulkanReplayDumpResourcesJson(const VulkanReplayOptions& options) :
-    file_(nullptr), current_entry(nullptr), first_block_(true)
+VulkanReplayDumpResourcesJson::VulkanReplayDumpResourcesJson(const VulkanReplayOptions&     options,
+                                                             const DumpResourcesFileWriter& file_writer) :
+    file_(nullptr), current_entry(nullptr), first_block_(true), file_writer_(file_writer)
 {
     header_["vulkanVersion"] = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
                                std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
@@ -184,12 +185,12 @@ void VulkanReplayDumpResourcesJson::InsertImageInfo(nlohmann::ordered_json&
     assert(filenames.size() == 1 || filenames.size() == 2);
     if (filenames.size() == 2)
     {
-        json_entry["beforeFile"] = filenames[0];
-        json_entry["afterFile"]  = filenames[1];
+        json_entry["beforeFile"] = file_writer_.GetWrittenFilename(filenames[0]);
+        json_entry["afterFile"]  = file_writer_.GetWrittenFilename(filenames[1]);
     }
     else
     {
-        json_entry["file"] = filenames[0];
+        json_entry["file"] = file_writer_.GetWrittenFilename(filenames[0]);
     }
 }
 
@@ -200,7 +201,7 @@ void VulkanReplayDumpResourcesJson::InsertBufferInfo(nlohmann::ordered_json& jso
     assert(buffer_info != nullptr);
 
     json_entry["bufferId"] = buffer_info->capture_id;
-    json_entry["file"]     = filename;
+    json_entry["file"]     = file_writer_.GetWrittenFilename(filename);
 }
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -25,6 +25,7 @@
 
 #include "util/json_util.h"
 #include "decode/vulkan_object_info.h"
+#include "decode/vulkan_replay_dump_resources_common.h"
 #include "decode/vulkan_replay_options.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -33,7 +34,9 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class VulkanReplayDumpResourcesJson
 {
   public:
-    VulkanReplayDumpResourcesJson(const VulkanReplayOptions& options);
+    // File names inserted into entries are resolved with file_writer, so that they refer to the file that actually
+    // holds the dumped content.
+    VulkanReplayDumpResourcesJson(const VulkanReplayOptions& options, const DumpResourcesFileWriter& file_writer);
 
     ~VulkanReplayDumpResourcesJson(){};
 
@@ -74,11 +77,12 @@ class VulkanReplayDumpResourcesJson
   private:
     bool InitializeFile(const std::string& filename);
 
-    FILE*                   file_;
-    nlohmann::ordered_json  header_;
-    nlohmann::ordered_json  json_data_;
-    nlohmann::ordered_json* current_entry;
-    bool                    first_block_;
+    FILE*                          file_;
+    nlohmann::ordered_json         header_;
+    nlohmann::ordered_json         json_data_;
+    nlohmann::ordered_json*        current_entry;
+    bool                           first_block_;
+    const DumpResourcesFileWriter& file_writer_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
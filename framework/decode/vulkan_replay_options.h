@@ -77,6 +77,7 @@ struct VulkanReplayOptions : public ReplayOptions
     SkipGetFenceStatus           skip_get_fence_status{ SkipGetFenceStatus::NoSkip };
     std::vector<util::UintRange> skip_get_fence_ranges;
     bool                         wait_before_present{ false };
+    bool                         reuse_command_buffers{ false };
 
     // Dumping resources related configurable replay options
     std::vector<uint64_t>                           BeginCommandBuffer_Indices;
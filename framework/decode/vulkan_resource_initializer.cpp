@@ -42,9 +42,11 @@ VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*
                                                      const encode::VulkanDeviceTable*        device_table) :
     device_(device_info->handle),
     staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
-    draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
-    draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
-    resource_allocator_(resource_allocator), device_table_(device_table), device_info_(device_info)
+    staging_mapped_data_(nullptr), staging_batch_offset_(0), draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE),
+    draw_set_layout_(VK_NULL_HANDLE), draw_set_(VK_NULL_HANDLE),
+    max_copy_size_((max_copy_size > kMinStagingSize) ? max_copy_size : kMinStagingSize),
+    have_shader_stencil_write_(have_shader_stencil_write), resource_allocator_(resource_allocator),
+    device_table_(device_table), device_info_(device_info)
 {
     assert((device_info != nullptr) && (device_info->handle != VK_NULL_HANDLE) &&
            (memory_properties.memoryTypeCount > 0) && (memory_properties.memoryHeapCount > 0) &&
@@ -62,6 +64,9 @@ VulkanResourceInitializer::VulkanResourceInitializer(const DeviceInfo*
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    // Batched commands must complete before the staging and command objects are destroyed.
+    SubmitPendingCommands();
+
     for (const auto& entry : command_exec_objects_)
     {
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
@@ -69,6 +74,7 @@ VulkanResourceInitializer::~VulkanResourceInitializer()
 
     if (staging_buffer_ != VK_NULL_HANDLE)
     {
+        resource_allocator_->UnmapResourceMemoryDirect(staging_buffer_data_);
         resource_allocator_->DestroyBufferDirect(staging_buffer_, nullptr, staging_buffer_data_);
     }
 
@@ -111,33 +117,31 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    VkBuffer        staging_buffer = VK_NULL_HANDLE;
+    VkDeviceSize    staging_offset = 0;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = AcquireBatchStagingData(data_size, data, &staging_buffer, &staging_offset);
 
     if (result == VK_SUCCESS)
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
-
-            if (result == VK_SUCCESS)
+            std::vector<VkBufferCopy> staging_regions(regions, regions + region_count);
+            for (auto& region : staging_regions)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
-
-                result = ExecuteCommandBuffer(queue, command_buffer);
+                region.srcOffset += staging_offset;
             }
 
-            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, staging_regions.data());
+
+            // Temporary staging buffers are only released after their copies complete.
+            if (!temporary_staging_buffers_.empty())
+            {
+                result = SubmitPendingCommands();
+            }
         }
     }
 
@@ -160,35 +164,50 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                                     uint32_t                 level_count,
                                                     const VkBufferImageCopy* level_copies)
 {
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
-
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+    VkResult result = VK_SUCCESS;
 
-    if (result == VK_SUCCESS)
+    bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                        (sample_count == VK_SAMPLE_COUNT_1_BIT);
+    bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                           (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+    bool use_depth_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+    bool use_stencil_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+
+    if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D))
     {
-        result = LoadData(data_size, data, staging_buffer_data);
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        // The pixel shader copy is executed immediately, and reads its data from the start of the staging buffer, so
+        // the batched commands must complete first.
+        result = SubmitPendingCommands();
 
         if (result == VK_SUCCESS)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+
+            if (result == VK_SUCCESS)
             {
+                // The render pass keeps the content of the other aspect of a combined depth-stencil image when that
+                // aspect has already been initialized.
+                VkImageAspectFlags   transition_aspect = GetImageTransitionAspect(format, aspect);
+                VkPipelineStageFlags src_stage         = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+                VkAccessFlags        src_access        = 0;
+                VkImageLayout        pass_layout       = initial_layout;
+
+                if (depth_stencil_layouts_.find(image) != depth_stencil_layouts_.end())
+                {
+                    GetImageTransitionSource(
+                        image, transition_aspect, initial_layout, &src_stage, &src_access, &pass_layout);
+                }
+
                 result = PixelShaderImageCopy(queue_family_index,
                                               staging_buffer,
                                               image,
@@ -197,28 +216,57 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                               extent,
                                               aspect,
                                               sample_count,
-                                              initial_layout,
+                                              pass_layout,
                                               final_layout,
                                               layer_count,
                                               level_count,
                                               level_copies);
+
+                // Matches the final layout of the render pass attachment.
+                VkImageLayout current_layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                if ((final_layout != VK_IMAGE_LAYOUT_UNDEFINED) && (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+                {
+                    current_layout = final_layout;
+                }
+
+                SetImageTransitionLayout(image, transition_aspect, current_layout);
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
             }
-            else
+        }
+    }
+    else
+    {
+        VkBuffer     staging_buffer = VK_NULL_HANDLE;
+        VkDeviceSize staging_offset = 0;
+
+        result = AcquireBatchStagingData(data_size, data, &staging_buffer, &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            std::vector<VkBufferImageCopy> staging_copies(level_copies, level_copies + level_count);
+            for (auto& copy : staging_copies)
             {
-                result = BufferToImageCopy(queue_family_index,
-                                           staging_buffer,
-                                           image,
-                                           format,
-                                           aspect,
-                                           initial_layout,
-                                           final_layout,
-                                           layer_count,
-                                           level_count,
-                                           level_copies);
+                copy.bufferOffset += staging_offset;
             }
-        }
 
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            result = BufferToImageCopy(queue_family_index,
+                                       staging_buffer,
+                                       image,
+                                       format,
+                                       aspect,
+                                       initial_layout,
+                                       final_layout,
+                                       layer_count,
+                                       level_count,
+                                       staging_copies.data());
+
+            // Temporary staging buffers are only released after their copies complete.
+            if ((result == VK_SUCCESS) && !temporary_staging_buffers_.empty())
+            {
+                result = SubmitPendingCommands();
+            }
+        }
     }
 
     return result;
@@ -233,50 +281,46 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
                                                     uint32_t              layer_count,
                                                     uint32_t              level_count)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
     if (result == VK_SUCCESS)
     {
-        result = BeginCommandBuffer(command_buffer);
-
-        if (result == VK_SUCCESS)
-        {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
-
-            device_table_->EndCommandBuffer(command_buffer);
-
-            result = ExecuteCommandBuffer(queue, command_buffer);
-        }
+        VkImageAspectFlags   transition_aspect = GetImageTransitionAspect(format, aspect);
+        VkPipelineStageFlags src_stage         = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        VkAccessFlags        src_access        = 0;
+        VkImageLayout        old_layout        = initial_layout;
+
+        GetImageTransitionSource(image, transition_aspect, initial_layout, &src_stage, &src_access, &old_layout);
+
+        VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = src_access;
+        memory_barrier.dstAccessMask                   = 0;
+        memory_barrier.oldLayout                       = old_layout;
+        memory_barrier.newLayout                       = final_layout;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = image;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = level_count;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = layer_count;
+
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          src_stage,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+
+        SetImageTransitionLayout(image, transition_aspect, final_layout);
     }
 
     return result;
@@ -853,6 +897,7 @@ void VulkanResourceInitializer::DestroyStagingImage(VkDeviceMemory
 {
     if (image != VK_NULL_HANDLE)
     {
+        depth_stencil_layouts_.erase(image);
         resource_allocator_->DestroyImageDirect(image, nullptr, allocator_image_data);
     }
 
@@ -966,6 +1011,14 @@ VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*
                     staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
             }
 
+            // The reusable staging buffer remains mapped until it is destroyed.
+            void* mapped_data = nullptr;
+            if ((result == VK_SUCCESS) && (size <= max_copy_size_))
+            {
+                result = resource_allocator_->MapResourceMemoryDirect(
+                    create_info.size, 0, &mapped_data, staging_buffer_data);
+            }
+
             if (result == VK_SUCCESS)
             {
                 (*memory)                = staging_memory;
@@ -979,6 +1032,7 @@ VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*
                     staging_buffer_      = staging_buffer;
                     staging_memory_data_ = staging_memory_data;
                     staging_buffer_data_ = staging_buffer_data;
+                    staging_mapped_data_ = reinterpret_cast<uint8_t*>(mapped_data);
                 }
             }
             else
@@ -1018,7 +1072,16 @@ VulkanResourceInitializer::AcquireInitializedStagingBuffer(VkDeviceSize
     {
         assert((staging_memory != nullptr) && (staging_memory_data != nullptr));
 
-        result = LoadData(data_size, data, *staging_buffer_data);
+        if ((*staging_buffer) == staging_buffer_)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(staging_mapped_data_, copy_size, data, copy_size);
+        }
+        else
+        {
+            result = LoadData(data_size, data, *staging_buffer_data);
+        }
     }
 
     return result;
@@ -1043,6 +1106,133 @@ void VulkanResourceInitializer::ReleaseStagingBuffer(VkDeviceMemory
     }
 }
 
+VkResult VulkanResourceInitializer::AcquireBatchStagingData(VkDeviceSize   data_size,
+                                                            const uint8_t* data,
+                                                            VkBuffer*      buffer,
+                                                            VkDeviceSize*  offset)
+{
+    assert((buffer != nullptr) && (offset != nullptr));
+
+    VkResult result = VK_SUCCESS;
+
+    if (data_size > max_copy_size_)
+    {
+        TemporaryStagingBuffer temporary = { VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0 };
+
+        result = AcquireInitializedStagingBuffer(
+            data_size, data, &temporary.memory, &temporary.buffer, &temporary.memory_data, &temporary.buffer_data);
+
+        if (result == VK_SUCCESS)
+        {
+            temporary_staging_buffers_.push_back(temporary);
+
+            (*buffer) = temporary.buffer;
+            (*offset) = 0;
+        }
+    }
+    else
+    {
+        VkDeviceSize batch_offset =
+            ((staging_batch_offset_ + kStagingAlignment - 1) / kStagingAlignment) * kStagingAlignment;
+
+        if ((batch_offset > max_copy_size_) || (data_size > (max_copy_size_ - batch_offset)))
+        {
+            // The staging buffer is full; its content can be replaced after the pending copies complete.
+            result       = SubmitPendingCommands();
+            batch_offset = 0;
+        }
+
+        if ((result == VK_SUCCESS) && (staging_buffer_ == VK_NULL_HANDLE))
+        {
+            VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+            VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+            VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+            VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+            result = AcquireStagingBuffer(
+                &staging_memory, &staging_buffer, data_size, &staging_memory_data, &staging_buffer_data);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, batch_offset);
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+            size_t copy_size = static_cast<size_t>(data_size);
+            util::platform::MemoryCopy(
+                staging_mapped_data_ + static_cast<size_t>(batch_offset), copy_size, data, copy_size);
+
+            staging_batch_offset_ = batch_offset + data_size;
+
+            (*buffer) = staging_buffer_;
+            (*offset) = batch_offset;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer)
+{
+    assert(command_buffer != nullptr);
+
+    VkQueue  queue  = VK_NULL_HANDLE;
+    VkResult result = GetCommandExecObjects(queue_family_index, &queue, command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        CommandExecObjects& exec_objects = command_exec_objects_[queue_family_index];
+
+        if (!exec_objects.recording)
+        {
+            result = BeginCommandBuffer(exec_objects.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                exec_objects.recording = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::SubmitPendingCommands()
+{
+    VkResult result = VK_SUCCESS;
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& exec_objects = entry.second;
+
+        if (exec_objects.recording)
+        {
+            exec_objects.recording = false;
+
+            VkResult submit_result = device_table_->EndCommandBuffer(exec_objects.command_buffer);
+
+            if (submit_result == VK_SUCCESS)
+            {
+                submit_result = ExecuteCommandBuffer(exec_objects.queue, exec_objects.command_buffer);
+            }
+
+            if (submit_result != VK_SUCCESS)
+            {
+                result = submit_result;
+            }
+        }
+    }
+
+    for (const auto& temporary : temporary_staging_buffers_)
+    {
+        ReleaseStagingBuffer(temporary.memory, temporary.buffer, temporary.memory_data, temporary.buffer_data);
+    }
+
+    temporary_staging_buffers_.clear();
+    staging_batch_offset_ = 0;
+
+    return result;
+}
+
 void VulkanResourceInitializer::UpdateDrawDescriptorSet(VkDescriptorSet set, VkImageView view, VkSampler sampler)
 {
     VkDescriptorImageInfo image_write_info;
@@ -1107,9 +1297,7 @@ VkResult VulkanResourceInitializer::ExecuteCommandBuffer(VkQueue queue, VkComman
     return result;
 }
 
-VkImageAspectFlags VulkanResourceInitializer::GetImageTransitionAspect(VkFormat              format,
-                                                                       VkImageAspectFlagBits aspect,
-                                                                       VkImageLayout*        old_layout)
+VkImageAspectFlags VulkanResourceInitializer::GetImageTransitionAspect(VkFormat format, VkImageAspectFlagBits aspect)
 {
     VkImageAspectFlags transition_aspect = aspect;
 
@@ -1121,19 +1309,55 @@ VkImageAspectFlags VulkanResourceInitializer::GetImageTransitionAspect(VkFormat
             (format == VK_FORMAT_D32_SFLOAT_S8_UINT))
         {
             transition_aspect = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-
-            if (old_layout != nullptr)
-            {
-                // The same depth-stencil image will be processed twice (once for each aspect), and will no longer have
-                // the expected initial layout on the second transition.
-                (*old_layout) = VK_IMAGE_LAYOUT_UNDEFINED;
-            }
         }
     }
 
     return transition_aspect;
 }
 
+void VulkanResourceInitializer::GetImageTransitionSource(VkImage               image,
+                                                         VkImageAspectFlags    transition_aspect,
+                                                         VkImageLayout         initial_layout,
+                                                         VkPipelineStageFlags* src_stage,
+                                                         VkAccessFlags*        src_access,
+                                                         VkImageLayout*        old_layout) const
+{
+    assert((src_stage != nullptr) && (src_access != nullptr) && (old_layout != nullptr));
+
+    (*src_stage)  = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    (*src_access) = 0;
+    (*old_layout) = initial_layout;
+
+    if (transition_aspect == (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT))
+    {
+        auto entry = depth_stencil_layouts_.find(image);
+
+        if (entry == depth_stencil_layouts_.end())
+        {
+            // First aspect of the image, which does not have initialized content yet.
+            (*old_layout) = VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+        else
+        {
+            // The commands for the other aspect may be recorded to the same command buffer, so the transition must wait
+            // for its copy and must keep its content.
+            (*src_stage)  = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            (*src_access) = VK_ACCESS_TRANSFER_WRITE_BIT;
+            (*old_layout) = entry->second;
+        }
+    }
+}
+
+void VulkanResourceInitializer::SetImageTransitionLayout(VkImage            image,
+                                                         VkImageAspectFlags transition_aspect,
+                                                         VkImageLayout      layout)
+{
+    if (transition_aspect == (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT))
+    {
+        depth_stencil_layouts_[image] = layout;
+    }
+}
+
 uint32_t VulkanResourceInitializer::GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags)
 {
     uint32_t memory_type_index = std::numeric_limits<uint32_t>::max();
@@ -1162,39 +1386,64 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
                                                       uint32_t                 level_count,
                                                       const VkBufferImageCopy* level_copies)
 {
-    VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    VkResult result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
     if (result == VK_SUCCESS)
     {
-        VkImageLayout      old_layout        = initial_layout;
-        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-        result = BeginCommandBuffer(command_buffer);
-
-        if (result == VK_SUCCESS)
+        VkImageAspectFlags   transition_aspect = GetImageTransitionAspect(format, aspect);
+        VkPipelineStageFlags src_stage         = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        VkAccessFlags        src_access        = 0;
+        VkImageLayout        old_layout        = initial_layout;
+
+        GetImageTransitionSource(destination, transition_aspect, initial_layout, &src_stage, &src_access, &old_layout);
+
+        VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        memory_barrier.pNext                           = nullptr;
+        memory_barrier.srcAccessMask                   = src_access;
+        memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.oldLayout                       = old_layout;
+        memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        memory_barrier.image                           = destination;
+        memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+        memory_barrier.subresourceRange.baseMipLevel   = 0;
+        memory_barrier.subresourceRange.levelCount     = level_count;
+        memory_barrier.subresourceRange.baseArrayLayer = 0;
+        memory_barrier.subresourceRange.layerCount     = layer_count;
+
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          src_stage,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+
+        device_table_->CmdCopyBufferToImage(
+            command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+
+        VkImageLayout current_layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+
+        if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+            (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
         {
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = destination;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
+            current_layout = final_layout;
+
+            memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            memory_barrier.dstAccessMask = 0;
+            memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            memory_barrier.newLayout     = final_layout;
 
             device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
                                               VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
                                               0,
                                               0,
                                               nullptr,
@@ -1202,34 +1451,9 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
                                               nullptr,
                                               1,
                                               &memory_barrier);
-
-            device_table_->CmdCopyBufferToImage(
-                command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
-
-            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
-            {
-                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                memory_barrier.dstAccessMask = 0;
-                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                memory_barrier.newLayout     = final_layout;
-
-                device_table_->CmdPipelineBarrier(command_buffer,
-                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                  0,
-                                                  0,
-                                                  nullptr,
-                                                  0,
-                                                  nullptr,
-                                                  1,
-                                                  &memory_barrier);
-            }
-
-            device_table_->EndCommandBuffer(command_buffer);
-
-            result = ExecuteCommandBuffer(queue, command_buffer);
         }
+
+        SetImageTransitionLayout(destination, transition_aspect, current_layout);
     }
 
     return result;
@@ -1318,6 +1542,13 @@ VkResult VulkanResourceInitializer::PixelShaderImageCopy(uint32_t
                                            level_count,
                                            level_copies);
 
+                // The staging image must be initialized before it is sampled by the draw commands, which are
+                // recorded to the same command buffer as the batched commands.
+                if (result == VK_SUCCESS)
+                {
+                    result = SubmitPendingCommands();
+                }
+
                 if (result == VK_SUCCESS)
                 {
                     VkViewport viewport     = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
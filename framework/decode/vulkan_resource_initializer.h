@@ -37,6 +37,10 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 struct DeviceInfo;
 
+// Uploads the buffer and image content of trimmed capture state snapshots.  Staging copies and layout transitions are
+// batched: their data is packed into a persistently mapped staging buffer and their commands are recorded to one
+// command buffer per queue family, which are only submitted when the staging buffer is full, when an upload must be
+// executed immediately, or when SubmitPendingCommands is called at the end of resource initialization.
 class VulkanResourceInitializer
 {
   public:
@@ -84,6 +88,17 @@ class VulkanResourceInitializer
                              uint32_t              layer_count,
                              uint32_t              level_count);
 
+    // Submits the batched initialization commands and waits for them to complete.
+    VkResult SubmitPendingCommands();
+
+  private:
+    // Staging data offsets are a multiple of every texel block size, and of the 256 byte optimal buffer copy offset
+    // alignment reported by most implementations.
+    static const VkDeviceSize kStagingAlignment = 768;
+
+    // Smallest size of the staging buffer used for batched uploads.
+    static const VkDeviceSize kMinStagingSize = 64 * 1024 * 1024;
+
   private:
     VkResult GetCommandExecObjects(uint32_t queue_family_index, VkQueue* queue, VkCommandBuffer* command_buffer);
 
@@ -140,14 +155,35 @@ class VulkanResourceInitializer
                               VulkanResourceAllocator::MemoryData   staging_memory_data,
                               VulkanResourceAllocator::ResourceData staging_buffer_data);
 
+    // Copies data to the staging buffer after the data of previous batched uploads, submitting the batched commands
+    // first if the staging buffer does not have space for the data.  Data that is larger than the staging buffer is
+    // copied to a temporary buffer, which is released when the batched commands are submitted.
+    VkResult
+    AcquireBatchStagingData(VkDeviceSize data_size, const uint8_t* data, VkBuffer* buffer, VkDeviceSize* offset);
+
+    // Returns the command buffer that records batched commands for a queue family, beginning it if necessary.
+    VkResult GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
     void UpdateDrawDescriptorSet(VkDescriptorSet set, VkImageView view, VkSampler sampler);
 
     VkResult BeginCommandBuffer(VkCommandBuffer command_buffer);
 
     VkResult ExecuteCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
-    VkImageAspectFlags
-    GetImageTransitionAspect(VkFormat format, VkImageAspectFlagBits aspect, VkImageLayout* old_layout);
+    VkImageAspectFlags GetImageTransitionAspect(VkFormat format, VkImageAspectFlagBits aspect);
+
+    // Combined depth-stencil images are initialized once per aspect, with both aspects transitioned together.  Returns
+    // the barrier source scope and old layout for a transition of the image, where the transition for the second
+    // aspect keeps the content written for the first aspect and waits for the commands that wrote it.
+    void GetImageTransitionSource(VkImage               image,
+                                  VkImageAspectFlags    transition_aspect,
+                                  VkImageLayout         initial_layout,
+                                  VkPipelineStageFlags* src_stage,
+                                  VkAccessFlags*        src_access,
+                                  VkImageLayout*        old_layout) const;
+
+    // Records the layout that a combined depth-stencil image has after the commands recorded for one of its aspects.
+    void SetImageTransitionLayout(VkImage image, VkImageAspectFlags transition_aspect, VkImageLayout layout);
 
     uint32_t GetMemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags property_flags);
 
@@ -182,11 +218,23 @@ class VulkanResourceInitializer
         VkQueue         queue;
         VkCommandPool   command_pool;
         VkCommandBuffer command_buffer;
+        bool            recording{ false };
+    };
+
+    struct TemporaryStagingBuffer
+    {
+        VkDeviceMemory                        memory;
+        VkBuffer                              buffer;
+        VulkanResourceAllocator::MemoryData   memory_data;
+        VulkanResourceAllocator::ResourceData buffer_data;
     };
 
     // Map queue family index to command pool, command buffer, and queue objects for command processing.
     typedef std::unordered_map<uint32_t, CommandExecObjects> CommandExecObjectMap;
 
+    // Map combined depth-stencil images to their layout after the initialization of their first aspect.
+    typedef std::unordered_map<VkImage, VkImageLayout> ImageLayoutMap;
+
   private:
     VkDevice                              device_;
     CommandExecObjectMap                  command_exec_objects_;
@@ -194,6 +242,10 @@ class VulkanResourceInitializer
     VulkanResourceAllocator::MemoryData   staging_memory_data_;
     VkBuffer                              staging_buffer_;
     VulkanResourceAllocator::ResourceData staging_buffer_data_;
+    uint8_t*                              staging_mapped_data_;
+    VkDeviceSize                          staging_batch_offset_;
+    std::vector<TemporaryStagingBuffer>   temporary_staging_buffers_;
+    ImageLayoutMap                        depth_stencil_layouts_;
     VkSampler                             draw_sampler_;
     VkDescriptorPool                      draw_pool_;
     VkDescriptorSetLayout                 draw_set_layout_;
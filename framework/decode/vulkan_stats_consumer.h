@@ -35,6 +35,7 @@
 
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -68,6 +69,40 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
         return nullptr;
     }
 
+    virtual bool GetProcessedApiCalls(std::unordered_set<format::ApiCallId>* api_calls) const override
+    {
+        api_calls->insert({ format::ApiCallId::ApiCall_vkCreateInstance,
+                            format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties,
+                            format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2,
+                            format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR,
+                            format::ApiCallId::ApiCall_vkCreateDevice,
+                            format::ApiCallId::ApiCall_vkCreateGraphicsPipelines,
+                            format::ApiCallId::ApiCall_vkCreateComputePipelines,
+                            format::ApiCallId::ApiCall_vkCmdDraw,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndexed,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndirect,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD,
+                            format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD,
+                            format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV,
+                            format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV,
+                            format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV,
+                            format::ApiCallId::ApiCall_vkCmdDispatch,
+                            format::ApiCallId::ApiCall_vkCmdDispatchIndirect,
+                            format::ApiCallId::ApiCall_vkCmdDispatchBase,
+                            format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR,
+                            format::ApiCallId::ApiCall_vkAllocateMemory });
+        return true;
+    }
+
+    virtual bool GetProcessedMetaDataTypes(std::unordered_set<format::MetaDataType>* meta_data_types) const override
+    {
+        return true;
+    }
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override
     {
         // Theres should only be one of these in a capture file.
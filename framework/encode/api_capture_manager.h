@@ -45,7 +45,7 @@ class ApiCaptureManager
     // Virtual interface
     virtual void CreateStateTracker()                                                               = 0;
     virtual void DestroyStateTracker()                                                              = 0;
-    virtual void WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id) = 0;
+    virtual void WriteTrackedState(util::OutputStream* file_stream, format::ThreadId thread_id) = 0;
     virtual CaptureSettings::TraceSettings GetDefaultTraceSettings();
 
     format::ApiFamilyId GetApiFamily() const { return api_family_; }
@@ -145,6 +145,7 @@ class ApiCaptureManager
 
     bool GetIUnknownWrappingSetting() const { return common_manager_->GetIUnknownWrappingSetting(); }
     auto GetForceCommandSerialization() const { return common_manager_->GetForceCommandSerialization(); }
+    bool GetForceFrameBoundarySerialization() const { return common_manager_->GetForceFrameBoundarySerialization(); }
     auto GetQueueZeroOnly() const { return common_manager_->GetQueueZeroOnly(); }
     auto GetAllowPipelineCompileRequired() const { return common_manager_->GetAllowPipelineCompileRequired(); }
 
@@ -182,6 +183,10 @@ class ApiCaptureManager
     {
         common_manager_->WriteFillMemoryCmd(api_family_, memory_id, offset, size, data);
     }
+    void RemoveFillMemoryReference(format::HandleId memory_id)
+    {
+        common_manager_->RemoveFillMemoryReference(memory_id);
+    }
     void WriteCreateHeapAllocationCmd(uint64_t allocation_id, uint64_t allocation_size)
     {
         common_manager_->WriteCreateHeapAllocationCmd(api_family_, allocation_id, allocation_size);
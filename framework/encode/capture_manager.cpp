@@ -39,8 +39,13 @@
 #include "util/platform.h"
 
 #include <cassert>
+#include <cinttypes>
 #include <unordered_map>
 
+#if !defined(WIN32)
+#include <csignal>
+#endif
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
@@ -58,10 +63,11 @@ thread_local std::unique_ptr<CommonCaptureManager::ThreadData> CommonCaptureMana
 CommonCaptureManager::ApiCallMutexT                            CommonCaptureManager::api_call_mutex_;
 
 std::atomic<format::HandleId> CommonCaptureManager::unique_id_counter_{ format::kNullHandleId };
+std::atomic<bool>             CommonCaptureManager::flight_recorder_signal_received_{ false };
 
 CommonCaptureManager::ThreadData::ThreadData() :
     thread_id_(GetThreadId()), object_id_(format::kNullHandleId), call_id_(format::ApiCallId::ApiCall_Unknown),
-    block_index_(0)
+    block_index_(0), call_start_time_(0), writing_flight_recorder_capture_(false)
 {
     parameter_buffer_  = std::make_unique<encode::ParameterBuffer>();
     parameter_encoder_ = std::make_unique<ParameterEncoder>(parameter_buffer_.get());
@@ -98,11 +104,19 @@ CommonCaptureManager::CommonCaptureManager() :
     previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed), debug_layer_(false),
     debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false), disable_dxr_(false),
     accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false), queue_zero_only_(false),
-    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), block_index_(0)
+    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), split_frames_(0), split_size_(0),
+    segment_index_(0), segment_first_frame_(kFirstFrame), segment_bytes_(0), statistics_frames_(0),
+    statistics_first_frame_(kFirstFrame), block_index_(0)
 {}
 
 CommonCaptureManager::~CommonCaptureManager()
 {
+    // Report the frames captured since the last statistics interval ended.
+    if ((capture_statistics_ != nullptr) && (file_stream_ != nullptr))
+    {
+        WriteCaptureStatistics();
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
         memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -365,14 +379,62 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_memory_mode_        = kMemoryModeDisabled;
     }
 
-    if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty() &&
-        trace_settings.runtime_capture_trigger == CaptureSettings::RuntimeTriggerState::kNotUsed)
+    if (trace_settings.flight_recorder_frames > 0)
+    {
+        // Record all frames to memory, with state tracking enabled so that a state snapshot can be taken each time the
+        // oldest recorded frames are released. A capture file is only created when the trigger is received.
+        trim_enabled_                   = true;
+        trim_boundary_                  = CaptureSettings::TrimBoundary::kFrames;
+        trim_key_                       = trace_settings.trim_key;
+        previous_runtime_trigger_state_ = trace_settings.runtime_capture_trigger;
+        capture_mode_                   = kModeWriteAndTrack;
+
+        const uint64_t memory_limit = static_cast<uint64_t>(trace_settings.flight_recorder_memory_limit) * 1024 * 1024;
+        flight_recorder_ =
+            std::make_unique<FlightRecorder>(trace_settings.flight_recorder_frames, memory_limit, current_frame_);
+
+        if (trace_settings.flight_recorder_signal != 0)
+        {
+            InstallFlightRecorderSignalHandler(trace_settings.flight_recorder_signal);
+        }
+
+        GFXRECON_LOG_INFO("Flight recorder enabled, retaining the last %u frames in memory",
+                          trace_settings.flight_recorder_frames);
+    }
+    else if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty() &&
+             trace_settings.runtime_capture_trigger == CaptureSettings::RuntimeTriggerState::kNotUsed)
     {
-        // Use default kModeWrite capture mode.
-        success = CreateCaptureFile(api_family, base_filename_);
+        split_frames_ = trace_settings.capture_file_split_frames;
+        split_size_   = static_cast<uint64_t>(trace_settings.capture_file_split_size) * 1024 * 1024;
+
+        if (IsCaptureFileSplitEnabled())
+        {
+            // Write all frames with state tracking enabled, so that each new segment can begin with a state snapshot.
+            trim_enabled_ = true;
+            capture_mode_ = kModeWriteAndTrack;
+
+            // All segments share the timestamp of the first segment, so that they are listed together.
+            if (timestamp_filename_)
+            {
+                base_filename_      = util::filepath::GenerateTimestampedFilename(base_filename_);
+                timestamp_filename_ = false;
+            }
+
+            success = CreateCaptureSegment(api_family);
+        }
+        else
+        {
+            // Use default kModeWrite capture mode.
+            success = CreateCaptureFile(api_family, base_filename_);
+        }
     }
     else
     {
+        if ((trace_settings.capture_file_split_frames > 0) || (trace_settings.capture_file_split_size > 0))
+        {
+            GFXRECON_LOG_WARNING("Ignoring capture file split settings as a capture trigger has been specified.");
+        }
+
         GFXRECON_ASSERT(trace_settings.trim_boundary != CaptureSettings::TrimBoundary::kUnknown);
 
         // Override default kModeWrite capture mode.
@@ -449,6 +511,21 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         }
     }
 
+    if (success && (trace_settings.capture_statistics_frames > 0))
+    {
+        capture_statistics_     = std::make_unique<CaptureStatistics>();
+        statistics_frames_      = trace_settings.capture_statistics_frames;
+        statistics_first_frame_ = current_frame_;
+
+        if (compressor_ != nullptr)
+        {
+            compressor_ =
+                std::make_unique<CaptureStatisticsCompressor>(std::move(compressor_), capture_statistics_.get());
+        }
+
+        GFXRECON_LOG_INFO("Capture statistics enabled, reporting every %u frames", statistics_frames_);
+    }
+
     if (success)
     {
         if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
@@ -466,6 +543,16 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
                                            trace_settings.page_guard_signal_handler_watcher,
                                            trace_settings.page_guard_signal_handler_watcher_max_restores,
                                            mem_prot_mode);
+
+            if (capture_statistics_ != nullptr)
+            {
+                util::PageGuardManager::Get()->EnableStatistics(true);
+            }
+
+            if (trace_settings.page_guard_delta_fill_memory)
+            {
+                fill_memory_delta_tracker_ = std::make_unique<FillMemoryDeltaTracker>();
+            }
         }
     }
     else
@@ -499,6 +586,11 @@ ParameterEncoder* CommonCaptureManager::InitApiCallCapture(format::ApiCallId cal
     auto thread_data      = GetThreadData();
     thread_data->call_id_ = call_id;
 
+    if (capture_statistics_ != nullptr)
+    {
+        thread_data->call_start_time_ = util::datetime::GetTimestamp();
+    }
+
     // Reset the parameter buffer and reserve space for an uncompressed FunctionCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::FunctionCallHeader));
 
@@ -511,6 +603,11 @@ ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId
     thread_data->call_id_   = call_id;
     thread_data->object_id_ = object_id;
 
+    if (capture_statistics_ != nullptr)
+    {
+        thread_data->call_start_time_ = util::datetime::GetTimestamp();
+    }
+
     // Reset the parameter buffer and reserve space for an uncompressed MethodCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::MethodCallHeader));
 
@@ -524,6 +621,11 @@ void CommonCaptureManager::EndApiCallCapture()
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
+        if (capture_statistics_ != nullptr)
+        {
+            capture_statistics_->AddApiCall(thread_data->call_start_time_);
+        }
+
         auto parameter_buffer = thread_data->parameter_buffer_.get();
         assert((parameter_buffer != nullptr) && (thread_data->parameter_encoder_ != nullptr));
 
@@ -580,6 +682,11 @@ void CommonCaptureManager::EndMethodCallCapture()
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
+        if (capture_statistics_ != nullptr)
+        {
+            capture_statistics_->AddApiCall(thread_data->call_start_time_);
+        }
+
         auto parameter_buffer = thread_data->parameter_buffer_.get();
         assert((parameter_buffer != nullptr) && (thread_data->parameter_encoder_ != nullptr));
 
@@ -771,6 +878,201 @@ void CommonCaptureManager::CheckStartCaptureForTrackMode(format::ApiFamilyId api
     }
 }
 
+void CommonCaptureManager::CheckFlightRecorder(format::ApiFamilyId api_family)
+{
+    assert(flight_recorder_ != nullptr);
+
+    // Frame boundaries can be reached from multiple queues while holding only the shared API call lock, so dumps and
+    // snapshots are serialized with their own lock.
+    std::lock_guard<std::mutex> dump_lock(flight_recorder_dump_lock_);
+
+    bool snapshot_needed = flight_recorder_->EndFrame();
+
+    if (IsTrimHotkeyPressed() || RuntimeTriggerEnabled() || flight_recorder_signal_received_.exchange(false))
+    {
+        WriteFlightRecorderCapture(api_family);
+    }
+
+    if (snapshot_needed)
+    {
+        WriteFlightRecorderSnapshot();
+    }
+}
+
+void CommonCaptureManager::WriteFlightRecorderCapture(format::ApiFamilyId api_family)
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    // Only the blocks written by this thread while creating the capture file are routed to the file.  Blocks from
+    // other threads continue to be retained by the flight recorder.
+    thread_data->writing_flight_recorder_capture_ = true;
+
+    // Each dump is named after the last frame that it contains, so that repeated triggers do not overwrite each other.
+    const uint32_t    last_frame = current_frame_ - 1;
+    const std::string postfix    = "_flight_recorder_frame_" + std::to_string(last_frame);
+
+    bool success = CreateCaptureFile(api_family, util::filepath::InsertFilenamePostfix(base_filename_, postfix));
+    if (success)
+    {
+        const FlightRecorder::Statistics statistics      = flight_recorder_->GetStatistics();
+        const std::string                statistics_json = flight_recorder_->GetStatisticsString();
+
+        ForcedWriteAnnotation(
+            format::AnnotationType::kJson, format::kAnnotationLabelFlightRecorder, statistics_json.c_str());
+
+        flight_recorder_->WriteRetained(file_stream_.get());
+        file_stream_->Flush();
+
+        GFXRECON_LOG_INFO("Flight recorder wrote %u frames starting at frame %u (%" PRIu64
+                          " bytes retained in memory, peak %" PRIu64 " bytes)",
+                          statistics.retained_frames,
+                          statistics.oldest_frame,
+                          statistics.retained_bytes,
+                          statistics.peak_bytes);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to create capture file for flight recorder trigger");
+    }
+
+    file_stream_                                  = nullptr;
+    thread_data->writing_flight_recorder_capture_ = false;
+}
+
+void CommonCaptureManager::WriteFlightRecorderSnapshot()
+{
+    assert(flight_recorder_ != nullptr);
+
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    if (fill_memory_delta_tracker_ != nullptr)
+    {
+        fill_memory_delta_tracker_->Clear();
+    }
+
+    const int64_t       start_time      = util::datetime::GetTimestamp();
+    util::OutputStream* snapshot_stream = flight_recorder_->BeginSnapshot(current_frame_);
+
+    for (auto& manager : api_capture_managers_)
+    {
+        manager.first->WriteTrackedState(snapshot_stream, thread_data->thread_id_);
+    }
+
+    const int64_t duration = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+    flight_recorder_->EndSnapshot(duration);
+
+    if (capture_statistics_ != nullptr)
+    {
+        capture_statistics_->AddTime(CaptureStatistics::kStateSnapshotTime, start_time);
+    }
+
+    const FlightRecorder::Statistics statistics = flight_recorder_->GetStatistics();
+    GFXRECON_LOG_DEBUG("Flight recorder state snapshot for frame %u took %.2f ms (%" PRIu64
+                       " bytes retained in memory for %u frames)",
+                       current_frame_,
+                       util::datetime::ConvertTimestampToMilliseconds(duration),
+                       statistics.retained_bytes,
+                       statistics.retained_frames);
+}
+
+std::string CommonCaptureManager::CreateSegmentFilename(const std::string& base_filename, uint32_t segment_index)
+{
+    // Zero pad the segment index so that segment files sort in capture order.
+    std::string index_string = std::to_string(segment_index);
+    if (index_string.size() < 4)
+    {
+        index_string.insert(0, 4 - index_string.size(), '0');
+    }
+
+    return util::filepath::InsertFilenamePostfix(base_filename, "_segment_" + index_string);
+}
+
+bool CommonCaptureManager::CreateCaptureSegment(format::ApiFamilyId api_family)
+{
+    bool success = CreateCaptureFile(api_family, CreateSegmentFilename(base_filename_, segment_index_));
+    if (success)
+    {
+        segment_first_frame_ = current_frame_;
+
+        std::string segment_json = "{\n";
+        segment_json += "    \"segment\": " + std::to_string(segment_index_) + ",\n";
+        segment_json += "    \"first-frame\": " + std::to_string(segment_first_frame_) + "\n";
+        segment_json += "}";
+
+        ForcedWriteAnnotation(
+            format::AnnotationType::kJson, format::kAnnotationLabelCaptureSegment, segment_json.c_str());
+
+        // Only the blocks that follow the segment header count towards the segment size limit.
+        segment_bytes_ = 0;
+    }
+
+    return success;
+}
+
+// Called at the end of a frame by present and by the frame boundary commands, which hold the exclusive API call lock
+// while capture file splitting is enabled, so no other thread writes to the capture file during the switch.
+void CommonCaptureManager::CheckCaptureFileSplit(format::ApiFamilyId api_family)
+{
+    const bool frame_limit_reached = (split_frames_ > 0) && ((current_frame_ - segment_first_frame_) >= split_frames_);
+    const bool size_limit_reached  = (split_size_ > 0) && (segment_bytes_ >= split_size_);
+
+    if (frame_limit_reached || size_limit_reached)
+    {
+        DeactivateTrimming();
+
+        ++segment_index_;
+
+        if (CreateCaptureSegment(api_family))
+        {
+            const int64_t start_time = util::datetime::GetTimestamp();
+
+            // Begin the new segment with a snapshot of the current state, so that it can be replayed independently.
+            ActivateTrimming();
+
+            const int64_t duration = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+            GFXRECON_LOG_INFO("Started capture segment %u at frame %u (state snapshot took %.2f ms)",
+                              segment_index_,
+                              current_frame_,
+                              util::datetime::ConvertTimestampToMilliseconds(duration));
+        }
+        else
+        {
+            GFXRECON_LOG_FATAL("Failed to create capture file for segment %u; capture has been disabled",
+                               segment_index_);
+            trim_enabled_ = false;
+            capture_mode_ = kModeDisabled;
+            for (auto& manager_it : api_capture_managers_)
+            {
+                manager_it.first->DestroyStateTracker();
+            }
+            compressor_ = nullptr;
+        }
+    }
+}
+
+void CommonCaptureManager::WriteCaptureStatistics()
+{
+    assert(capture_statistics_ != nullptr);
+
+    // The statistics cover the frames that ended since the previous report.  The interval is restarted when capture
+    // is not writing, so that each report only describes the frames in the file that it is written to.
+    const uint32_t last_frame = current_frame_ - 1;
+
+    if (last_frame >= statistics_first_frame_)
+    {
+        util::PageGuardManager* page_guard_manager = util::PageGuardManager::Get();
+        const std::string       statistics_json =
+            capture_statistics_->GetIntervalString(statistics_first_frame_, last_frame, page_guard_manager);
+
+        WriteAnnotation(
+            format::AnnotationType::kJson, format::kAnnotationLabelCaptureStatistics, statistics_json.c_str());
+    }
+
+    statistics_first_frame_ = current_frame_;
+}
+
 bool CommonCaptureManager::ShouldTriggerScreenshot()
 {
     bool triger_screenshot = false;
@@ -820,7 +1122,23 @@ void CommonCaptureManager::EndFrame(format::ApiFamilyId api_family)
 
     ++current_frame_;
 
-    if (trim_enabled_ && (trim_boundary_ == CaptureSettings::TrimBoundary::kFrames))
+    if ((capture_statistics_ != nullptr) && ((current_frame_ - statistics_first_frame_) >= statistics_frames_))
+    {
+        WriteCaptureStatistics();
+    }
+
+    if (flight_recorder_ != nullptr)
+    {
+        CheckFlightRecorder(api_family);
+    }
+    else if (IsCaptureFileSplitEnabled())
+    {
+        if ((capture_mode_ & kModeWrite) == kModeWrite)
+        {
+            CheckCaptureFileSplit(api_family);
+        }
+    }
+    else if (trim_enabled_ && (trim_boundary_ == CaptureSettings::TrimBoundary::kFrames))
     {
         if ((capture_mode_ & kModeWrite) == kModeWrite)
         {
@@ -970,13 +1288,26 @@ void CommonCaptureManager::ActivateTrimming()
 {
     capture_mode_ |= kModeWrite;
 
+    // The state snapshot replaces the memory content that fill memory deltas would be applied to.
+    if (fill_memory_delta_tracker_ != nullptr)
+    {
+        fill_memory_delta_tracker_->Clear();
+    }
+
     auto thread_data = GetThreadData();
     assert(thread_data != nullptr);
 
+    const int64_t start_time = util::datetime::GetTimestamp();
+
     for (auto& manager : api_capture_managers_)
     {
         manager.first->WriteTrackedState(file_stream_.get(), thread_data->thread_id_);
     }
+
+    if (capture_statistics_ != nullptr)
+    {
+        capture_statistics_->AddTime(CaptureStatistics::kStateSnapshotTime, start_time);
+    }
 }
 
 void CommonCaptureManager::DeactivateTrimming()
@@ -1120,6 +1451,26 @@ void CommonCaptureManager::WriteFillMemoryCmd(
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
+        // Deltas are limited to Vulkan, as the D3D12 resource value optimization associates resource values with
+        // complete fill memory commands.
+        if ((fill_memory_delta_tracker_ != nullptr) && (api_family == format::ApiFamilyId::ApiFamily_Vulkan))
+        {
+            uint64_t span_count = 0;
+
+            if (fill_memory_delta_tracker_->Update(
+                    memory_id, offset, size, uncompressed_data, &thread_data->fill_memory_delta_buffer_, &span_count))
+            {
+                // When no spans were produced, the memory content has not changed since it was last written.
+                if (span_count > 0)
+                {
+                    WriteFillMemoryDeltaCmd(
+                        api_family, memory_id, offset, size, span_count, thread_data->fill_memory_delta_buffer_);
+                }
+
+                return;
+            }
+        }
+
         fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
         fill_cmd.meta_header.meta_data_id =
             format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryCommand);
@@ -1163,6 +1514,68 @@ void CommonCaptureManager::WriteFillMemoryCmd(
     }
 }
 
+void CommonCaptureManager::WriteFillMemoryDeltaCmd(format::ApiFamilyId         api_family,
+                                                   format::HandleId            memory_id,
+                                                   uint64_t                    offset,
+                                                   uint64_t                    size,
+                                                   uint64_t                    span_count,
+                                                   const std::vector<uint8_t>& delta)
+{
+    format::FillMemoryDeltaCommandHeader delta_cmd;
+    size_t                               header_size       = sizeof(format::FillMemoryDeltaCommandHeader);
+    const uint8_t*                       uncompressed_data = delta.data();
+    size_t                               uncompressed_size = delta.size();
+
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    delta_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    delta_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryDeltaCommand);
+    delta_cmd.thread_id     = thread_data->thread_id_;
+    delta_cmd.memory_id     = memory_id;
+    delta_cmd.memory_offset = offset;
+    delta_cmd.memory_size   = size;
+    delta_cmd.span_count    = span_count;
+    delta_cmd.data_size     = uncompressed_size;
+
+    bool not_compressed = true;
+
+    if (compressor_ != nullptr)
+    {
+        size_t compressed_size = compressor_->Compress(
+            uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+
+        if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+        {
+            not_compressed = false;
+
+            // As with fill memory commands, the header includes the uncompressed size, so only the type changes.
+            delta_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            delta_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(delta_cmd) + compressed_size;
+
+            util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &delta_cmd, header_size);
+
+            WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+        }
+    }
+
+    if (not_compressed)
+    {
+        delta_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(delta_cmd) + uncompressed_size;
+
+        CombineAndWriteToFile({ { &delta_cmd, header_size }, { uncompressed_data, uncompressed_size } });
+    }
+}
+
+void CommonCaptureManager::RemoveFillMemoryReference(format::HandleId memory_id)
+{
+    if (fill_memory_delta_tracker_ != nullptr)
+    {
+        fill_memory_delta_tracker_->RemoveReference(memory_id);
+    }
+}
+
 void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family,
                                                         uint64_t            allocation_id,
                                                         uint64_t            allocation_size)
@@ -1202,10 +1615,29 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size)
         }
     }
 
-    file_stream_->Write(data, size);
+    const int64_t start_time = (capture_statistics_ != nullptr) ? util::datetime::GetTimestamp() : 0;
+
+    // In flight recorder mode, blocks are retained in memory until the flight recorder is triggered.
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    util::OutputStream* output_stream = file_stream_.get();
+    if ((flight_recorder_ != nullptr) && !thread_data->writing_flight_recorder_capture_)
+    {
+        output_stream = flight_recorder_.get();
+    }
+
+    output_stream->Write(data, size);
+    segment_bytes_ += size;
     if (force_file_flush_)
     {
-        file_stream_->Flush();
+        output_stream->Flush();
+    }
+
+    if (capture_statistics_ != nullptr)
+    {
+        capture_statistics_->AddTime(CaptureStatistics::kWriteTime, start_time);
+        capture_statistics_->AddBlock(data, size);
     }
 
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
@@ -1219,9 +1651,6 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size)
     }
 
     // Increment block index
-    auto thread_data = GetThreadData();
-    assert(thread_data != nullptr);
-
     ++block_index_;
     thread_data->block_index_ = block_index_.load();
 }
@@ -1239,6 +1668,32 @@ void CommonCaptureManager::AtExit()
     }
 }
 
+void CommonCaptureManager::InstallFlightRecorderSignalHandler(int signal_number)
+{
+#if defined(WIN32)
+    GFXRECON_UNREFERENCED_PARAMETER(signal_number);
+    GFXRECON_LOG_WARNING("Ignoring flight recorder signal option on unsupported platform (Windows)");
+#else
+    struct sigaction action = {};
+    action.sa_handler       = FlightRecorderSignalHandler;
+    action.sa_flags         = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    if (sigaction(signal_number, &action, nullptr) != 0)
+    {
+        GFXRECON_LOG_WARNING("Failed to install flight recorder handler for signal %d", signal_number);
+    }
+#endif
+}
+
+void CommonCaptureManager::FlightRecorderSignalHandler(int signal_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(signal_number);
+
+    // The capture file is written by the next frame boundary; only async-signal-safe work is performed here.
+    flight_recorder_signal_received_ = true;
+}
+
 void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation)
 {
     CaptureSettings::TraceSettings default_settings = default_settings_.GetTraceSettings();
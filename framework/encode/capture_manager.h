@@ -26,6 +26,9 @@
 #define GFXRECON_ENCODE_CAPTURE_MANAGER_H
 
 #include "encode/capture_settings.h"
+#include "encode/capture_statistics.h"
+#include "encode/fill_memory_delta_tracker.h"
+#include "encode/flight_recorder.h"
 #include "encode/handle_unwrap_memory.h"
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
@@ -154,6 +157,12 @@ class CommonCaptureManager
 
     bool GetIUnknownWrappingSetting() const { return iunknown_wrapping_; }
     auto GetForceCommandSerialization() const { return force_command_serialization_; }
+    // Queue submissions that can end a frame take the exclusive API call lock when ending the frame can switch to a new
+    // capture file, so that no other thread writes to the capture file while the state snapshot is written.
+    bool GetForceFrameBoundarySerialization() const
+    {
+        return force_command_serialization_ || IsCaptureFileSplitEnabled();
+    }
     auto GetQueueZeroOnly() const { return queue_zero_only_; }
     auto GetAllowPipelineCompileRequired() const { return allow_pipeline_compile_required_; }
 
@@ -212,7 +221,10 @@ class CommonCaptureManager
         std::unique_ptr<ParameterEncoder>        parameter_encoder_;
         std::vector<uint8_t>                     compressed_buffer_;
         HandleUnwrapMemory                       handle_unwrap_memory_;
+        std::vector<uint8_t>                     fill_memory_delta_buffer_;
         uint64_t                                 block_index_;
+        int64_t                                  call_start_time_;
+        bool                                     writing_flight_recorder_capture_;
 
       private:
         static format::ThreadId GetThreadId();
@@ -283,10 +295,38 @@ class CommonCaptureManager
     void WriteFillMemoryCmd(
         format::ApiFamilyId api_family, format::HandleId memory_id, uint64_t offset, uint64_t size, const void* data);
 
+    void WriteFillMemoryDeltaCmd(format::ApiFamilyId         api_family,
+                                 format::HandleId            memory_id,
+                                 uint64_t                    offset,
+                                 uint64_t                    size,
+                                 uint64_t                    span_count,
+                                 const std::vector<uint8_t>& delta);
+
+    // Release the reference data used to encode fill memory deltas for a memory object that is no longer mapped.
+    void RemoveFillMemoryReference(format::HandleId memory_id);
+
     void WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family, uint64_t allocation_id, uint64_t allocation_size);
 
     void WriteToFile(const void* data, size_t size);
 
+    bool IsFlightRecorderEnabled() const { return flight_recorder_ != nullptr; }
+
+    void CheckFlightRecorder(format::ApiFamilyId api_family);
+
+    void WriteFlightRecorderCapture(format::ApiFamilyId api_family);
+
+    void WriteFlightRecorderSnapshot();
+
+    bool IsCaptureFileSplitEnabled() const { return (split_frames_ > 0) || (split_size_ > 0); }
+
+    std::string CreateSegmentFilename(const std::string& base_filename, uint32_t segment_index);
+
+    bool CreateCaptureSegment(format::ApiFamilyId api_family);
+
+    void CheckCaptureFileSplit(format::ApiFamilyId api_family);
+
+    void WriteCaptureStatistics();
+
     template <size_t N>
     void CombineAndWriteToFile(const std::pair<const void*, size_t> (&buffers)[N])
     {
@@ -322,12 +362,17 @@ class CommonCaptureManager
   private:
     static void AtExit();
 
+    static void InstallFlightRecorderSignalHandler(int signal_number);
+
+    static void FlightRecorderSignalHandler(int signal_number);
+
   private:
     static std::mutex                               instance_lock_;
     static CommonCaptureManager*                    singleton_;
     static thread_local std::unique_ptr<ThreadData> thread_data_;
     static std::atomic<format::HandleId>            unique_id_counter_;
     static ApiCallMutexT                            api_call_mutex_;
+    static std::atomic<bool>                        flight_recorder_signal_received_;
 
     uint32_t instance_count_ = 0;
     struct ApiInstanceRecord
@@ -343,6 +388,8 @@ class CommonCaptureManager
         capture_settings_; // Settings from the settings file and environment at capture manager creation time.
 
     std::unique_ptr<util::FileOutputStream> file_stream_;
+    std::unique_ptr<FlightRecorder>         flight_recorder_;
+    std::mutex                              flight_recorder_dump_lock_;
     format::EnabledOptions                  file_options_;
     std::string                             base_filename_;
     bool                                    timestamp_filename_;
@@ -357,6 +404,7 @@ class CommonCaptureManager
     bool                                    page_guard_separate_read_;
     bool                                    page_guard_copy_on_map_;
     bool                                    page_guard_external_memory_;
+    std::unique_ptr<FillMemoryDeltaTracker> fill_memory_delta_tracker_;
     bool                                    trim_enabled_;
     CaptureSettings::TrimBoundary           trim_boundary_;
     std::vector<util::UintRange>            trim_ranges_;
@@ -380,6 +428,14 @@ class CommonCaptureManager
     bool                                    queue_zero_only_;
     bool                                    allow_pipeline_compile_required_;
     bool                                    quit_after_frame_ranges_;
+    uint32_t                                split_frames_;
+    uint64_t                                split_size_;
+    uint32_t                                segment_index_;
+    uint32_t                                segment_first_frame_;
+    std::atomic<uint64_t>                   segment_bytes_;
+    std::unique_ptr<CaptureStatistics>      capture_statistics_;
+    uint32_t                                statistics_frames_;
+    uint32_t                                statistics_first_frame_;
 
     struct
     {
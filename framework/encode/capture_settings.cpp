@@ -94,6 +94,18 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_IUNKNOWN_WRAPPING_UPPER                      "CAPTURE_IUNKNOWN_WRAPPING"
 #define CAPTURE_QUEUE_SUBMITS_LOWER                          "capture_queue_submits"
 #define CAPTURE_QUEUE_SUBMITS_UPPER                          "CAPTURE_QUEUE_SUBMITS"
+#define CAPTURE_FLIGHT_RECORDER_FRAMES_LOWER                 "capture_flight_recorder_frames"
+#define CAPTURE_FLIGHT_RECORDER_FRAMES_UPPER                 "CAPTURE_FLIGHT_RECORDER_FRAMES"
+#define CAPTURE_FLIGHT_RECORDER_MEMORY_LIMIT_LOWER           "capture_flight_recorder_memory_limit"
+#define CAPTURE_FLIGHT_RECORDER_MEMORY_LIMIT_UPPER           "CAPTURE_FLIGHT_RECORDER_MEMORY_LIMIT"
+#define CAPTURE_FLIGHT_RECORDER_SIGNAL_LOWER                 "capture_flight_recorder_signal"
+#define CAPTURE_FLIGHT_RECORDER_SIGNAL_UPPER                 "CAPTURE_FLIGHT_RECORDER_SIGNAL"
+#define CAPTURE_FILE_SPLIT_FRAMES_LOWER                      "capture_file_split_frames"
+#define CAPTURE_FILE_SPLIT_FRAMES_UPPER                      "CAPTURE_FILE_SPLIT_FRAMES"
+#define CAPTURE_FILE_SPLIT_SIZE_LOWER                        "capture_file_split_size"
+#define CAPTURE_FILE_SPLIT_SIZE_UPPER                        "CAPTURE_FILE_SPLIT_SIZE"
+#define CAPTURE_STATISTICS_FRAMES_LOWER                      "capture_statistics_frames"
+#define CAPTURE_STATISTICS_FRAMES_UPPER                      "CAPTURE_STATISTICS_FRAMES"
 #define PAGE_GUARD_COPY_ON_MAP_LOWER                         "page_guard_copy_on_map"
 #define PAGE_GUARD_COPY_ON_MAP_UPPER                         "PAGE_GUARD_COPY_ON_MAP"
 #define PAGE_GUARD_SEPARATE_READ_LOWER                       "page_guard_separate_read"
@@ -108,6 +120,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define PAGE_GUARD_EXTERNAL_MEMORY_UPPER                     "PAGE_GUARD_EXTERNAL_MEMORY"
 #define PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER                     "page_guard_unblock_sigsegv"
 #define PAGE_GUARD_UNBLOCK_SIGSEGV_UPPER                     "PAGE_GUARD_UNBLOCK_SIGSEGV"
+#define PAGE_GUARD_DELTA_FILL_MEMORY_LOWER                   "page_guard_delta_fill_memory"
+#define PAGE_GUARD_DELTA_FILL_MEMORY_UPPER                   "PAGE_GUARD_DELTA_FILL_MEMORY"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER              "page_guard_signal_handler_watcher"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER              "PAGE_GUARD_SIGNAL_HANDLER_WATCHER"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER "page_guard_signal_handler_watcher_max_restores"
@@ -166,6 +180,12 @@ const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_LOWER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_LOWER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_LOWER;
+const char kCaptureFlightRecorderFramesEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_FRAMES_LOWER;
+const char kCaptureFlightRecorderMemoryLimitEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_MEMORY_LIMIT_LOWER;
+const char kCaptureFlightRecorderSignalEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_SIGNAL_LOWER;
+const char kCaptureFileSplitFramesEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SPLIT_FRAMES_LOWER;
+const char kCaptureFileSplitSizeEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SPLIT_SIZE_LOWER;
+const char kCaptureStatisticsFramesEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_STATISTICS_FRAMES_LOWER;
 const char kPageGuardCopyOnMapEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
 const char kPageGuardSeparateReadEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
 const char kPageGuardPersistentMemoryEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
@@ -173,6 +193,7 @@ const char kPageGuardAlignBufferSizesEnvVar[]                = GFXRECON_ENV_VAR_
 const char kPageGuardTrackAhbMemoryEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_LOWER;
 const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_LOWER;
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER;
+const char kPageGuardDeltaFillMemoryEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_DELTA_FILL_MEMORY_LOWER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_LOWER;
@@ -222,12 +243,19 @@ const char kPageGuardAlignBufferSizesEnvVar[]                = GFXRECON_ENV_VAR_
 const char kPageGuardTrackAhbMemoryEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_UPPER;
 const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_UPPER;
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_UPPER;
+const char kPageGuardDeltaFillMemoryEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_DELTA_FILL_MEMORY_UPPER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER;
 const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_UPPER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_UPPER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_UPPER;
+const char kCaptureFlightRecorderFramesEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_FRAMES_UPPER;
+const char kCaptureFlightRecorderMemoryLimitEnvVar[]         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_MEMORY_LIMIT_UPPER;
+const char kCaptureFlightRecorderSignalEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_FLIGHT_RECORDER_SIGNAL_UPPER;
+const char kCaptureFileSplitFramesEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SPLIT_FRAMES_UPPER;
+const char kCaptureFileSplitSizeEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SPLIT_SIZE_UPPER;
+const char kCaptureStatisticsFramesEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_STATISTICS_FRAMES_UPPER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_UPPER;
 const char kDebugDeviceLostEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX DEBUG_DEVICE_LOST_UPPER;
 const char kDisableDxrEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DISABLE_DXR_UPPER;
@@ -270,6 +298,12 @@ const std::string kOptionKeyCaptureTrigger                           = std::stri
 const std::string kOptionKeyCaptureTriggerFrames                     = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_FRAMES_LOWER);
 const std::string kOptionKeyCaptureIUnknownWrapping                  = std::string(kSettingsFilter) + std::string(CAPTURE_IUNKNOWN_WRAPPING_LOWER);
 const std::string kOptionKeyCaptureQueueSubmits                      = std::string(kSettingsFilter) + std::string(CAPTURE_QUEUE_SUBMITS_LOWER);
+const std::string kOptionKeyCaptureFlightRecorderFrames              = std::string(kSettingsFilter) + std::string(CAPTURE_FLIGHT_RECORDER_FRAMES_LOWER);
+const std::string kOptionKeyCaptureFlightRecorderMemoryLimit         = std::string(kSettingsFilter) + std::string(CAPTURE_FLIGHT_RECORDER_MEMORY_LIMIT_LOWER);
+const std::string kOptionKeyCaptureFlightRecorderSignal              = std::string(kSettingsFilter) + std::string(CAPTURE_FLIGHT_RECORDER_SIGNAL_LOWER);
+const std::string kOptionKeyCaptureFileSplitFrames                   = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_SPLIT_FRAMES_LOWER);
+const std::string kOptionKeyCaptureFileSplitSize                     = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_SPLIT_SIZE_LOWER);
+const std::string kOptionKeyCaptureStatisticsFrames                 = std::string(kSettingsFilter) + std::string(CAPTURE_STATISTICS_FRAMES_LOWER);
 const std::string kOptionKeyPageGuardCopyOnMap                       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
 const std::string kOptionKeyPageGuardSeparateRead                    = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
 const std::string kOptionKeyPageGuardPersistentMemory                = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
@@ -277,6 +311,7 @@ const std::string kOptionKeyPageGuardAlignBufferSizes                = std::stri
 const std::string kOptionKeyPageGuardTrackAhbMemory                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_TRACK_AHB_MEMORY_LOWER);
 const std::string kOptionKeyPageGuardExternalMemory                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_EXTERNAL_MEMORY_LOWER);
 const std::string kOptionKeyPageGuardUnblockSigSegV                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER);
+const std::string kOptionKeyPageGuardDeltaFillMemory                 = std::string(kSettingsFilter) + std::string(PAGE_GUARD_DELTA_FILL_MEMORY_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcher            = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcherMaxRestores = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER);
 const std::string kDebugLayer                                        = std::string(kSettingsFilter) + std::string(DEBUG_LAYER_LOWER);
@@ -407,6 +442,12 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureTriggerEnvVar, kOptionKeyCaptureTrigger);
     LoadSingleOptionEnvVar(options, kCaptureTriggerFramesEnvVar, kOptionKeyCaptureTriggerFrames);
     LoadSingleOptionEnvVar(options, kCaptureQueueSubmitsEnvVar, kOptionKeyCaptureQueueSubmits);
+    LoadSingleOptionEnvVar(options, kCaptureFlightRecorderFramesEnvVar, kOptionKeyCaptureFlightRecorderFrames);
+    LoadSingleOptionEnvVar(options, kCaptureFlightRecorderMemoryLimitEnvVar, kOptionKeyCaptureFlightRecorderMemoryLimit);
+    LoadSingleOptionEnvVar(options, kCaptureFlightRecorderSignalEnvVar, kOptionKeyCaptureFlightRecorderSignal);
+    LoadSingleOptionEnvVar(options, kCaptureFileSplitFramesEnvVar, kOptionKeyCaptureFileSplitFrames);
+    LoadSingleOptionEnvVar(options, kCaptureFileSplitSizeEnvVar, kOptionKeyCaptureFileSplitSize);
+    LoadSingleOptionEnvVar(options, kCaptureStatisticsFramesEnvVar, kOptionKeyCaptureStatisticsFrames);
 
     // Page guard environment variables
     LoadSingleOptionEnvVar(options, kPageGuardCopyOnMapEnvVar, kOptionKeyPageGuardCopyOnMap);
@@ -416,6 +457,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kPageGuardTrackAhbMemoryEnvVar, kOptionKeyPageGuardTrackAhbMemory);
     LoadSingleOptionEnvVar(options, kPageGuardExternalMemoryEnvVar, kOptionKeyPageGuardExternalMemory);
     LoadSingleOptionEnvVar(options, kPageGuardUnblockSIGSEGVEnvVar, kOptionKeyPageGuardUnblockSigSegV);
+    LoadSingleOptionEnvVar(options, kPageGuardDeltaFillMemoryEnvVar, kOptionKeyPageGuardDeltaFillMemory);
     LoadSingleOptionEnvVar(options, kPageGuardSignalHandlerWatcherEnvVar, kOptionKeyPageGuardSignalHandlerWatcher);
     LoadSingleOptionEnvVar(
         options, kPageGuardSignalHandlerWatcherMaxRestoresEnvVar, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores);
@@ -544,6 +586,53 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.quit_after_frame_ranges = ParseBoolString(
         FindOption(options, kOptionKeyQuitAfterCaptureFrames), settings->trace_settings_.quit_after_frame_ranges);
 
+    // Flight recorder options:
+    // The flight recorder is mutually exclusive with trim ranges, and reuses the trim key as its trigger.
+    uint32_t flight_recorder_frames = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureFlightRecorderFrames), settings->trace_settings_.flight_recorder_frames);
+    if (flight_recorder_frames > 0)
+    {
+        if (settings->trace_settings_.trim_ranges.empty())
+        {
+            settings->trace_settings_.flight_recorder_frames = flight_recorder_frames;
+            settings->trace_settings_.trim_boundary          = TrimBoundary::kFrames;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING(
+                "Settings Loader: Ignoring flight recorder setting as trim ranges has been specified.");
+        }
+    }
+    settings->trace_settings_.flight_recorder_memory_limit =
+        gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureFlightRecorderMemoryLimit),
+                                        settings->trace_settings_.flight_recorder_memory_limit);
+    settings->trace_settings_.flight_recorder_signal =
+        ParseIntegerString(FindOption(options, kOptionKeyCaptureFlightRecorderSignal),
+                           settings->trace_settings_.flight_recorder_signal);
+
+    // Capture file split options:
+    // Splitting requires state tracking for the whole capture, so it is mutually exclusive with trimming.
+    uint32_t split_frames = gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureFileSplitFrames),
+                                                            settings->trace_settings_.capture_file_split_frames);
+    uint32_t split_size   = gfxrecon::util::ParseUintString(FindOption(options, kOptionKeyCaptureFileSplitSize),
+                                                          settings->trace_settings_.capture_file_split_size);
+    if ((split_frames > 0) || (split_size > 0))
+    {
+        if (settings->trace_settings_.trim_boundary == TrimBoundary::kUnknown)
+        {
+            settings->trace_settings_.capture_file_split_frames = split_frames;
+            settings->trace_settings_.capture_file_split_size   = split_size;
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Settings Loader: Ignoring capture file split settings as trimming or the flight "
+                                 "recorder has been specified.");
+        }
+    }
+
+    settings->trace_settings_.capture_statistics_frames = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureStatisticsFrames), settings->trace_settings_.capture_statistics_frames);
+
     // Page guard environment variables
     settings->trace_settings_.page_guard_copy_on_map = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardCopyOnMap), settings->trace_settings_.page_guard_copy_on_map);
@@ -561,6 +650,9 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
         FindOption(options, kOptionKeyPageGuardExternalMemory), settings->trace_settings_.page_guard_external_memory);
     settings->trace_settings_.page_guard_unblock_sigsegv = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardUnblockSigSegV), settings->trace_settings_.page_guard_unblock_sigsegv);
+    settings->trace_settings_.page_guard_delta_fill_memory =
+        ParseBoolString(FindOption(options, kOptionKeyPageGuardDeltaFillMemory),
+                        settings->trace_settings_.page_guard_delta_fill_memory);
     settings->trace_settings_.page_guard_signal_handler_watcher =
         ParseBoolString(FindOption(options, kOptionKeyPageGuardSignalHandlerWatcher),
                         settings->trace_settings_.page_guard_signal_handler_watcher);
@@ -110,6 +110,7 @@ class CaptureSettings
         bool                         page_guard_track_ahb_memory{ false };
         bool                         page_guard_unblock_sigsegv{ false };
         bool                         page_guard_signal_handler_watcher{ false };
+        bool                         page_guard_delta_fill_memory{ false };
         bool                         debug_layer{ false };
         bool                         debug_device_lost{ false };
         bool                         disable_dxr{ false };
@@ -119,6 +120,24 @@ class CaptureSettings
         bool                         allow_pipeline_compile_required{ false };
         bool                         quit_after_frame_ranges{ false };
 
+        // Flight recorder mode keeps the last flight_recorder_frames frames in memory, together with a state snapshot
+        // for the oldest retained frame, and only writes them to a capture file when the trim key, runtime trigger,
+        // or flight_recorder_signal (non-Windows platforms) is received. The memory limit is specified in MiB, with 0
+        // indicating no limit.
+        uint32_t flight_recorder_frames{ 0 };
+        uint32_t flight_recorder_memory_limit{ 0 };
+        int      flight_recorder_signal{ 0 };
+
+        // Capture file splitting closes the current capture file and starts a new segment after the specified number
+        // of frames, or once the current segment exceeds the specified size in MiB.  Each segment begins with a state
+        // snapshot, so that it can be replayed independently.  A value of 0 disables the corresponding limit.
+        uint32_t capture_file_split_frames{ 0 };
+        uint32_t capture_file_split_size{ 0 };
+
+        // Number of frames between the capture statistics annotations that report capture overhead, with 0 indicating
+        // that statistics are not collected.
+        uint32_t capture_statistics_frames{ 0 };
+
         // An optimization for the page_guard memory tracking mode that eliminates the need for shadow memory by
         // overriding vkAllocateMemory so that all host visible allocations use the external memory extension with a
         // memory allocation that the capture layer can monitor to determine which regions of memory have been modified
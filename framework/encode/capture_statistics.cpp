@@ -0,0 +1,247 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/capture_statistics.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cstddef>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Names used for the per block type entries of the statistics string, indexed by block type.
+static const char* const kBlockTypeNames[CaptureStatistics::kBlockTypeCount] = {
+    "unknown", "frame-marker", "state-marker", "meta-data", "function-call", "annotation", "method-call"
+};
+
+static const char* const kTimerNames[CaptureStatistics::kTimerCount] = {
+    "encode-time-ns", "compress-time-ns", "write-time-ns", "state-snapshot-time-ns"
+};
+
+std::atomic<uint64_t>                    CaptureStatistics::next_id_{ 1 };
+thread_local CaptureStatistics::ThreadSlot CaptureStatistics::thread_slot_;
+
+CaptureStatistics::CaptureStatistics() : id_(next_id_++) {}
+
+CaptureStatistics::~CaptureStatistics() {}
+
+CaptureStatistics::ThreadCounters* CaptureStatistics::GetThreadCounters()
+{
+    ThreadSlot& slot = thread_slot_;
+
+    // The slot may hold counters registered with a previous CaptureStatistics object, which are replaced.
+    if (slot.owner_id != id_)
+    {
+        auto counters = std::make_shared<ThreadCounters>();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            thread_counters_.push_back(counters);
+        }
+
+        slot.owner_id = id_;
+        slot.counters = std::move(counters);
+    }
+
+    return slot.counters.get();
+}
+
+void CaptureStatistics::AddTime(Timer timer, int64_t start_time)
+{
+    assert(timer < kTimerCount);
+
+    const int64_t duration = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+    Increment(GetThreadCounters()->timers[timer], static_cast<uint64_t>(duration));
+}
+
+void CaptureStatistics::AddApiCall(int64_t start_time)
+{
+    ThreadCounters* counters = GetThreadCounters();
+
+    const int64_t duration = util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp());
+    Increment(counters->timers[kEncodeTime], static_cast<uint64_t>(duration));
+    Increment(counters->api_call_count, 1);
+}
+
+void CaptureStatistics::AddCompression(size_t input_size, size_t output_size)
+{
+    ThreadCounters* counters = GetThreadCounters();
+    Increment(counters->compress_input_bytes, input_size);
+    Increment(counters->compress_output_bytes, output_size);
+}
+
+void CaptureStatistics::AddBlock(const void* data, size_t size)
+{
+    assert(data != nullptr);
+
+    size_t index = format::BlockType::kUnknownBlock;
+    if (size >= sizeof(format::BlockHeader))
+    {
+        format::BlockType type = format::BlockType::kUnknownBlock;
+        util::platform::MemoryCopy(&type,
+                                   sizeof(type),
+                                   reinterpret_cast<const uint8_t*>(data) + offsetof(format::BlockHeader, type),
+                                   sizeof(type));
+
+        index = format::RemoveCompressedBlockBit(type);
+        if (index >= kBlockTypeCount)
+        {
+            index = format::BlockType::kUnknownBlock;
+        }
+    }
+
+    ThreadCounters* counters = GetThreadCounters();
+    Increment(counters->block_count[index], 1);
+    Increment(counters->block_bytes[index], size);
+}
+
+void CaptureStatistics::Accumulate(const ThreadCounters& counters, Totals* totals)
+{
+    totals->api_call_count += counters.api_call_count.load(std::memory_order_relaxed);
+    totals->compress_input_bytes += counters.compress_input_bytes.load(std::memory_order_relaxed);
+    totals->compress_output_bytes += counters.compress_output_bytes.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < kTimerCount; ++i)
+    {
+        totals->timers[i] += counters.timers[i].load(std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < kBlockTypeCount; ++i)
+    {
+        totals->block_count[i] += counters.block_count[i].load(std::memory_order_relaxed);
+        totals->block_bytes[i] += counters.block_bytes[i].load(std::memory_order_relaxed);
+    }
+}
+
+CaptureStatistics::Totals CaptureStatistics::GetTotals()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Counters that are no longer referenced by a thread slot belong to threads that have exited, so their values are
+    // moved to the retired totals.
+    for (auto iter = thread_counters_.begin(); iter != thread_counters_.end();)
+    {
+        if (iter->use_count() == 1)
+        {
+            Accumulate(**iter, &retired_);
+            iter = thread_counters_.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    Totals totals = retired_;
+    for (const auto& counters : thread_counters_)
+    {
+        Accumulate(*counters, &totals);
+    }
+
+    return totals;
+}
+
+std::string CaptureStatistics::GetIntervalString(uint32_t                first_frame,
+                                                 uint32_t                last_frame,
+                                                 util::PageGuardManager* page_guard_manager)
+{
+    const Totals totals = GetTotals();
+
+    std::string result = "{\n";
+    result += "    \"first-frame\": " + std::to_string(first_frame) + ",\n";
+    result += "    \"last-frame\": " + std::to_string(last_frame) + ",\n";
+    result += "    \"api-calls\": " + std::to_string(totals.api_call_count - previous_.api_call_count) + ",\n";
+
+    for (size_t i = 0; i < kTimerCount; ++i)
+    {
+        result += "    \"" + std::string(kTimerNames[i]) +
+                  "\": " + std::to_string(totals.timers[i] - previous_.timers[i]) + ",\n";
+    }
+
+    result += "    \"compress-input-bytes\": " +
+              std::to_string(totals.compress_input_bytes - previous_.compress_input_bytes) + ",\n";
+    result += "    \"compress-output-bytes\": " +
+              std::to_string(totals.compress_output_bytes - previous_.compress_output_bytes) + ",\n";
+
+    if (page_guard_manager != nullptr)
+    {
+        const util::PageGuardManager::Statistics page_guard = page_guard_manager->GetStatistics();
+
+        result += "    \"page-guard-faults\": " +
+                  std::to_string(page_guard.fault_count - previous_page_guard_.fault_count) + ",\n";
+        result += "    \"page-guard-fault-time-ns\": " +
+                  std::to_string(page_guard.fault_time - previous_page_guard_.fault_time) + ",\n";
+        result += "    \"page-guard-process-calls\": " +
+                  std::to_string(page_guard.process_count - previous_page_guard_.process_count) + ",\n";
+        result += "    \"page-guard-process-time-ns\": " +
+                  std::to_string(page_guard.process_time - previous_page_guard_.process_time) + ",\n";
+        result += "    \"page-guard-modified-bytes\": " +
+                  std::to_string(page_guard.modified_bytes - previous_page_guard_.modified_bytes) + ",\n";
+
+        previous_page_guard_ = page_guard;
+    }
+
+    result += "    \"blocks\": {";
+
+    bool first_entry = true;
+    for (size_t i = 0; i < kBlockTypeCount; ++i)
+    {
+        const uint64_t count = totals.block_count[i] - previous_.block_count[i];
+        if (count > 0)
+        {
+            result += first_entry ? "\n" : ",\n";
+            result += "        \"" + std::string(kBlockTypeNames[i]) + "\": { \"count\": " + std::to_string(count) +
+                      ", \"bytes\": " + std::to_string(totals.block_bytes[i] - previous_.block_bytes[i]) + " }";
+            first_entry = false;
+        }
+    }
+
+    result += first_entry ? "}\n" : "\n    }\n";
+    result += "}";
+
+    previous_ = totals;
+
+    return result;
+}
+
+size_t CaptureStatisticsCompressor::Compress(const size_t          uncompressed_size,
+                                             const uint8_t*        uncompressed_data,
+                                             std::vector<uint8_t>* compressed_data,
+                                             size_t                compressed_data_offset)
+{
+    const int64_t start_time = util::datetime::GetTimestamp();
+
+    size_t compressed_size =
+        compressor_->Compress(uncompressed_size, uncompressed_data, compressed_data, compressed_data_offset);
+
+    statistics_->AddTime(CaptureStatistics::kCompressTime, start_time);
+    statistics_->AddCompression(uncompressed_size, compressed_size);
+
+    return compressed_size;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
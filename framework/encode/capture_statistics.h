@@ -0,0 +1,167 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_CAPTURE_STATISTICS_H
+#define GFXRECON_ENCODE_CAPTURE_STATISTICS_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/page_guard_manager.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Collects the cost of capture: time spent encoding, compressing, and writing API calls and state snapshots, and the
+// number of blocks and bytes written for each block type.  Each thread updates its own counters, which are only
+// combined when the statistics are reported, so that recording a value does not require synchronization between
+// capture threads.
+class CaptureStatistics
+{
+  public:
+    enum Timer : uint32_t
+    {
+        kEncodeTime        = 0,
+        kCompressTime      = 1,
+        kWriteTime         = 2,
+        kStateSnapshotTime = 3,
+        kTimerCount
+    };
+
+    // Block counters are indexed by block type, with the compressed block bit removed.
+    static const size_t kBlockTypeCount = format::BlockType::kMethodCallBlock + 1;
+
+    // Times are in nanoseconds.
+    struct Totals
+    {
+        uint64_t api_call_count{ 0 };
+        uint64_t timers[kTimerCount]{};
+        uint64_t compress_input_bytes{ 0 };
+        uint64_t compress_output_bytes{ 0 };
+        uint64_t block_count[kBlockTypeCount]{};
+        uint64_t block_bytes[kBlockTypeCount]{};
+    };
+
+  public:
+    CaptureStatistics();
+
+    ~CaptureStatistics();
+
+    // Records the time from start_time to the current time for the specified timer.
+    void AddTime(Timer timer, int64_t start_time);
+
+    // Records the encoding time for an API call that started at start_time.
+    void AddApiCall(int64_t start_time);
+
+    void AddCompression(size_t input_size, size_t output_size);
+
+    // Records a block written to the capture file, which must begin with a format::BlockHeader.
+    void AddBlock(const void* data, size_t size);
+
+    // Combines the counters of all threads.
+    Totals GetTotals();
+
+    // Returns a JSON string with the values accumulated since the previous call, and begins a new interval.  Page
+    // guard statistics are only included when page_guard_manager is not null.
+    std::string
+    GetIntervalString(uint32_t first_frame, uint32_t last_frame, util::PageGuardManager* page_guard_manager);
+
+  private:
+    struct ThreadCounters
+    {
+        std::atomic<uint64_t> api_call_count{ 0 };
+        std::atomic<uint64_t> timers[kTimerCount]{};
+        std::atomic<uint64_t> compress_input_bytes{ 0 };
+        std::atomic<uint64_t> compress_output_bytes{ 0 };
+        std::atomic<uint64_t> block_count[kBlockTypeCount]{};
+        std::atomic<uint64_t> block_bytes[kBlockTypeCount]{};
+    };
+
+    struct ThreadSlot
+    {
+        uint64_t                        owner_id{ 0 };
+        std::shared_ptr<ThreadCounters> counters;
+    };
+
+  private:
+    ThreadCounters* GetThreadCounters();
+
+    // Counters are only written by their owning thread, so an atomic read-modify-write operation is not required.
+    static void Increment(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static void Accumulate(const ThreadCounters& counters, Totals* totals);
+
+  private:
+    static std::atomic<uint64_t>  next_id_;
+    static thread_local ThreadSlot thread_slot_;
+
+    uint64_t                                     id_;
+    std::mutex                                   mutex_;
+    std::vector<std::shared_ptr<ThreadCounters>> thread_counters_;
+    Totals                                       retired_;  // Values from threads that have exited.
+    Totals                                       previous_; // Totals at the start of the current interval.
+    util::PageGuardManager::Statistics           previous_page_guard_;
+};
+
+// Compressor wrapper that records compression time and sizes with CaptureStatistics.  Because the capture manager
+// shares its compressor with the state writers, this also covers the compression of state snapshot data.
+class CaptureStatisticsCompressor : public util::Compressor
+{
+  public:
+    CaptureStatisticsCompressor(std::unique_ptr<util::Compressor> compressor, CaptureStatistics* statistics) :
+        compressor_(std::move(compressor)), statistics_(statistics)
+    {}
+
+    virtual ~CaptureStatisticsCompressor() override {}
+
+    virtual size_t Compress(const size_t          uncompressed_size,
+                            const uint8_t*        uncompressed_data,
+                            std::vector<uint8_t>* compressed_data,
+                            size_t                compressed_data_offset) override;
+
+    virtual size_t Decompress(const size_t                compressed_size,
+                              const std::vector<uint8_t>& compressed_data,
+                              const size_t                expected_uncompressed_size,
+                              std::vector<uint8_t>*       uncompressed_data) override
+    {
+        return compressor_->Decompress(compressed_size, compressed_data, expected_uncompressed_size, uncompressed_data);
+    }
+
+  private:
+    std::unique_ptr<util::Compressor> compressor_;
+    CaptureStatistics*                statistics_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_CAPTURE_STATISTICS_H
@@ -0,0 +1,303 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/create_parameter_arena.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Read-only parameter stream with data that is stored in a CreateParameterArena.
+class ArenaParameterStream : public util::MemoryOutputStream
+{
+  public:
+    ArenaParameterStream(CreateParameterArena* arena, const util::MemoryOutputStream* parameters) :
+        util::MemoryOutputStream(0), arena_(arena), data_(nullptr), size_(parameters->GetDataSize())
+    {
+        data_ = reinterpret_cast<uint8_t*>(arena_->Allocate(size_));
+        util::platform::MemoryCopy(data_, size_, parameters->GetData(), size_);
+    }
+
+    virtual ~ArenaParameterStream() override { arena_->Release(data_); }
+
+    virtual void Clear() override { assert(false); }
+
+    virtual size_t Write(const void* data, size_t len) override
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(data);
+        GFXRECON_UNREFERENCED_PARAMETER(len);
+
+        // Tracked create parameters are not modified after they have been stored.
+        assert(false);
+        return 0;
+    }
+
+    virtual const uint8_t* GetData() const override { return data_; }
+
+    virtual size_t GetDataSize() const override { return size_; }
+
+  private:
+    CreateParameterArena* arena_;
+    uint8_t*              data_;
+    size_t                size_;
+};
+
+// Allocator for std::allocate_shared, which places the stream and its shared pointer control block in the arena.  The
+// allocator is stored with the control block, keeping the arena alive until the stream has been released.
+template <typename T>
+class ArenaAllocator
+{
+  public:
+    typedef T value_type;
+
+    ArenaAllocator(std::shared_ptr<CreateParameterArena> arena) : arena_(std::move(arena)) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.GetArena())
+    {}
+
+    T* allocate(size_t count) { return reinterpret_cast<T*>(arena_->Allocate(count * sizeof(T))); }
+
+    void deallocate(T* memory, size_t count)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(count);
+        arena_->Release(memory);
+    }
+
+    const std::shared_ptr<CreateParameterArena>& GetArena() const { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return arena_ == other.GetArena();
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const
+    {
+        return arena_ != other.GetArena();
+    }
+
+  private:
+    std::shared_ptr<CreateParameterArena> arena_;
+};
+
+CreateParameterArena::CreateParameterArena() :
+    current_slab_(nullptr), slab_bytes_(0), allocation_count_(0), allocation_bytes_(0)
+{}
+
+CreateParameterArena::~CreateParameterArena()
+{
+    assert(allocation_count_ == 0);
+}
+
+std::shared_ptr<util::MemoryOutputStream>
+CreateParameterArena::CopyParameters(const std::shared_ptr<CreateParameterArena>& arena,
+                                     const util::MemoryOutputStream*              parameters)
+{
+    assert((arena != nullptr) && (parameters != nullptr));
+
+    return std::allocate_shared<ArenaParameterStream>(
+        ArenaAllocator<ArenaParameterStream>(arena), arena.get(), parameters);
+}
+
+void* CreateParameterArena::Allocate(size_t size)
+{
+    // Allocations must be large enough to hold the free list links once they have been released.
+    const size_t data_size       = ((size + kAlignment - 1) / kAlignment) * kAlignment;
+    const size_t allocation_size = kHeaderSize + ((data_size > kFreeBlockSize) ? data_size : kFreeBlockSize);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    AllocationHeader* header = nullptr;
+
+    auto free_entry = free_lists_.find(allocation_size);
+    if (free_entry != free_lists_.end())
+    {
+        // Reuse a released allocation of the same size.
+        FreeBlock* block = free_entry->second;
+        RemoveFreeBlock(block);
+
+        header = GetHeader(block);
+    }
+    else
+    {
+        Slab* slab = current_slab_;
+        if ((slab == nullptr) || (allocation_size > (slab->size - slab->offset)))
+        {
+            auto new_slab  = std::make_unique<Slab>();
+            new_slab->size = (allocation_size > kSlabSize) ? allocation_size : kSlabSize;
+            new_slab->data = std::unique_ptr<uint8_t[]>(new uint8_t[new_slab->size]);
+
+            slab = new_slab.get();
+            slabs_.emplace_back(std::move(new_slab));
+            slab_bytes_ += slab->size;
+
+            // A dedicated slab for a large allocation does not replace the current slab, which may still have space.
+            // A slab that is replaced is freed when its remaining allocations are released.
+            if (allocation_size <= kSlabSize)
+            {
+                current_slab_ = slab;
+            }
+        }
+
+        header       = reinterpret_cast<AllocationHeader*>(slab->data.get() + slab->offset);
+        header->slab = slab;
+        header->size = allocation_size;
+
+        slab->offset += allocation_size;
+    }
+
+    ++header->slab->allocation_count;
+
+    ++allocation_count_;
+    allocation_bytes_ += allocation_size;
+
+    return reinterpret_cast<uint8_t*>(header) + kHeaderSize;
+}
+
+void CreateParameterArena::Release(void* memory)
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(reinterpret_cast<uint8_t*>(memory) - kHeaderSize);
+    Slab*             slab   = header->slab;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    assert((slab != nullptr) && (slab->allocation_count > 0));
+
+    --slab->allocation_count;
+    --allocation_count_;
+    allocation_bytes_ -= header->size;
+
+    AddFreeBlock(header);
+
+    if (slab->allocation_count == 0)
+    {
+        // None of the slab's memory is in use, so its released blocks are discarded instead of being reused.
+        RemoveFreeBlocks(slab);
+
+        if (slab == current_slab_)
+        {
+            // The current slab is reused from the start.
+            slab->offset = 0;
+        }
+        else
+        {
+            slab_bytes_ -= slab->size;
+            slabs_.erase(std::find_if(slabs_.begin(), slabs_.end(), [slab](const std::unique_ptr<Slab>& entry) {
+                return entry.get() == slab;
+            }));
+        }
+    }
+}
+
+CreateParameterArena::Statistics CreateParameterArena::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Statistics statistics;
+    statistics.slab_count       = slabs_.size();
+    statistics.slab_bytes       = slab_bytes_;
+    statistics.allocation_count = allocation_count_;
+    statistics.allocation_bytes = allocation_bytes_;
+
+    return statistics;
+}
+
+CreateParameterArena::AllocationHeader* CreateParameterArena::GetHeader(FreeBlock* block)
+{
+    return reinterpret_cast<AllocationHeader*>(reinterpret_cast<uint8_t*>(block) - kHeaderSize);
+}
+
+void CreateParameterArena::AddFreeBlock(AllocationHeader* header)
+{
+    FreeBlock*  block = reinterpret_cast<FreeBlock*>(reinterpret_cast<uint8_t*>(header) + kHeaderSize);
+    FreeBlock*& head  = free_lists_[header->size];
+
+    block->prev = nullptr;
+    block->next = head;
+
+    if (head != nullptr)
+    {
+        head->prev = block;
+    }
+
+    head = block;
+}
+
+void CreateParameterArena::RemoveFreeBlock(FreeBlock* block)
+{
+    if (block->next != nullptr)
+    {
+        block->next->prev = block->prev;
+    }
+
+    if (block->prev != nullptr)
+    {
+        block->prev->next = block->next;
+    }
+    else
+    {
+        // The block is the head of its list.
+        const size_t size  = GetHeader(block)->size;
+        auto         entry = free_lists_.find(size);
+        assert((entry != free_lists_.end()) && (entry->second == block));
+
+        if (block->next != nullptr)
+        {
+            entry->second = block->next;
+        }
+        else
+        {
+            free_lists_.erase(entry);
+        }
+    }
+}
+
+void CreateParameterArena::RemoveFreeBlocks(Slab* slab)
+{
+    assert(slab->allocation_count == 0);
+
+    // Every block up to the slab's offset has been released.
+    uint8_t* data   = slab->data.get();
+    size_t   offset = 0;
+
+    while (offset < slab->offset)
+    {
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(data + offset);
+        offset += header->size;
+
+        RemoveFreeBlock(reinterpret_cast<FreeBlock*>(reinterpret_cast<uint8_t*>(header) + kHeaderSize));
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
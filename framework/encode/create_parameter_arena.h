@@ -0,0 +1,125 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_CREATE_PARAMETER_ARENA_H
+#define GFXRECON_ENCODE_CREATE_PARAMETER_ARENA_H
+
+#include "util/defines.h"
+#include "util/memory_output_stream.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Stores the encoded create parameters of tracked objects in large slabs, replacing the individual heap allocations
+// for each object's parameter stream and shared pointer control block.  Parameters are released to the arena when
+// their last reference is destroyed.  Released allocations are kept in per-size free lists and are reused by later
+// allocations of the same size, so that slabs held by long-lived parameters are refilled instead of growing the arena.
+// A slab is freed when all of the parameters stored in it have been released, except for the slab that is currently
+// being filled, which is reused.
+class CreateParameterArena
+{
+  public:
+    struct Statistics
+    {
+        uint64_t slab_count{ 0 };
+        uint64_t slab_bytes{ 0 };       // Combined size of all slabs.
+        uint64_t allocation_count{ 0 }; // Number of allocations that have not been released.
+        uint64_t allocation_bytes{ 0 }; // Combined size of the allocations that have not been released.
+    };
+
+    // Size of the slabs that allocations are taken from.  Larger allocations receive a dedicated slab.
+    static const size_t kSlabSize = 256 * 1024;
+
+  public:
+    CreateParameterArena();
+
+    ~CreateParameterArena();
+
+    // Returns a stream containing a copy of the parameter data, which is stored in the arena.  The stream keeps the
+    // arena alive until it is destroyed.  The returned stream must not be written to.
+    static std::shared_ptr<util::MemoryOutputStream> CopyParameters(const std::shared_ptr<CreateParameterArena>& arena,
+                                                                    const util::MemoryOutputStream* parameters);
+
+    void* Allocate(size_t size);
+
+    void Release(void* memory);
+
+    Statistics GetStatistics() const;
+
+  private:
+    struct Slab
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t                     size{ 0 };
+        size_t                     offset{ 0 };
+        size_t                     allocation_count{ 0 };
+    };
+
+    // Stored before each allocation to identify the slab that the allocation belongs to.
+    struct AllocationHeader
+    {
+        Slab*  slab;
+        size_t size;
+    };
+
+    // Stored in place of the data of a released allocation, linking it into the free list for its size.
+    struct FreeBlock
+    {
+        FreeBlock* prev;
+        FreeBlock* next;
+    };
+
+    static const size_t kAlignment     = alignof(std::max_align_t);
+    static const size_t kHeaderSize    = ((sizeof(AllocationHeader) + kAlignment - 1) / kAlignment) * kAlignment;
+    static const size_t kFreeBlockSize = ((sizeof(FreeBlock) + kAlignment - 1) / kAlignment) * kAlignment;
+
+  private:
+    static AllocationHeader* GetHeader(FreeBlock* block);
+
+    void AddFreeBlock(AllocationHeader* header);
+
+    void RemoveFreeBlock(FreeBlock* block);
+
+    // Removes the blocks of a slab with no remaining allocations from the free lists.
+    void RemoveFreeBlocks(Slab* slab);
+
+  private:
+    mutable std::mutex                     mutex_;
+    std::vector<std::unique_ptr<Slab>>     slabs_;
+    std::unordered_map<size_t, FreeBlock*> free_lists_; // Released allocations, by allocation size.
+    Slab*                                  current_slab_;
+    uint64_t                               slab_bytes_;
+    uint64_t                               allocation_count_;
+    uint64_t                               allocation_bytes_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_CREATE_PARAMETER_ARENA_H
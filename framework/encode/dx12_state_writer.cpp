@@ -34,9 +34,9 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
-Dx12StateWriter::Dx12StateWriter(util::FileOutputStream* output_stream,
-                                 util::Compressor*       compressor,
-                                 format::ThreadId        thread_id) :
+Dx12StateWriter::Dx12StateWriter(util::OutputStream* output_stream,
+                                 util::Compressor*   compressor,
+                                 format::ThreadId    thread_id) :
     output_stream_(output_stream),
     compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
 {
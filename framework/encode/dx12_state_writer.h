@@ -33,7 +33,7 @@
 #include "graphics/dx12_resource_data_util.h"
 #include "util/compressor.h"
 #include "util/defines.h"
-#include "util/file_output_stream.h"
+#include "util/output_stream.h"
 #include "util/memory_output_stream.h"
 #include "generated/generated_dx12_state_table.h"
 
@@ -50,7 +50,7 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class Dx12StateWriter
 {
   public:
-    Dx12StateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    Dx12StateWriter(util::OutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
 
     ~Dx12StateWriter();
     
@@ -188,7 +188,7 @@ class Dx12StateWriter
     void WriteAgsDriverExtensionsDX12CreateDevice(const AgsStateTable& ags_state_table);
 #endif // GFXRECON_AGS_SUPPORT
 
-    util::FileOutputStream*  output_stream_;
+    util::OutputStream*      output_stream_;
     util::Compressor*        compressor_;
     std::vector<uint8_t>     compressed_parameter_buffer_;
     format::ThreadId         thread_id_;
@@ -0,0 +1,177 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/fill_memory_delta_tracker.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+bool FillMemoryDeltaTracker::Update(uint64_t              memory_id,
+                                    uint64_t              offset,
+                                    uint64_t              size,
+                                    const uint8_t*        data,
+                                    std::vector<uint8_t>* delta,
+                                    uint64_t*             span_count)
+{
+    assert((data != nullptr) && (delta != nullptr) && (span_count != nullptr));
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, offset + size);
+
+    const size_t start = static_cast<size_t>(offset);
+    const size_t end   = static_cast<size_t>(offset + size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Reference& reference = references_[memory_id];
+
+    if (reference.data.size() < end)
+    {
+        reference.data.resize(end);
+        reference.valid_blocks.resize((end + kBlockSize - 1) / kBlockSize, false);
+    }
+
+    uint8_t* reference_data = reference.data.data();
+
+    // Span offsets and sizes are 32-bit values, so larger ranges are always written in full.
+    bool   use_delta      = (size <= std::numeric_limits<uint32_t>::max());
+    size_t max_delta_size = static_cast<size_t>(size / kMinSizeReduction);
+    size_t delta_size     = 0;
+    size_t changed_size   = 0;
+
+    spans_.clear();
+
+    size_t position = start;
+    while (use_delta && (position < end))
+    {
+        const size_t block_index = position / kBlockSize;
+        const size_t block_end   = std::min(end, (block_index + 1) * kBlockSize);
+        size_t       first       = position;
+        size_t       last        = block_end;
+
+        // Blocks that have not been fully written since the reference was created are treated as changed.
+        if (reference.valid_blocks[block_index])
+        {
+            const uint8_t* current  = data + (position - start);
+            const uint8_t* previous = reference_data + position;
+            const size_t   length   = block_end - position;
+
+            if (util::platform::MemoryCompare(current, previous, length) == 0)
+            {
+                position = block_end;
+                continue;
+            }
+
+            // Narrow the changed range to the first and last modified bytes of the block.
+            size_t head = 0;
+            while (current[head] == previous[head])
+            {
+                ++head;
+            }
+
+            size_t tail = length;
+            while (current[tail - 1] == previous[tail - 1])
+            {
+                --tail;
+            }
+
+            first = position + head;
+            last  = position + tail;
+        }
+
+        const uint32_t relative_first = static_cast<uint32_t>(first - start);
+        const uint32_t relative_last  = static_cast<uint32_t>(last - start);
+
+        if (!spans_.empty() && ((relative_first - (spans_.back().offset + spans_.back().size)) < kSpanMergeDistance))
+        {
+            changed_size += relative_last - (spans_.back().offset + spans_.back().size);
+            spans_.back().size = relative_last - spans_.back().offset;
+        }
+        else
+        {
+            spans_.push_back({ relative_first, relative_last - relative_first });
+            changed_size += relative_last - relative_first;
+        }
+
+        delta_size = (spans_.size() * sizeof(format::FillMemoryDeltaSpan)) + changed_size;
+        use_delta  = (delta_size <= max_delta_size);
+        position   = block_end;
+    }
+
+    if (use_delta)
+    {
+        const size_t table_size = spans_.size() * sizeof(format::FillMemoryDeltaSpan);
+
+        delta->resize(delta_size);
+
+        uint8_t* delta_data = delta->data();
+        if (table_size > 0)
+        {
+            util::platform::MemoryCopy(delta_data, delta_size, spans_.data(), table_size);
+        }
+
+        // Only the bytes covered by the spans differ from the reference copy.
+        size_t data_offset = table_size;
+        for (const auto& span : spans_)
+        {
+            util::platform::MemoryCopy(delta_data + data_offset, span.size, data + span.offset, span.size);
+            util::platform::MemoryCopy(reference_data + start + span.offset, span.size, data + span.offset, span.size);
+            data_offset += span.size;
+        }
+
+        (*span_count) = spans_.size();
+    }
+    else
+    {
+        util::platform::MemoryCopy(reference_data + start, static_cast<size_t>(size), data, static_cast<size_t>(size));
+    }
+
+    // Blocks that are completely covered by the range now match the replay-side memory content.
+    const size_t first_block = (start + kBlockSize - 1) / kBlockSize;
+    const size_t end_block   = end / kBlockSize;
+    for (size_t i = first_block; i < end_block; ++i)
+    {
+        reference.valid_blocks[i] = true;
+    }
+
+    return use_delta;
+}
+
+void FillMemoryDeltaTracker::RemoveReference(uint64_t memory_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    references_.erase(memory_id);
+}
+
+void FillMemoryDeltaTracker::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    references_.clear();
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
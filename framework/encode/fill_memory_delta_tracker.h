@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_FILL_MEMORY_DELTA_TRACKER_H
+#define GFXRECON_ENCODE_FILL_MEMORY_DELTA_TRACKER_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Keeps a reference copy of the data most recently written to the capture file for each mapped memory object, so that
+// fill memory commands for modified pages can be reduced to the byte ranges that actually changed.
+//
+// Offsets are relative to the mapped pointer, so the reference copy for a memory object must be removed when the
+// memory is unmapped.  All references must be cleared when a state snapshot is written, because the snapshot replaces
+// the replay-side memory content.
+class FillMemoryDeltaTracker
+{
+  public:
+    // Reference data is compared and validated in blocks of this size.
+    static const size_t kBlockSize = 64;
+
+    // Changed ranges separated by fewer unchanged bytes than this are merged into a single span, because the span
+    // entry would be larger than the unchanged bytes that it skips.
+    static const size_t kSpanMergeDistance = 2 * sizeof(format::FillMemoryDeltaSpan);
+
+    // A delta is only used when its encoded size is no more than 1/kMinSizeReduction of the full range.
+    static const uint64_t kMinSizeReduction = 4;
+
+  public:
+    FillMemoryDeltaTracker() {}
+
+    ~FillMemoryDeltaTracker() {}
+
+    // Compares the size bytes of data with the reference copy at offset, then updates the reference copy.  Returns
+    // true when the changes should be written as a delta, which is then stored in delta as span_count
+    // FillMemoryDeltaSpan entries followed by the changed bytes.  A span_count of 0 indicates that nothing changed and
+    // nothing needs to be written.  Returns false when the full range should be written.
+    bool Update(uint64_t              memory_id,
+                uint64_t              offset,
+                uint64_t              size,
+                const uint8_t*        data,
+                std::vector<uint8_t>* delta,
+                uint64_t*             span_count);
+
+    void RemoveReference(uint64_t memory_id);
+
+    void Clear();
+
+  private:
+    struct Reference
+    {
+        std::vector<uint8_t> data;
+        std::vector<bool>    valid_blocks; // Blocks of data that match the replay-side memory content.
+    };
+
+  private:
+    std::mutex                              mutex_;
+    std::unordered_map<uint64_t, Reference> references_;
+    std::vector<format::FillMemoryDeltaSpan> spans_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FILL_MEMORY_DELTA_TRACKER_H
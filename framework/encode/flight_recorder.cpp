@@ -0,0 +1,235 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/flight_recorder.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+FlightRecorder::FlightRecorder(uint32_t max_frames, uint64_t memory_limit, uint32_t first_frame) :
+    max_frames_(std::max(max_frames, 1u)), memory_limit_(memory_limit), budget_warning_issued_(false)
+{
+    // The generation that starts at application launch does not need a state snapshot.
+    generations_.emplace_back();
+    generations_.back().first_frame = first_frame;
+    statistics_.oldest_frame        = first_frame;
+}
+
+size_t FlightRecorder::Write(const void* data, size_t len)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_frame_.insert(current_frame_.end(), bytes, bytes + len);
+
+    return len;
+}
+
+bool FlightRecorder::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    assert(!generations_.empty());
+    Generation& current = generations_.back();
+
+    current.frame_bytes += current_frame_.size();
+    statistics_.recorded_bytes += current_frame_.size();
+    ++statistics_.recorded_frames;
+
+    current.frames.emplace_back(std::move(current_frame_));
+    current_frame_ = std::vector<uint8_t>();
+
+    UpdateRetainedSize();
+    ReleaseOldGenerations();
+
+    // Start a new generation when the current one holds the requested number of frames, or when its frames alone
+    // consume half of the memory budget, so that the previous generation can be released.
+    return (current.frames.size() >= max_frames_) ||
+           ((memory_limit_ > 0) && (current.frame_bytes > (memory_limit_ / 2)));
+}
+
+util::OutputStream* FlightRecorder::BeginSnapshot(uint32_t frame_number)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Only the most recently completed generation needs to be kept once the new snapshot exists.
+    while (generations_.size() > 1)
+    {
+        generations_.pop_front();
+    }
+
+    generations_.emplace_back();
+    Generation& generation = generations_.back();
+    generation.first_frame = frame_number;
+    generation.snapshot    = std::make_unique<util::MemoryOutputStream>();
+
+    return generation.snapshot.get();
+}
+
+void FlightRecorder::EndSnapshot(int64_t duration)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ++statistics_.snapshot_count;
+    statistics_.snapshot_time += duration;
+
+    UpdateRetainedSize();
+    ReleaseOldGenerations();
+}
+
+void FlightRecorder::WriteRetained(util::OutputStream* stream)
+{
+    assert(stream != nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Only the snapshot for the oldest generation is written; the frames that follow it already contain the calls
+    // that produced the state captured by the snapshots of the newer generations.
+    const Generation& oldest = generations_.front();
+    if (oldest.snapshot != nullptr)
+    {
+        stream->Write(oldest.snapshot->GetData(), oldest.snapshot->GetDataSize());
+    }
+
+    for (const auto& generation : generations_)
+    {
+        for (const auto& frame : generation.frames)
+        {
+            stream->Write(frame.data(), frame.size());
+        }
+    }
+
+    if (!current_frame_.empty())
+    {
+        stream->Write(current_frame_.data(), current_frame_.size());
+    }
+}
+
+FlightRecorder::Statistics FlightRecorder::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+std::string FlightRecorder::GetStatisticsString()
+{
+    Statistics statistics = GetStatistics();
+
+    double bytes_per_frame    = 0.0;
+    double snapshot_time_ms   = 0.0;
+    double overhead_per_frame = 0.0;
+
+    if (statistics.recorded_frames > 0)
+    {
+        bytes_per_frame = static_cast<double>(statistics.recorded_bytes) / statistics.recorded_frames;
+        overhead_per_frame =
+            util::datetime::ConvertTimestampToMilliseconds(statistics.snapshot_time) / statistics.recorded_frames;
+    }
+
+    if (statistics.snapshot_count > 0)
+    {
+        snapshot_time_ms =
+            util::datetime::ConvertTimestampToMilliseconds(statistics.snapshot_time) / statistics.snapshot_count;
+    }
+
+    std::string result = "{\n";
+    result += "    \"max-frames\": " + std::to_string(max_frames_) + ",\n";
+    result += "    \"oldest-frame\": " + std::to_string(statistics.oldest_frame) + ",\n";
+    result += "    \"retained-frames\": " + std::to_string(statistics.retained_frames) + ",\n";
+    result += "    \"retained-bytes\": " + std::to_string(statistics.retained_bytes) + ",\n";
+    result += "    \"peak-bytes\": " + std::to_string(statistics.peak_bytes) + ",\n";
+    result += "    \"memory-limit-bytes\": " + std::to_string(memory_limit_) + ",\n";
+    result += "    \"snapshot-bytes\": " + std::to_string(statistics.snapshot_bytes) + ",\n";
+    result += "    \"snapshot-count\": " + std::to_string(statistics.snapshot_count) + ",\n";
+    result += "    \"average-snapshot-ms\": " + std::to_string(snapshot_time_ms) + ",\n";
+    result += "    \"recorded-frames\": " + std::to_string(statistics.recorded_frames) + ",\n";
+    result += "    \"average-bytes-per-frame\": " + std::to_string(bytes_per_frame) + ",\n";
+    result += "    \"snapshot-ms-per-frame\": " + std::to_string(overhead_per_frame) + "\n";
+    result += "}";
+
+    return result;
+}
+
+uint64_t FlightRecorder::GetGenerationSize(const Generation& generation) const
+{
+    uint64_t size = generation.frame_bytes;
+    if (generation.snapshot != nullptr)
+    {
+        size += generation.snapshot->GetDataSize();
+    }
+    return size;
+}
+
+void FlightRecorder::UpdateRetainedSize()
+{
+    uint64_t retained_bytes  = current_frame_.size();
+    uint32_t retained_frames = 0;
+
+    for (const auto& generation : generations_)
+    {
+        retained_bytes += GetGenerationSize(generation);
+        retained_frames += static_cast<uint32_t>(generation.frames.size());
+    }
+
+    const Generation& oldest = generations_.front();
+
+    statistics_.oldest_frame    = oldest.first_frame;
+    statistics_.retained_frames = retained_frames;
+    statistics_.retained_bytes  = retained_bytes;
+    statistics_.peak_bytes      = std::max(statistics_.peak_bytes, retained_bytes);
+    statistics_.snapshot_bytes  = (oldest.snapshot != nullptr) ? oldest.snapshot->GetDataSize() : 0;
+}
+
+void FlightRecorder::ReleaseOldGenerations()
+{
+    if (memory_limit_ == 0)
+    {
+        return;
+    }
+
+    // Drop the oldest generation while over budget, as long as the next generation has frames to replay.
+    while ((statistics_.retained_bytes > memory_limit_) && (generations_.size() > 1) &&
+           !generations_[1].frames.empty())
+    {
+        generations_.pop_front();
+        UpdateRetainedSize();
+    }
+
+    if ((statistics_.retained_bytes > memory_limit_) && !budget_warning_issued_)
+    {
+        GFXRECON_LOG_WARNING("Flight recorder memory usage (%" PRIu64
+                             " bytes) exceeds the configured memory limit (%" PRIu64 " bytes)",
+                             statistics_.retained_bytes,
+                             memory_limit_);
+        budget_warning_issued_ = true;
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,121 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_FLIGHT_RECORDER_H
+#define GFXRECON_ENCODE_FLIGHT_RECORDER_H
+
+#include "util/defines.h"
+#include "util/memory_output_stream.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Output stream that keeps the most recent frames of encoded blocks in memory instead of writing them to a file.
+//
+// Frames are grouped into generations.  Each generation starts with a state snapshot that was taken at its first frame
+// (the generation that starts at application launch has no snapshot) and holds the blocks for up to max_frames frames.
+// When a generation is full, a new generation is started and the generation before the previous one is released, so
+// the ring always retains between max_frames and 2 * max_frames complete frames, with a snapshot taken at the oldest
+// retained frame.
+class FlightRecorder : public util::OutputStream
+{
+  public:
+    struct Statistics
+    {
+        uint32_t oldest_frame{ 0 };     // First frame covered by the retained data.
+        uint32_t retained_frames{ 0 };  // Number of complete frames retained in memory.
+        uint64_t retained_bytes{ 0 };   // Current memory used by retained snapshots and frames.
+        uint64_t peak_bytes{ 0 };       // Largest value of retained_bytes observed.
+        uint64_t snapshot_bytes{ 0 };   // Size of the snapshot for the oldest retained frame.
+        uint64_t snapshot_count{ 0 };   // Number of state snapshots taken.
+        int64_t  snapshot_time{ 0 };    // Total time spent writing state snapshots, in nanoseconds.
+        uint64_t recorded_frames{ 0 };  // Number of frames recorded since creation.
+        uint64_t recorded_bytes{ 0 };   // Number of frame bytes (excluding snapshots) recorded since creation.
+    };
+
+  public:
+    // A memory_limit of 0 disables the memory budget.
+    FlightRecorder(uint32_t max_frames, uint64_t memory_limit, uint32_t first_frame);
+
+    virtual ~FlightRecorder() override {}
+
+    virtual bool IsValid() override { return true; }
+
+    // Append data to the frame that is currently being recorded.
+    virtual size_t Write(const void* data, size_t len) override;
+
+    // Close the current frame. Returns true when a new state snapshot should be taken with BeginSnapshot() before
+    // recording the next frame.
+    bool EndFrame();
+
+    // Start a new generation at the specified frame. The returned stream receives the state snapshot and must be
+    // completed with EndSnapshot().
+    util::OutputStream* BeginSnapshot(uint32_t frame_number);
+
+    void EndSnapshot(int64_t duration);
+
+    // Write the snapshot for the oldest retained frame, followed by all retained frames, to the specified stream.
+    void WriteRetained(util::OutputStream* stream);
+
+    Statistics GetStatistics();
+
+    // JSON formatted statistics, suitable for an annotation block.
+    std::string GetStatisticsString();
+
+  private:
+    struct Generation
+    {
+        uint32_t                                  first_frame{ 0 };
+        std::unique_ptr<util::MemoryOutputStream> snapshot;
+        std::vector<std::vector<uint8_t>>         frames;
+        uint64_t                                  frame_bytes{ 0 };
+    };
+
+  private:
+    uint64_t GetGenerationSize(const Generation& generation) const;
+
+    void UpdateRetainedSize();
+
+    void ReleaseOldGenerations();
+
+  private:
+    std::mutex             mutex_;
+    const uint32_t         max_frames_;
+    const uint64_t         memory_limit_;
+    std::deque<Generation> generations_;
+    std::vector<uint8_t>   current_frame_;
+    Statistics             statistics_;
+    bool                   budget_warning_issued_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FLIGHT_RECORDER_H
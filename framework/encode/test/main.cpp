@@ -26,13 +26,21 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
 
+#include "encode/capture_statistics.h"
+#include "encode/create_parameter_arena.h"
+#include "encode/fill_memory_delta_tracker.h"
+#include "encode/flight_recorder.h"
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "encode/vulkan_handle_wrappers.h"
+#include "encode/vulkan_state_info.h"
+#include "encode/vulkan_state_tracker.h"
 #include "format/format.h"
 #include "format/format_util.h"
 
 #include "vulkan/vulkan.h"
 
+#include <thread>
+
 const auto                       kBufferHandle = gfxrecon::format::FromHandleId<VkBuffer>(0xabcd);
 const gfxrecon::format::HandleId kBufferId     = 12;
 
@@ -73,3 +81,336 @@ TEST_CASE("handles can be wrapped and unwrapped", "[wrapper]")
 
     gfxrecon::util::Log::Release();
 }
+
+TEST_CASE("flight recorder retains the frames following the oldest snapshot", "[flight_recorder]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    const uint32_t                   kMaxFrames = 2;
+    gfxrecon::encode::FlightRecorder recorder(kMaxFrames, 0, 1);
+
+    // Record four single-byte frames, taking a one-byte snapshot whenever the recorder requests one.
+    for (uint8_t frame = 1; frame <= 4; ++frame)
+    {
+        recorder.Write(&frame, sizeof(frame));
+        if (recorder.EndFrame())
+        {
+            uint8_t snapshot = 0xf0 | (frame + 1);
+            recorder.BeginSnapshot(frame + 1)->Write(&snapshot, sizeof(snapshot));
+            recorder.EndSnapshot(0);
+        }
+    }
+
+    gfxrecon::util::MemoryOutputStream retained;
+    recorder.WriteRetained(&retained);
+
+    auto statistics = recorder.GetStatistics();
+
+    SECTION("The oldest retained frame has a snapshot and the newest snapshot is not written")
+    {
+        REQUIRE(statistics.oldest_frame == 3);
+        REQUIRE(statistics.retained_frames == 2);
+        REQUIRE(statistics.snapshot_count == 2);
+        REQUIRE(retained.GetDataSize() == 3);
+        REQUIRE(retained.GetData()[0] == 0xf3);
+        REQUIRE(retained.GetData()[1] == 3);
+        REQUIRE(retained.GetData()[2] == 4);
+    }
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("fill memory delta tracker reduces modified pages to changed spans", "[fill_memory_delta]")
+{
+    gfxrecon::encode::FillMemoryDeltaTracker tracker;
+
+    const uint64_t       kMemoryId = 1;
+    const size_t         kSize     = 4096;
+    std::vector<uint8_t> memory(kSize, 0);
+    std::vector<uint8_t> delta;
+    uint64_t             span_count = 0;
+
+    SECTION("The first write is not a delta")
+    {
+        REQUIRE(!tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count));
+    }
+
+    SECTION("Unchanged memory produces no spans")
+    {
+        tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count);
+
+        REQUIRE(tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count));
+        REQUIRE(span_count == 0);
+    }
+
+    SECTION("Nearby changes are merged and distant changes produce separate spans")
+    {
+        tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count);
+
+        memory[100]  = 1;
+        memory[104]  = 2;
+        memory[2000] = 3;
+
+        REQUIRE(tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count));
+        REQUIRE(span_count == 2);
+
+        const auto* spans = reinterpret_cast<const gfxrecon::format::FillMemoryDeltaSpan*>(delta.data());
+        REQUIRE(spans[0].offset == 100);
+        REQUIRE(spans[0].size == 5);
+        REQUIRE(spans[1].offset == 2000);
+        REQUIRE(spans[1].size == 1);
+
+        const uint8_t* bytes = delta.data() + (2 * sizeof(gfxrecon::format::FillMemoryDeltaSpan));
+        REQUIRE(delta.size() == ((2 * sizeof(gfxrecon::format::FillMemoryDeltaSpan)) + 6));
+        REQUIRE(bytes[0] == 1);
+        REQUIRE(bytes[4] == 2);
+        REQUIRE(bytes[5] == 3);
+    }
+
+    SECTION("Removing the reference forces a full write")
+    {
+        tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count);
+        tracker.RemoveReference(kMemoryId);
+
+        REQUIRE(!tracker.Update(kMemoryId, 0, kSize, memory.data(), &delta, &span_count));
+    }
+}
+
+TEST_CASE("capture statistics combine the counters of all threads", "[capture_statistics]")
+{
+    gfxrecon::encode::CaptureStatistics statistics;
+
+    gfxrecon::format::BlockHeader header{};
+    header.size = 0;
+    header.type = gfxrecon::format::BlockType::kFunctionCallBlock;
+
+    // Counters from threads that have exited must be retained.
+    std::thread thread([&]() {
+        statistics.AddBlock(&header, sizeof(header));
+        statistics.AddCompression(100, 40);
+    });
+    thread.join();
+
+    statistics.AddBlock(&header, sizeof(header));
+
+    SECTION("Totals include every thread")
+    {
+        auto totals = statistics.GetTotals();
+        REQUIRE(totals.block_count[gfxrecon::format::BlockType::kFunctionCallBlock] == 2);
+        REQUIRE(totals.block_bytes[gfxrecon::format::BlockType::kFunctionCallBlock] == (2 * sizeof(header)));
+        REQUIRE(totals.compress_input_bytes == 100);
+        REQUIRE(totals.compress_output_bytes == 40);
+    }
+
+    SECTION("Each interval only reports the values recorded since the previous interval")
+    {
+        std::string first = statistics.GetIntervalString(1, 1, nullptr);
+        REQUIRE(first.find("\"function-call\": { \"count\": 2") != std::string::npos);
+
+        std::string second = statistics.GetIntervalString(2, 2, nullptr);
+        REQUIRE(second.find("\"compress-input-bytes\": 0") != std::string::npos);
+        REQUIRE(second.find("function-call") == std::string::npos);
+    }
+}
+
+TEST_CASE("descriptor state only allocates storage for written descriptors", "[descriptor_info]")
+{
+    const uint32_t kCount = 500000;
+
+    gfxrecon::encode::vulkan_state_info::DescriptorWriteMask           written;
+    gfxrecon::encode::vulkan_state_info::DescriptorArray<VkBufferView> views;
+    written.Initialize(kCount);
+    views.Initialize(kCount);
+
+    REQUIRE(written.FindNext(0) == kCount);
+    REQUIRE(views.Get(0) == nullptr);
+
+    written.SetRange(100, 200);
+    written.Set(kCount - 1, true);
+    views.Set(kCount - 1, gfxrecon::format::FromHandleId<VkBufferView>(0x1234));
+
+    SECTION("Written descriptors are found by skipping the unwritten ranges")
+    {
+        REQUIRE(written.FindNext(0) == 100);
+        REQUIRE(written.FindNext(299) == 299);
+        REQUIRE(written.FindNext(300) == (kCount - 1));
+        REQUIRE(!written.IsSet(300));
+    }
+
+    SECTION("Only the chunk containing a written value is allocated")
+    {
+        REQUIRE(views.Get(0) == nullptr);
+        REQUIRE(views.Get(kCount - 2) != nullptr);
+        REQUIRE(views.GetValue(kCount - 1) == gfxrecon::format::FromHandleId<VkBufferView>(0x1234));
+    }
+}
+
+gfxrecon::format::HandleId GetNextDescriptorHandleId()
+{
+    static gfxrecon::format::HandleId next_id = 100;
+    return ++next_id;
+}
+
+TEST_CASE("descriptor copies between mutable and typed bindings only copy the active type", "[descriptor_info]")
+{
+    using namespace gfxrecon::encode::vulkan_wrappers;
+
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    VkDescriptorPool pool        = gfxrecon::format::FromHandleId<VkDescriptorPool>(0x1000);
+    VkDescriptorSet  mutable_set = gfxrecon::format::FromHandleId<VkDescriptorSet>(0x1001);
+    VkDescriptorSet  typed_set   = gfxrecon::format::FromHandleId<VkDescriptorSet>(0x1002);
+
+    CreateWrappedHandle<DeviceWrapper, NoParentWrapper, DescriptorPoolWrapper>(
+        VK_NULL_HANDLE, NoParentWrapper::kHandleValue, &pool, GetNextDescriptorHandleId);
+    CreateWrappedHandle<DeviceWrapper, DescriptorPoolWrapper, DescriptorSetWrapper>(
+        VK_NULL_HANDLE, pool, &mutable_set, GetNextDescriptorHandleId);
+    CreateWrappedHandle<DeviceWrapper, DescriptorPoolWrapper, DescriptorSetWrapper>(
+        VK_NULL_HANDLE, pool, &typed_set, GetNextDescriptorHandleId);
+
+    const uint32_t kCount = 4;
+
+    // Mutable bindings initialize the arrays of every type, while typed bindings only initialize their own arrays.
+    auto& mutable_binding = GetWrapper<DescriptorSetWrapper>(mutable_set)->bindings[0];
+    mutable_binding.type  = VK_DESCRIPTOR_TYPE_MUTABLE_VALVE;
+    mutable_binding.count = kCount;
+    mutable_binding.written.Initialize(kCount);
+    mutable_binding.handle_ids.Initialize(kCount);
+    mutable_binding.sampler_ids.Initialize(kCount);
+    mutable_binding.images.Initialize(kCount);
+    mutable_binding.buffers.Initialize(kCount);
+    mutable_binding.texel_buffer_views.Initialize(kCount);
+    mutable_binding.acceleration_structures.Initialize(kCount);
+    mutable_binding.mutable_type.Initialize(kCount);
+
+    auto& typed_binding = GetWrapper<DescriptorSetWrapper>(typed_set)->bindings[0];
+    typed_binding.type  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    typed_binding.count = kCount;
+    typed_binding.written.Initialize(kCount);
+    typed_binding.handle_ids.Initialize(kCount);
+    typed_binding.buffers.Initialize(kCount);
+
+    const VkDescriptorBufferInfo buffer_info = { kBufferHandle, 16, 64 };
+
+    typed_binding.written.Set(1, true);
+    typed_binding.handle_ids.Set(1, kBufferId);
+    typed_binding.buffers.Set(1, buffer_info);
+
+    VkCopyDescriptorSet copy = { VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET };
+    copy.descriptorCount     = 1;
+
+    gfxrecon::encode::VulkanStateTracker tracker;
+
+    SECTION("Copying a typed descriptor to a mutable binding records the descriptor type")
+    {
+        copy.srcSet          = typed_set;
+        copy.srcArrayElement = 1;
+        copy.dstSet          = mutable_set;
+        copy.dstArrayElement = 2;
+        tracker.TrackUpdateDescriptorSets(0, nullptr, 1, &copy);
+
+        REQUIRE(mutable_binding.written.IsSet(2));
+        REQUIRE(mutable_binding.mutable_type.GetValue(2) == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        REQUIRE(mutable_binding.handle_ids.GetValue(2) == kBufferId);
+        REQUIRE(mutable_binding.buffers.GetValue(2).offset == 16);
+        REQUIRE(mutable_binding.images.Get(2) == nullptr);
+    }
+
+    SECTION("Copying a mutable descriptor to a typed binding only copies the arrays of the active type")
+    {
+        mutable_binding.written.Set(3, true);
+        mutable_binding.mutable_type.Set(3, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        mutable_binding.handle_ids.Set(3, kBufferId);
+        mutable_binding.buffers.Set(3, buffer_info);
+        mutable_binding.images.Set(3, VkDescriptorImageInfo{});
+
+        copy.srcSet          = mutable_set;
+        copy.srcArrayElement = 3;
+        copy.dstSet          = typed_set;
+        copy.dstArrayElement = 0;
+        tracker.TrackUpdateDescriptorSets(0, nullptr, 1, &copy);
+
+        REQUIRE(typed_binding.written.IsSet(0));
+        REQUIRE(typed_binding.handle_ids.GetValue(0) == kBufferId);
+        REQUIRE(typed_binding.buffers.GetValue(0).range == 64);
+        REQUIRE(!typed_binding.images.IsInitialized());
+        REQUIRE(!typed_binding.mutable_type.IsInitialized());
+    }
+
+    DestroyWrappedHandle<DescriptorPoolWrapper>(pool);
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("create parameter arena releases slabs when their parameters are released", "[create_parameter_arena]")
+{
+    auto arena = std::make_shared<gfxrecon::encode::CreateParameterArena>();
+
+    gfxrecon::util::MemoryOutputStream                               source;
+    std::vector<std::shared_ptr<gfxrecon::util::MemoryOutputStream>> parameters;
+
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        source.Clear();
+        source.Write(&i, sizeof(i));
+        parameters.push_back(gfxrecon::encode::CreateParameterArena::CopyParameters(arena, &source));
+    }
+
+    auto statistics = arena->GetStatistics();
+    REQUIRE(statistics.allocation_count == 20000);
+    REQUIRE(statistics.slab_count > 1);
+
+    SECTION("Copied parameters match the source data")
+    {
+        REQUIRE(parameters[1234]->GetDataSize() == sizeof(uint32_t));
+        REQUIRE(*reinterpret_cast<const uint32_t*>(parameters[1234]->GetData()) == 1234);
+    }
+
+    SECTION("Only the current slab is retained once all parameters are released")
+    {
+        parameters.clear();
+
+        statistics = arena->GetStatistics();
+        REQUIRE(statistics.allocation_count == 0);
+        REQUIRE(statistics.slab_count == 1);
+    }
+}
+
+TEST_CASE("create parameter arena reuses memory released between long-lived parameters", "[create_parameter_arena]")
+{
+    auto arena = std::make_shared<gfxrecon::encode::CreateParameterArena>();
+
+    gfxrecon::util::MemoryOutputStream                               source;
+    std::vector<std::shared_ptr<gfxrecon::util::MemoryOutputStream>> long_lived;
+    std::vector<std::shared_ptr<gfxrecon::util::MemoryOutputStream>> transient;
+
+    const uint8_t data[200] = {};
+    source.Write(data, sizeof(data));
+
+    // Each long-lived parameter keeps its slab alive while the transient parameters around it are released.
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        long_lived.push_back(gfxrecon::encode::CreateParameterArena::CopyParameters(arena, &source));
+
+        for (uint32_t j = 0; j < 100; ++j)
+        {
+            transient.push_back(gfxrecon::encode::CreateParameterArena::CopyParameters(arena, &source));
+        }
+
+        transient.clear();
+    }
+
+    // Without reuse, the slabs would hold every transient allocation made in the loop.
+    auto statistics = arena->GetStatistics();
+    REQUIRE(statistics.allocation_count == (long_lived.size() * 2));
+    REQUIRE(statistics.slab_bytes <=
+            (statistics.allocation_bytes + gfxrecon::encode::CreateParameterArena::kSlabSize * 2));
+
+    SECTION("Reused memory holds the copied parameters")
+    {
+        REQUIRE(long_lived[1999]->GetDataSize() == sizeof(data));
+    }
+
+    long_lived.clear();
+    REQUIRE(arena->GetStatistics().slab_count == 1);
+}
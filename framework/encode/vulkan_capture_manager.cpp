@@ -96,7 +96,7 @@ void VulkanCaptureManager::DestroyInstance()
     singleton_->common_manager_->DestroyInstance(singleton_);
 }
 
-void VulkanCaptureManager::WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
+void VulkanCaptureManager::WriteTrackedState(util::OutputStream* file_stream, format::ThreadId thread_id)
 {
     VulkanStateWriter state_writer(file_stream, GetCompressor(), thread_id);
     uint64_t          n_blocks = state_tracker_->WriteState(&state_writer, GetCurrentFrame());
@@ -1893,6 +1893,7 @@ void VulkanCaptureManager::ReleaseAndroidHardwareBuffer(AHardwareBuffer* hardwar
             assert(manager != nullptr);
 
             manager->RemoveTrackedMemory(entry->second.memory_id);
+            RemoveFillMemoryReference(entry->second.memory_id);
         }
 
         // There are no more references to the buffer, so we can submit a destroy buffer command.
@@ -2233,6 +2234,7 @@ void VulkanCaptureManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMem
                                         });
 
             manager->RemoveTrackedMemory(wrapper->handle_id);
+            RemoveFillMemoryReference(wrapper->handle_id);
         }
         else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUnassisted)
         {
@@ -2295,6 +2297,7 @@ void VulkanCaptureManager::PreProcess_vkFreeMemory(VkDevice
 
                 // Remove memory tracking.
                 manager->RemoveTrackedMemory(wrapper->handle_id);
+                RemoveFillMemoryReference(wrapper->handle_id);
             }
             else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUnassisted)
             {
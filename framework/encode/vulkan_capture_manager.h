@@ -1289,7 +1289,7 @@ class VulkanCaptureManager : public ApiCaptureManager
         state_tracker_ = nullptr;
     }
 
-    virtual void WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id) override;
+    virtual void WriteTrackedState(util::OutputStream* file_stream, format::ThreadId thread_id) override;
 
   private:
     struct HardwareBufferInfo
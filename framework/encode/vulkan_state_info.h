@@ -30,6 +30,7 @@
 
 #include "vulkan/vulkan.h"
 
+#include <cassert>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -64,20 +65,224 @@ struct DescriptorBindingInfo
     bool             immutable_samplers{ 0 };
 };
 
+// Bitset recording which descriptors of a binding have been written.  Storage is not allocated until the first
+// descriptor is written.
+class DescriptorWriteMask
+{
+  public:
+    void Initialize(uint32_t count)
+    {
+        count_ = count;
+        words_.clear();
+    }
+
+    bool IsSet(uint32_t index) const
+    {
+        assert(index < count_);
+        return !words_.empty() && ((words_[index / kWordBits] & (uint64_t{ 1 } << (index % kWordBits))) != 0);
+    }
+
+    void Set(uint32_t index, bool written)
+    {
+        assert(index < count_);
+
+        if (words_.empty())
+        {
+            if (!written)
+            {
+                return;
+            }
+
+            words_.resize((count_ + kWordBits - 1) / kWordBits, 0);
+        }
+
+        const uint64_t bit = uint64_t{ 1 } << (index % kWordBits);
+        if (written)
+        {
+            words_[index / kWordBits] |= bit;
+        }
+        else
+        {
+            words_[index / kWordBits] &= ~bit;
+        }
+    }
+
+    void SetRange(uint32_t first, uint32_t count)
+    {
+        assert((first <= count_) && (count <= (count_ - first)));
+
+        if ((count > 0) && words_.empty())
+        {
+            words_.resize((count_ + kWordBits - 1) / kWordBits, 0);
+        }
+
+        const uint32_t end = first + count;
+        while (first < end)
+        {
+            if (((first % kWordBits) == 0) && ((end - first) >= kWordBits))
+            {
+                words_[first / kWordBits] = ~uint64_t{ 0 };
+                first += kWordBits;
+            }
+            else
+            {
+                words_[first / kWordBits] |= uint64_t{ 1 } << (first % kWordBits);
+                ++first;
+            }
+        }
+    }
+
+    // Returns the index of the first written descriptor at or after index, or the binding's descriptor count when no
+    // descriptor in that range has been written.
+    uint32_t FindNext(uint32_t index) const
+    {
+        if (words_.empty())
+        {
+            return count_;
+        }
+
+        while (index < count_)
+        {
+            uint64_t word = words_[index / kWordBits] >> (index % kWordBits);
+            if (word == 0)
+            {
+                index = ((index / kWordBits) + 1) * kWordBits;
+            }
+            else
+            {
+                while ((word & 1) == 0)
+                {
+                    word >>= 1;
+                    ++index;
+                }
+                return index;
+            }
+        }
+
+        return count_;
+    }
+
+  private:
+    static const uint32_t kWordBits = 64;
+
+    uint32_t              count_{ 0 };
+    std::vector<uint64_t> words_;
+};
+
+// Number of descriptors stored by each DescriptorArray chunk.
+const uint32_t kDescriptorChunkSize = 1024;
+
+// Array of descriptor values that is allocated in fixed size chunks when a chunk's first element is written, so that
+// large variable count bindings only consume memory for the ranges that are in use.  Values are only contiguous
+// within a chunk, so descriptor writes that reference the stored values must not cross a multiple of
+// kDescriptorChunkSize.
+template <typename T>
+class DescriptorArray
+{
+  public:
+    void Initialize(uint32_t count)
+    {
+        count_ = count;
+        chunks_.clear();
+    }
+
+    bool IsInitialized() const { return count_ > 0; }
+
+    // Returns nullptr when the chunk containing the element has not been allocated.
+    const T* Get(uint32_t index) const
+    {
+        assert(index < count_);
+
+        const uint32_t chunk_index = index / kDescriptorChunkSize;
+        if ((chunk_index < chunks_.size()) && (chunks_[chunk_index] != nullptr))
+        {
+            return &chunks_[chunk_index][index % kDescriptorChunkSize];
+        }
+
+        return nullptr;
+    }
+
+    // Returns a value initialized element when the chunk containing the element has not been allocated.
+    T GetValue(uint32_t index) const
+    {
+        const T* value = Get(index);
+        return (value != nullptr) ? *value : T{};
+    }
+
+    // Values can only be stored to an initialized array, which is an array that is used by the binding's descriptor
+    // type.  Other arrays are left empty.
+    void Set(uint32_t index, const T& value)
+    {
+        assert(index < count_);
+
+        if (index < count_)
+        {
+            *GetWritable(index) = value;
+        }
+    }
+
+    void Fill(uint32_t first, uint32_t count, const T& value)
+    {
+        for (uint32_t i = first; i < (first + count); ++i)
+        {
+            Set(i, value);
+        }
+    }
+
+    // Copies an element from another array, when it has been written to that array and this array is initialized.
+    void Copy(uint32_t dst_index, const DescriptorArray& src, uint32_t src_index)
+    {
+        const T* value = (IsInitialized() && src.IsInitialized()) ? src.Get(src_index) : nullptr;
+        if (value != nullptr)
+        {
+            Set(dst_index, *value);
+        }
+    }
+
+  private:
+    T* GetWritable(uint32_t index)
+    {
+        assert(index < count_);
+
+        if (chunks_.empty())
+        {
+            chunks_.resize((count_ + kDescriptorChunkSize - 1) / kDescriptorChunkSize);
+        }
+
+        const uint32_t chunk_index = index / kDescriptorChunkSize;
+        auto&          chunk       = chunks_[chunk_index];
+        if (chunk == nullptr)
+        {
+            // The final chunk is only as large as the number of elements remaining in the binding.
+            const uint32_t remaining  = count_ - (chunk_index * kDescriptorChunkSize);
+            const uint32_t chunk_size = (remaining < kDescriptorChunkSize) ? remaining : kDescriptorChunkSize;
+            chunk                     = std::make_unique<T[]>(chunk_size);
+        }
+
+        return &chunk[index % kDescriptorChunkSize];
+    }
+
+  private:
+    uint32_t                          count_{ 0 };
+    std::vector<std::unique_ptr<T[]>> chunks_;
+};
+
+// Only the arrays required by the binding's descriptor type are initialized, with mutable type bindings initializing
+// the arrays for all of the types that can be written to them.
 struct DescriptorInfo
 {
-    VkDescriptorType                              type;
-    uint32_t                                      count{ 0 };
-    bool                                          immutable_samplers{ false };
-    std::unique_ptr<bool[]>                       written;
-    std::unique_ptr<format::HandleId[]>           handle_ids;  // Image, buffer, or buffer view IDs depending on type.
-    std::unique_ptr<format::HandleId[]>           sampler_ids; // Sampler IDs for image type.
-    std::unique_ptr<VkDescriptorImageInfo[]>      images;
-    std::unique_ptr<VkDescriptorBufferInfo[]>     buffers;
-    std::unique_ptr<VkBufferView[]>               texel_buffer_views;
-    std::unique_ptr<VkAccelerationStructureKHR[]> acceleration_structures;
-    std::unique_ptr<uint8_t[]>                    inline_uniform_block;
-    std::unique_ptr<VkDescriptorType[]>           mutable_type;
+    VkDescriptorType                            type;
+    uint32_t                                    count{ 0 };
+    bool                                        immutable_samplers{ false };
+    DescriptorWriteMask                         written;
+    DescriptorArray<format::HandleId>           handle_ids;  // Image, buffer, or buffer view IDs depending on type.
+    DescriptorArray<format::HandleId>           sampler_ids; // Sampler IDs for sampler types.
+    DescriptorArray<VkDescriptorImageInfo>      images;
+    DescriptorArray<VkDescriptorBufferInfo>     buffers;
+    DescriptorArray<VkBufferView>               texel_buffer_views;
+    DescriptorArray<VkAccelerationStructureKHR> acceleration_structures;
+    std::unique_ptr<uint8_t[]>                  inline_uniform_block;
+    DescriptorArray<VkDescriptorType>           mutable_type;
 };
 
 struct CreateDependencyInfo
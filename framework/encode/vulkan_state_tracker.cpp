@@ -29,11 +29,12 @@
 #include "graphics/vulkan_util.h"
 
 #include <algorithm>
+#include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
-VulkanStateTracker::VulkanStateTracker() {}
+VulkanStateTracker::VulkanStateTracker() : create_parameter_arena_(std::make_shared<CreateParameterArena>()) {}
 
 VulkanStateTracker::~VulkanStateTracker() {}
 
@@ -609,6 +610,70 @@ void VulkanStateTracker::TrackCommandBufferSubmissions2(uint32_t submit_count, c
     }
 }
 
+void VulkanStateTracker::CopyDescriptor(const vulkan_state_info::DescriptorInfo& src_binding,
+                                        uint32_t                                 src_index,
+                                        vulkan_state_info::DescriptorInfo*       dst_binding,
+                                        uint32_t                                 dst_index)
+{
+    assert(dst_binding != nullptr);
+
+    const VkDescriptorType type = (src_binding.type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
+                                      ? src_binding.mutable_type.GetValue(src_index)
+                                      : src_binding.type;
+
+    if (dst_binding->type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
+    {
+        dst_binding->mutable_type.Set(dst_index, type);
+    }
+
+    switch (type)
+    {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            dst_binding->sampler_ids.Copy(dst_index, src_binding.sampler_ids, src_index);
+            dst_binding->images.Copy(dst_index, src_binding.images, src_index);
+            break;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            dst_binding->handle_ids.Copy(dst_index, src_binding.handle_ids, src_index);
+            dst_binding->sampler_ids.Copy(dst_index, src_binding.sampler_ids, src_index);
+            dst_binding->images.Copy(dst_index, src_binding.images, src_index);
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            dst_binding->handle_ids.Copy(dst_index, src_binding.handle_ids, src_index);
+            dst_binding->images.Copy(dst_index, src_binding.images, src_index);
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            dst_binding->handle_ids.Copy(dst_index, src_binding.handle_ids, src_index);
+            dst_binding->buffers.Copy(dst_index, src_binding.buffers, src_index);
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            dst_binding->handle_ids.Copy(dst_index, src_binding.handle_ids, src_index);
+            dst_binding->texel_buffer_views.Copy(dst_index, src_binding.texel_buffer_views, src_index);
+            break;
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+            if ((src_binding.inline_uniform_block != nullptr) && (dst_binding->inline_uniform_block != nullptr))
+            {
+                dst_binding->inline_uniform_block[dst_index] = src_binding.inline_uniform_block[src_index];
+            }
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            // TODO
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            dst_binding->handle_ids.Copy(dst_index, src_binding.handle_ids, src_index);
+            dst_binding->acceleration_structures.Copy(dst_index, src_binding.acceleration_structures, src_index);
+            break;
+        default:
+            GFXRECON_LOG_WARNING("Attempting to track descriptor state for unrecognized descriptor type");
+            break;
+    }
+}
+
 void VulkanStateTracker::TrackQuerySubmissions(vulkan_wrappers::CommandBufferWrapper* command_wrapper)
 {
     // Apply pending image layouts.
@@ -675,45 +740,43 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
                 // consecutive bindings are being updated.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_dst_array_element));
 
-                bool* written_start = &binding.written[current_dst_array_element];
-                std::fill(written_start, written_start + current_writes, true);
+                binding.written.SetRange(current_dst_array_element, current_writes);
 
                 if (binding.type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
                 {
-                    VkDescriptorType* mutable_type_start = &binding.mutable_type[current_dst_array_element];
-                    std::fill(mutable_type_start, mutable_type_start + current_writes, write->descriptorType);
+                    binding.mutable_type.Fill(current_dst_array_element, current_writes, write->descriptorType);
                 }
 
                 switch (write->descriptorType)
                 {
                     case VK_DESCRIPTOR_TYPE_SAMPLER:
                     {
-                        format::HandleId*            dst_sampler_ids = &binding.sampler_ids[current_dst_array_element];
-                        VkDescriptorImageInfo*       dst_info        = &binding.images[current_dst_array_element];
-                        const VkDescriptorImageInfo* src_info        = &write->pImageInfo[current_src_array_element];
+                        const VkDescriptorImageInfo* src_info = &write->pImageInfo[current_src_array_element];
 
                         for (uint32_t i = 0; i < current_writes; ++i)
                         {
-                            dst_sampler_ids[i] =
+                            const uint32_t         dst_index  = current_dst_array_element + i;
+                            const format::HandleId sampler_id =
                                 vulkan_wrappers::GetWrappedId<vulkan_wrappers::SamplerWrapper>(src_info[i].sampler);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                            binding.sampler_ids.Set(dst_index, sampler_id);
+                            binding.images.Set(dst_index, src_info[i]);
                         }
                         break;
                     }
                     case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                     {
-                        format::HandleId*            dst_sampler_ids = &binding.sampler_ids[current_dst_array_element];
-                        format::HandleId*            dst_image_ids   = &binding.handle_ids[current_dst_array_element];
-                        VkDescriptorImageInfo*       dst_info        = &binding.images[current_dst_array_element];
-                        const VkDescriptorImageInfo* src_info        = &write->pImageInfo[current_src_array_element];
+                        const VkDescriptorImageInfo* src_info = &write->pImageInfo[current_src_array_element];
 
                         for (uint32_t i = 0; i < current_writes; ++i)
                         {
-                            dst_sampler_ids[i] =
+                            const uint32_t         dst_index  = current_dst_array_element + i;
+                            const format::HandleId sampler_id =
                                 vulkan_wrappers::GetWrappedId<vulkan_wrappers::SamplerWrapper>(src_info[i].sampler);
-                            dst_image_ids[i] =
+                            const format::HandleId image_view_id =
                                 vulkan_wrappers::GetWrappedId<vulkan_wrappers::ImageViewWrapper>(src_info[i].imageView);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                            binding.sampler_ids.Set(dst_index, sampler_id);
+                            binding.handle_ids.Set(dst_index, image_view_id);
+                            binding.images.Set(dst_index, src_info[i]);
                         }
                         break;
                     }
@@ -721,15 +784,15 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
                     case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
                     case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
                     {
-                        format::HandleId*            dst_image_ids = &binding.handle_ids[current_dst_array_element];
-                        VkDescriptorImageInfo*       dst_info      = &binding.images[current_dst_array_element];
-                        const VkDescriptorImageInfo* src_info      = &write->pImageInfo[current_src_array_element];
+                        const VkDescriptorImageInfo* src_info = &write->pImageInfo[current_src_array_element];
 
                         for (uint32_t i = 0; i < current_writes; ++i)
                         {
-                            dst_image_ids[i] =
+                            const uint32_t         dst_index     = current_dst_array_element + i;
+                            const format::HandleId image_view_id =
                                 vulkan_wrappers::GetWrappedId<vulkan_wrappers::ImageViewWrapper>(src_info[i].imageView);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                            binding.handle_ids.Set(dst_index, image_view_id);
+                            binding.images.Set(dst_index, src_info[i]);
                         }
                         break;
                     }
@@ -738,30 +801,30 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
                     case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
                     case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
                     {
-                        format::HandleId*             dst_buffer_ids = &binding.handle_ids[current_dst_array_element];
-                        VkDescriptorBufferInfo*       dst_info       = &binding.buffers[current_dst_array_element];
-                        const VkDescriptorBufferInfo* src_info       = &write->pBufferInfo[current_src_array_element];
+                        const VkDescriptorBufferInfo* src_info = &write->pBufferInfo[current_src_array_element];
 
                         for (uint32_t i = 0; i < current_writes; ++i)
                         {
-                            dst_buffer_ids[i] =
+                            const uint32_t         dst_index = current_dst_array_element + i;
+                            const format::HandleId buffer_id =
                                 vulkan_wrappers::GetWrappedId<vulkan_wrappers::BufferWrapper>(src_info[i].buffer);
-                            memcpy(&dst_info[i], &src_info[i], sizeof(dst_info[i]));
+                            binding.handle_ids.Set(dst_index, buffer_id);
+                            binding.buffers.Set(dst_index, src_info[i]);
                         }
                         break;
                     }
                     case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
                     case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
                     {
-                        format::HandleId*   dst_view_ids = &binding.handle_ids[current_dst_array_element];
-                        VkBufferView*       dst_info     = &binding.texel_buffer_views[current_dst_array_element];
-                        const VkBufferView* src_info     = &write->pTexelBufferView[current_src_array_element];
+                        const VkBufferView* src_info = &write->pTexelBufferView[current_src_array_element];
 
                         for (uint32_t i = 0; i < current_writes; ++i)
                         {
-                            dst_view_ids[i] =
+                            const uint32_t         dst_index      = current_dst_array_element + i;
+                            const format::HandleId buffer_view_id =
                                 vulkan_wrappers::GetWrappedId<vulkan_wrappers::BufferViewWrapper>(src_info[i]);
-                            dst_info[i]     = src_info[i];
+                            binding.handle_ids.Set(dst_index, buffer_view_id);
+                            binding.texel_buffer_views.Set(dst_index, src_info[i]);
                         }
                         break;
                     }
@@ -773,9 +836,12 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
 
                         if (write_inline_uniform_struct != nullptr)
                         {
-                            uint8_t*       dst_inline_uniform_data = binding.inline_uniform_block.get();
+                            // Array elements and counts are specified in bytes for inline uniform blocks.
+                            uint8_t* dst_inline_uniform_data =
+                                binding.inline_uniform_block.get() + current_dst_array_element;
                             const uint8_t* src_inline_uniform_data =
-                                reinterpret_cast<const uint8_t*>(write_inline_uniform_struct->pData);
+                                reinterpret_cast<const uint8_t*>(write_inline_uniform_struct->pData) +
+                                current_src_array_element;
                             memcpy(dst_inline_uniform_data, src_inline_uniform_data, current_writes);
                         }
                     }
@@ -791,18 +857,17 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
 
                         if (write_accel_struct != nullptr)
                         {
-                            format::HandleId* dst_accel_struct_ids = &binding.handle_ids[current_dst_array_element];
-                            VkAccelerationStructureKHR* dst_accel_struct =
-                                &binding.acceleration_structures[current_dst_array_element];
                             const VkAccelerationStructureKHR* src_accel_struct =
                                 &write_accel_struct->pAccelerationStructures[current_src_array_element];
 
                             for (uint32_t i = 0; i < current_writes; ++i)
                             {
-                                dst_accel_struct_ids[i] =
+                                const uint32_t         dst_index       = current_dst_array_element + i;
+                                const format::HandleId accel_struct_id =
                                     vulkan_wrappers::GetWrappedId<vulkan_wrappers::AccelerationStructureKHRWrapper>(
                                         src_accel_struct[i]);
-                                dst_accel_struct[i] = src_accel_struct[i];
+                                binding.handle_ids.Set(dst_index, accel_struct_id);
+                                binding.acceleration_structures.Set(dst_index, src_accel_struct[i]);
                             }
                         }
                     }
@@ -850,59 +915,29 @@ void VulkanStateTracker::TrackUpdateDescriptorSets(uint32_t                    w
                 auto& dst_binding = dst_wrapper->bindings[current_dst_binding];
                 auto& src_binding = src_wrapper->bindings[current_src_binding];
 
-                assert(src_binding.type == dst_binding.type);
+                assert((src_binding.type == dst_binding.type) ||
+                       (src_binding.type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE) ||
+                       (dst_binding.type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE));
 
                 // Check available counts for consecutive updates.
                 uint32_t dst_copy_count = dst_binding.count - current_dst_array_element;
                 uint32_t src_copy_count = src_binding.count - current_src_array_element;
                 uint32_t current_copies = std::min(current_count, std::min(dst_copy_count, src_copy_count));
 
-                bool* written_start = &dst_binding.written[current_dst_array_element];
-                std::fill(written_start, written_start + current_copies, true);
-
-                memcpy(&dst_binding.handle_ids[current_dst_array_element],
-                       &src_binding.handle_ids[current_src_array_element],
-                       (sizeof(format::HandleId) * current_copies));
-
-                if (src_binding.images != nullptr)
+                // Only the descriptors that have been written to the source binding are copied.  Copying a descriptor
+                // that has not been written leaves the destination descriptor in an undefined state.
+                for (uint32_t j = 0; j < current_copies; ++j)
                 {
-                    memcpy(&dst_binding.sampler_ids[current_dst_array_element],
-                           &src_binding.sampler_ids[current_src_array_element],
-                           (sizeof(format::HandleId) * current_copies));
+                    const uint32_t dst_index = current_dst_array_element + j;
+                    const uint32_t src_index = current_src_array_element + j;
+                    const bool     written   = src_binding.written.IsSet(src_index);
 
-                    memcpy(&dst_binding.images[current_dst_array_element],
-                           &src_binding.images[current_src_array_element],
-                           (sizeof(VkDescriptorImageInfo) * current_copies));
-                }
-                if (src_binding.buffers != nullptr)
-                {
-                    memcpy(&dst_binding.buffers[current_dst_array_element],
-                           &src_binding.buffers[current_src_array_element],
-                           (sizeof(VkDescriptorBufferInfo) * current_copies));
-                }
-                if (src_binding.acceleration_structures != nullptr)
-                {
-                    memcpy(&dst_binding.acceleration_structures[current_dst_array_element],
-                           &src_binding.acceleration_structures[current_src_array_element],
-                           (sizeof(VkWriteDescriptorSetAccelerationStructureKHR) * current_copies));
-                }
-                if (src_binding.inline_uniform_block != nullptr)
-                {
-                    memcpy(&dst_binding.inline_uniform_block[current_dst_array_element],
-                           &src_binding.inline_uniform_block[current_src_array_element],
-                           current_copies);
-                }
-                if (src_binding.texel_buffer_views != nullptr)
-                {
-                    memcpy(&dst_binding.texel_buffer_views[current_dst_array_element],
-                           &src_binding.texel_buffer_views[current_src_array_element],
-                           (sizeof(VkBufferView) * current_copies));
-                }
-                if (src_binding.mutable_type != nullptr)
-                {
-                    memcpy(&dst_binding.mutable_type[current_dst_array_element],
-                           &src_binding.mutable_type[current_src_array_element],
-                           (sizeof(VkDescriptorType) * current_copies));
+                    dst_binding.written.Set(dst_index, written);
+
+                    if (written)
+                    {
+                        CopyDescriptor(src_binding, src_index, &dst_binding, dst_index);
+                    }
                 }
 
                 // Check for consecutive update.
@@ -969,36 +1004,36 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.images != nullptr);
+                assert(binding.images.IsInitialized());
 
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
+                binding.written.SetRange(current_array_element, current_writes);
 
-                format::HandleId*      dst_sampler_ids = &binding.sampler_ids[current_array_element];
-                format::HandleId*      dst_image_ids   = &binding.handle_ids[current_array_element];
-                VkDescriptorImageInfo* dst_info        = &binding.images[current_array_element];
-                const uint8_t*         src_address     = bytes + current_offset;
+                const uint8_t* src_address = bytes + current_offset;
 
                 for (uint32_t i = 0; i < current_writes; ++i)
                 {
-                    auto image_info = reinterpret_cast<const VkDescriptorImageInfo*>(src_address);
+                    const uint32_t dst_index  = current_array_element + i;
+                    auto           image_info = reinterpret_cast<const VkDescriptorImageInfo*>(src_address);
+
                     if ((binding.type == VK_DESCRIPTOR_TYPE_SAMPLER) ||
                         (binding.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER))
                     {
-                        dst_sampler_ids[i] =
+                        const format::HandleId sampler_id =
                             vulkan_wrappers::GetWrappedId<vulkan_wrappers::SamplerWrapper>(image_info->sampler);
+                        binding.sampler_ids.Set(dst_index, sampler_id);
                     }
 
                     if (binding.type != VK_DESCRIPTOR_TYPE_SAMPLER)
                     {
-                        dst_image_ids[i] =
+                        const format::HandleId image_view_id =
                             vulkan_wrappers::GetWrappedId<vulkan_wrappers::ImageViewWrapper>(image_info->imageView);
+                        binding.handle_ids.Set(dst_index, image_view_id);
                     }
 
-                    memcpy(&dst_info[i], image_info, sizeof(dst_info[i]));
+                    binding.images.Set(dst_index, *image_info);
 
                     src_address += entry.stride;
                 }
@@ -1031,24 +1066,23 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.buffers != nullptr);
+                assert(binding.buffers.IsInitialized());
 
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
+                binding.written.SetRange(current_array_element, current_writes);
 
-                format::HandleId*       dst_buffer_ids = &binding.handle_ids[current_array_element];
-                VkDescriptorBufferInfo* dst_info       = &binding.buffers[current_array_element];
-                const uint8_t*          src_address    = bytes + current_offset;
+                const uint8_t* src_address = bytes + current_offset;
 
                 for (uint32_t i = 0; i < current_writes; ++i)
                 {
-                    auto buffer_info  = reinterpret_cast<const VkDescriptorBufferInfo*>(src_address);
-                    dst_buffer_ids[i] =
+                    const uint32_t         dst_index   = current_array_element + i;
+                    auto                   buffer_info = reinterpret_cast<const VkDescriptorBufferInfo*>(src_address);
+                    const format::HandleId buffer_id =
                         vulkan_wrappers::GetWrappedId<vulkan_wrappers::BufferWrapper>(buffer_info->buffer);
-                    memcpy(&dst_info[i], buffer_info, sizeof(dst_info[i]));
+                    binding.handle_ids.Set(dst_index, buffer_id);
+                    binding.buffers.Set(dst_index, *buffer_info);
 
                     src_address += entry.stride;
                 }
@@ -1081,23 +1115,23 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.texel_buffer_views != nullptr);
+                assert(binding.texel_buffer_views.IsInitialized());
 
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
+                binding.written.SetRange(current_array_element, current_writes);
 
-                format::HandleId* dst_view_ids = &binding.handle_ids[current_array_element];
-                VkBufferView*     dst_info     = &binding.texel_buffer_views[current_array_element];
-                const uint8_t*    src_address  = bytes + current_offset;
+                const uint8_t* src_address = bytes + current_offset;
 
                 for (uint32_t i = 0; i < current_writes; ++i)
                 {
-                    auto buffer_view = reinterpret_cast<const VkBufferView*>(src_address);
-                    dst_view_ids[i]  = vulkan_wrappers::GetWrappedId<vulkan_wrappers::BufferViewWrapper>(*buffer_view);
-                    dst_info[i]      = *buffer_view;
+                    const uint32_t         dst_index      = current_array_element + i;
+                    auto                   buffer_view    = reinterpret_cast<const VkBufferView*>(src_address);
+                    const format::HandleId buffer_view_id =
+                        vulkan_wrappers::GetWrappedId<vulkan_wrappers::BufferViewWrapper>(*buffer_view);
+                    binding.handle_ids.Set(dst_index, buffer_view_id);
+                    binding.texel_buffer_views.Set(dst_index, *buffer_view);
 
                     src_address += entry.stride;
                 }
@@ -1130,24 +1164,24 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
             {
                 auto& binding = wrapper->bindings[current_binding];
 
-                assert(binding.acceleration_structures != nullptr);
+                assert(binding.acceleration_structures.IsInitialized());
 
                 // Check count for consecutive updates.
                 uint32_t current_writes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_writes, true);
+                binding.written.SetRange(current_array_element, current_writes);
 
-                format::HandleId*           dst_view_ids = &binding.handle_ids[current_array_element];
-                VkAccelerationStructureKHR* dst_info     = &binding.acceleration_structures[current_array_element];
-                const uint8_t*              src_address  = bytes + current_offset;
+                const uint8_t* src_address = bytes + current_offset;
 
                 for (uint32_t i = 0; i < current_writes; ++i)
                 {
-                    const auto* accel_struct = reinterpret_cast<const VkAccelerationStructureKHR*>(src_address);
-                    dst_view_ids[i] =
+                    const uint32_t dst_index    = current_array_element + i;
+                    const auto*    accel_struct = reinterpret_cast<const VkAccelerationStructureKHR*>(src_address);
+
+                    const format::HandleId accel_struct_id =
                         vulkan_wrappers::GetWrappedId<vulkan_wrappers::AccelerationStructureKHRWrapper>(*accel_struct);
-                    dst_info[i] = *accel_struct;
+                    binding.handle_ids.Set(dst_index, accel_struct_id);
+                    binding.acceleration_structures.Set(dst_index, *accel_struct);
 
                     src_address += entry.stride;
                 }
@@ -1183,8 +1217,7 @@ void VulkanStateTracker::TrackUpdateDescriptorSetWithTemplate(VkDescriptorSet
                 // Check count for consecutive updates.
                 const uint32_t current_num_bytes = std::min(current_count, (binding.count - current_array_element));
 
-                bool* written_start = &binding.written[current_array_element];
-                std::fill(written_start, written_start + current_num_bytes, true);
+                binding.written.SetRange(current_array_element, current_num_bytes);
 
                 const uint8_t* src_address = bytes + current_offset;
                 uint8_t*       dst_address = binding.inline_uniform_block.get() + entry.array_element;
@@ -1679,5 +1712,17 @@ void VulkanStateTracker::TrackTlasToBlasDependencies(uint32_t               comm
     }
 }
 
+void VulkanStateTracker::LogCreateParameterArenaUsage() const
+{
+    const CreateParameterArena::Statistics statistics = create_parameter_arena_->GetStatistics();
+
+    GFXRECON_LOG_INFO("Tracked object create parameters: %" PRIu64 " allocations using %" PRIu64 " of %" PRIu64
+                      " bytes in %" PRIu64 " slabs",
+                      statistics.allocation_count,
+                      statistics.allocation_bytes,
+                      statistics.slab_bytes,
+                      statistics.slab_count);
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -23,6 +23,7 @@
 #ifndef GFXRECON_ENCODE_VULKAN_STATE_TRACKER_H
 #define GFXRECON_ENCODE_VULKAN_STATE_TRACKER_H
 
+#include "encode/create_parameter_arena.h"
 #include "encode/descriptor_update_template_info.h"
 #include "encode/vulkan_handle_wrappers.h"
 #include "generated/generated_vulkan_state_table.h"
@@ -56,6 +57,8 @@ class VulkanStateTracker
     {
         if (writer != nullptr)
         {
+            LogCreateParameterArenaUsage();
+
             std::unique_lock<std::mutex> lock(state_table_mutex_);
             return writer->WriteState(state_table_, frame_number);
         }
@@ -86,8 +89,7 @@ class VulkanStateTracker
                     wrapper,
                     create_info,
                     create_call_id,
-                    std::make_shared<util::MemoryOutputStream>(create_parameter_buffer->GetData(),
-                                                               create_parameter_buffer->GetDataSize()));
+                    CreateParameterArena::CopyParameters(create_parameter_arena_, create_parameter_buffer));
             }
         }
     }
@@ -103,8 +105,8 @@ class VulkanStateTracker
         assert(new_handles != nullptr);
         assert(create_parameter_buffer != nullptr);
 
-        vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        vulkan_state_info::CreateParameters create_parameters =
+            CreateParameterArena::CopyParameters(create_parameter_arena_, create_parameter_buffer);
 
         std::unique_lock<std::mutex> lock(state_table_mutex_);
         for (uint32_t i = 0; i < count; ++i)
@@ -134,8 +136,8 @@ class VulkanStateTracker
     {
         assert(create_parameter_buffer != nullptr);
 
-        vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        vulkan_state_info::CreateParameters create_parameters =
+            CreateParameterArena::CopyParameters(create_parameter_arena_, create_parameter_buffer);
 
         {
             AddGroupHandles<ParentHandle, SecondaryHandle, Wrapper, CreateInfo>(
@@ -155,8 +157,8 @@ class VulkanStateTracker
         assert(unwrap_struct_handle != nullptr);
         assert(create_parameter_buffer != nullptr);
 
-        vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        vulkan_state_info::CreateParameters create_parameters =
+            CreateParameterArena::CopyParameters(create_parameter_arena_, create_parameter_buffer);
 
         std::unique_lock<std::mutex> lock(state_table_mutex_);
         for (uint32_t i = 0; i < count; ++i)
@@ -185,8 +187,8 @@ class VulkanStateTracker
 
         GFXRECON_UNREFERENCED_PARAMETER(unwrap_struct_handle);
 
-        vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
-            create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+        vulkan_state_info::CreateParameters create_parameters =
+            CreateParameterArena::CopyParameters(create_parameter_arena_, create_parameter_buffer);
 
         for (uint32_t i = 0; i < count; ++i)
         {
@@ -478,9 +480,21 @@ class VulkanStateTracker
 
     void TrackQuerySubmissions(vulkan_wrappers::CommandBufferWrapper* command_wrapper);
 
+    // Copies a written descriptor, where either binding may have the mutable descriptor type.  Only the values used by
+    // the descriptor's type are copied, and the type is recorded when the destination binding is mutable.
+    static void CopyDescriptor(const vulkan_state_info::DescriptorInfo& src_binding,
+                               uint32_t                                 src_index,
+                               vulkan_state_info::DescriptorInfo*       dst_binding,
+                               uint32_t                                 dst_index);
+
+    void LogCreateParameterArenaUsage() const;
+
     std::mutex       state_table_mutex_;
     VulkanStateTable state_table_;
 
+    // Storage for the create parameters of tracked objects.
+    std::shared_ptr<CreateParameterArena> create_parameter_arena_;
+
     // Keeps track of device memories' device addresses
     std::unordered_map<VkDeviceAddress, const vulkan_wrappers::DeviceMemoryWrapper*> device_memory_addresses_map;
 
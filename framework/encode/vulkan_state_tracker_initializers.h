@@ -841,53 +841,58 @@ inline void InitializePoolObjectState(VkDevice                               par
         descriptor_info.type               = binding_info.type;
         descriptor_info.count              = binding_info.count;
         descriptor_info.immutable_samplers = binding_info.immutable_samplers;
-        descriptor_info.written            = std::make_unique<bool[]>(binding_info.count);
-
-        std::fill(descriptor_info.written.get(), descriptor_info.written.get() + binding_info.count, false);
-
-        descriptor_info.handle_ids = std::make_unique<format::HandleId[]>(binding_info.count);
+        descriptor_info.written.Initialize(binding_info.count);
 
+        // Only the arrays that are used by the descriptor type are initialized.  Their storage is allocated when
+        // descriptors are written.
         switch (binding_info.type)
         {
             case VK_DESCRIPTOR_TYPE_SAMPLER:
+                descriptor_info.sampler_ids.Initialize(binding_info.count);
+                descriptor_info.images.Initialize(binding_info.count);
+                break;
             case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                descriptor_info.handle_ids.Initialize(binding_info.count);
+                descriptor_info.sampler_ids.Initialize(binding_info.count);
+                descriptor_info.images.Initialize(binding_info.count);
+                break;
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                descriptor_info.sampler_ids = std::make_unique<format::HandleId[]>(binding_info.count);
-                descriptor_info.images      = std::make_unique<VkDescriptorImageInfo[]>(binding_info.count);
+                descriptor_info.handle_ids.Initialize(binding_info.count);
+                descriptor_info.images.Initialize(binding_info.count);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                descriptor_info.buffers = std::make_unique<VkDescriptorBufferInfo[]>(binding_info.count);
+                descriptor_info.handle_ids.Initialize(binding_info.count);
+                descriptor_info.buffers.Initialize(binding_info.count);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                descriptor_info.texel_buffer_views = std::make_unique<VkBufferView[]>(binding_info.count);
+                descriptor_info.handle_ids.Initialize(binding_info.count);
+                descriptor_info.texel_buffer_views.Initialize(binding_info.count);
                 break;
             case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+                // Inline uniform block size is limited by maxInlineUniformBlockSize, so it is stored contiguously.
                 descriptor_info.inline_uniform_block = std::make_unique<uint8_t[]>(binding_info.count);
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
                 // TODO
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
-                descriptor_info.acceleration_structures =
-                    std::make_unique<VkAccelerationStructureKHR[]>(binding_info.count);
+                descriptor_info.handle_ids.Initialize(binding_info.count);
+                descriptor_info.acceleration_structures.Initialize(binding_info.count);
                 break;
             case VK_DESCRIPTOR_TYPE_MUTABLE_VALVE:
-                descriptor_info.sampler_ids        = std::make_unique<format::HandleId[]>(binding_info.count);
-                descriptor_info.images             = std::make_unique<VkDescriptorImageInfo[]>(binding_info.count);
-                descriptor_info.buffers            = std::make_unique<VkDescriptorBufferInfo[]>(binding_info.count);
-                descriptor_info.texel_buffer_views = std::make_unique<VkBufferView[]>(binding_info.count);
-                descriptor_info.acceleration_structures =
-                    std::make_unique<VkAccelerationStructureKHR[]>(binding_info.count);
-                descriptor_info.mutable_type = std::make_unique<VkDescriptorType[]>(binding_info.count);
-                std::fill(descriptor_info.mutable_type.get(),
-                          descriptor_info.mutable_type.get() + binding_info.count,
-                          VK_DESCRIPTOR_TYPE_MUTABLE_VALVE);
+                descriptor_info.handle_ids.Initialize(binding_info.count);
+                descriptor_info.sampler_ids.Initialize(binding_info.count);
+                descriptor_info.images.Initialize(binding_info.count);
+                descriptor_info.buffers.Initialize(binding_info.count);
+                descriptor_info.texel_buffer_views.Initialize(binding_info.count);
+                descriptor_info.acceleration_structures.Initialize(binding_info.count);
+                descriptor_info.mutable_type.Initialize(binding_info.count);
                 break;
             default:
                 GFXRECON_LOG_WARNING("Attempting to initialize descriptor state for unrecognized descriptor type");
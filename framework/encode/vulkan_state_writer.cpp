@@ -27,6 +27,7 @@
 #include "encode/vulkan_state_info.h"
 #include "format/format_util.h"
 #include "util/logging.h"
+#include "util/platform.h"
 
 #include <algorithm>
 #include <array>
@@ -78,11 +79,11 @@ static bool IsImageReadable(VkMemoryPropertyFlags                       property
                                                    (memory_wrapper->mapped_size == VK_WHOLE_SIZE)))));
 }
 
-VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
-                                     util::Compressor*       compressor,
-                                     format::ThreadId        thread_id) :
+VulkanStateWriter::VulkanStateWriter(util::OutputStream* output_stream,
+                                     util::Compressor*   compressor,
+                                     format::ThreadId    thread_id) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_), pending_resource_bytes_(0)
 {
     assert(output_stream != nullptr);
 }
@@ -822,6 +823,9 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
 
     std::unordered_map<format::HandleId, const util::MemoryOutputStream*> temp_ds_layouts;
 
+    // Storage for the descriptor writes of a descriptor set, which is reused for each set.
+    DescriptorSetWrites set_writes;
+
     // First pass over descriptor set table to determine which dependencies need to be created temporarily.
     state_table.VisitWrappers([&](const vulkan_wrappers::DescriptorSetWrapper* wrapper) {
         assert(wrapper != nullptr);
@@ -857,6 +861,14 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
         VkWriteDescriptorSet write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
         write.dstSet               = wrapper->handle;
 
+        set_writes.writes.clear();
+        set_writes.images.clear();
+        set_writes.buffers.clear();
+        set_writes.texel_buffer_views.clear();
+        set_writes.acceleration_structures.clear();
+        set_writes.inline_uniform_blocks.clear();
+        set_writes.acceleration_structure_writes.clear();
+
         for (const auto& binding_entry : wrapper->bindings)
         {
             const vulkan_state_info::DescriptorInfo* binding = &binding_entry.second;
@@ -864,12 +876,23 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
 
             write.dstBinding = binding_entry.first;
 
-            for (uint32_t i = 0; i < binding->count; ++i)
+            // Unwritten descriptors are skipped with the binding's write mask, so that the cost of writing a large
+            // variable count binding depends on the number of descriptors that were written to it.
+            uint32_t i = binding->written.FindNext(0);
+            while (i < binding->count)
             {
                 VkDescriptorType descriptor_type;
                 bool             write_descriptor = CheckDescriptorStatus(binding, i, state_table, &descriptor_type);
 
-                if (active != write_descriptor)
+                // An active descriptor write range ends with an invalid descriptor or a mutable descriptor type change.
+                if (active && (!write_descriptor || (descriptor_type != write.descriptorType)))
+                {
+                    active                = false;
+                    write.descriptorCount = i - write.dstArrayElement;
+                    AddDescriptorWrite(binding, write, &set_writes);
+                }
+
+                if (write_descriptor)
                 {
                     if (!active)
                     {
@@ -878,23 +901,12 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
                         write.dstArrayElement = i;
                         write.descriptorType  = descriptor_type;
                     }
-                    else
-                    {
-                        // End of an active descriptor write range.
-                        active                = false;
-                        write.descriptorCount = i - write.dstArrayElement;
-                        WriteDescriptorUpdateCommand(wrapper->device->handle_id, binding, &write);
-                    }
+
+                    ++i;
                 }
-                else if (active && (descriptor_type != write.descriptorType))
+                else
                 {
-                    // Mutable descriptor type change within an active write range
-                    // End current range
-                    write.descriptorCount = i - write.dstArrayElement;
-                    WriteDescriptorUpdateCommand(wrapper->device->handle_id, binding, &write);
-                    // Start new range
-                    write.descriptorType  = descriptor_type;
-                    write.dstArrayElement = i;
+                    i = binding->written.FindNext(i + 1);
                 }
             }
 
@@ -902,9 +914,15 @@ void VulkanStateWriter::WriteDescriptorSetState(const VulkanStateTable& state_ta
             if (active)
             {
                 write.descriptorCount = binding->count - write.dstArrayElement;
-                WriteDescriptorUpdateCommand(wrapper->device->handle_id, binding, &write);
+                AddDescriptorWrite(binding, write, &set_writes);
             }
         }
+
+        // The valid descriptor ranges of all bindings are written with a single vkUpdateDescriptorSets call.
+        if (!set_writes.writes.empty())
+        {
+            WriteDescriptorUpdateCommand(wrapper->device->handle_id, &set_writes);
+        }
     });
 
     // Temporary object destruction.
@@ -1289,94 +1307,102 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
 
     const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
 
-    for (const auto& snapshot_entry : buffer_snapshot_info)
+    size_t index = 0;
+    while (index < buffer_snapshot_info.size())
     {
-        const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
-        const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
-        const uint8_t*                              bytes          = nullptr;
-        std::vector<uint8_t>                        data;
-
-        assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
+        const BufferSnapshotInfo& snapshot_entry = buffer_snapshot_info[index];
 
         if (snapshot_entry.need_staging_copy)
         {
-            VkResult result = resource_util.ReadFromBufferResource(
-                buffer_wrapper->handle, buffer_wrapper->created_size, 0, buffer_wrapper->queue_family_index, data);
+            // Consecutive buffers that require a staging copy are read back with a single queue submission, limited
+            // to kMaxReadbackBatchSize bytes unless a single buffer is larger.
+            const uint32_t queue_family_index = snapshot_entry.buffer_wrapper->queue_family_index;
+            size_t         batch_end          = index;
+            uint64_t       batch_size         = 0;
 
-            if (result == VK_SUCCESS)
+            std::vector<graphics::VulkanResourcesUtil::BufferReadRegion> regions;
+
+            while (batch_end < buffer_snapshot_info.size())
             {
-                bytes = data.data();
+                const BufferSnapshotInfo&             batch_entry    = buffer_snapshot_info[batch_end];
+                const vulkan_wrappers::BufferWrapper* buffer_wrapper = batch_entry.buffer_wrapper;
+
+                if (!batch_entry.need_staging_copy || (buffer_wrapper->queue_family_index != queue_family_index) ||
+                    (!regions.empty() && ((batch_size + buffer_wrapper->created_size) > kMaxReadbackBatchSize)))
+                {
+                    break;
+                }
+
+                regions.push_back({ buffer_wrapper->handle, buffer_wrapper->created_size, 0 });
+                batch_size += buffer_wrapper->created_size;
+                ++batch_end;
             }
-        }
-        else
-        {
-            assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            VkResult result = VK_SUCCESS;
+            // The batch data is shared by the queued init buffer commands, and released once they have been written.
+            auto     data   = std::make_shared<std::vector<uint8_t>>();
+            VkResult result = resource_util.ReadFromBufferResources(regions, queue_family_index, *data);
 
-            if (memory_wrapper->mapped_data == nullptr)
+            size_t data_offset = 0;
+            for (; index < batch_end; ++index)
             {
-                void* map_ptr = nullptr;
-                result        = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 buffer_wrapper->bind_offset,
-                                                 buffer_wrapper->created_size,
-                                                 0,
-                                                 &map_ptr);
+                const vulkan_wrappers::BufferWrapper* buffer_wrapper = buffer_snapshot_info[index].buffer_wrapper;
 
                 if (result == VK_SUCCESS)
                 {
-                    bytes = reinterpret_cast<const uint8_t*>(map_ptr);
+                    QueueBufferData(device_wrapper, buffer_wrapper, data->data() + data_offset, data);
+                    data_offset += static_cast<size_t>(buffer_wrapper->created_size);
+                }
+                else
+                {
+                    GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                                       buffer_wrapper->handle_id);
                 }
-            }
-            else
-            {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
             }
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-            {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->created_size);
-            }
+            continue;
         }
 
-        if (bytes != nullptr)
-        {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
-
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->created_size);
-            format::InitBufferCommandHeader upload_cmd;
+        const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
+        const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
+        const uint8_t*                              bytes          = nullptr;
 
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.buffer_id = buffer_wrapper->handle_id;
-            upload_cmd.data_size = data_size;
+        assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
+        assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            if (compressor_ != nullptr)
-            {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+        VkResult result = VK_SUCCESS;
 
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        if (memory_wrapper->mapped_data == nullptr)
+        {
+            void* map_ptr = nullptr;
+            result        = device_table->MapMemory(device_wrapper->handle,
+                                             memory_wrapper->handle,
+                                             buffer_wrapper->bind_offset,
+                                             buffer_wrapper->created_size,
+                                             0,
+                                             &map_ptr);
 
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
+            if (result == VK_SUCCESS)
+            {
+                bytes = reinterpret_cast<const uint8_t*>(map_ptr);
             }
+        }
+        else
+        {
+            bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
+        }
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+        if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
+        {
+            InvalidateMappedMemoryRange(
+                device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->created_size);
+        }
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
-            ++blocks_written_;
+        if (bytes != nullptr)
+        {
+            // The data is copied or written before QueueBufferData returns, so the memory can be unmapped.
+            QueueBufferData(device_wrapper, buffer_wrapper, bytes, nullptr);
 
-            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+            if (memory_wrapper->mapped_data == nullptr)
             {
                 device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
             }
@@ -1386,9 +1412,39 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
             GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
                                buffer_wrapper->handle_id);
         }
+
+        ++index;
     }
 }
 
+void VulkanStateWriter::QueueBufferData(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                        const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                                        const uint8_t*                        data,
+                                        std::shared_ptr<std::vector<uint8_t>> data_storage)
+{
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->created_size);
+
+    const size_t                    data_size = static_cast<size_t>(buffer_wrapper->created_size);
+    format::InitBufferCommandHeader upload_cmd;
+
+    // Packet size without the resource data.
+    upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
+    upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+    upload_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+    upload_cmd.thread_id = thread_id_;
+    upload_cmd.device_id = device_wrapper->handle_id;
+    upload_cmd.buffer_id = buffer_wrapper->handle_id;
+    upload_cmd.data_size = data_size;
+
+    const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(&upload_cmd);
+
+    QueueResourceData(std::vector<uint8_t>(header_bytes, header_bytes + sizeof(upload_cmd)),
+                      data,
+                      data_size,
+                      std::move(data_storage));
+}
+
 void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                            const std::vector<ImageSnapshotInfo>& image_snapshot_info,
                                            graphics::VulkanResourcesUtil&        resource_util)
@@ -1402,7 +1458,7 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
         const vulkan_wrappers::ImageWrapper*        image_wrapper  = snapshot_entry.image_wrapper;
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
         const uint8_t*                              bytes          = nullptr;
-        std::vector<uint8_t>                        data;
+        std::shared_ptr<std::vector<uint8_t>>       data;
 
         assert((image_wrapper != nullptr) && ((image_wrapper->is_swapchain_image && memory_wrapper == nullptr) ||
                                               (!image_wrapper->is_swapchain_image && memory_wrapper != nullptr)));
@@ -1413,6 +1469,8 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
             std::vector<uint64_t> subresource_sizes;
             bool                  scaling_supported;
 
+            data = std::make_shared<std::vector<uint8_t>>();
+
             VkResult result = resource_util.ReadFromImageResourceStaging(image_wrapper->handle,
                                                                          image_wrapper->format,
                                                                          image_wrapper->image_type,
@@ -1424,7 +1482,7 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                                                                          image_wrapper->current_layout,
                                                                          image_wrapper->queue_family_index,
                                                                          snapshot_entry.aspect,
-                                                                         data,
+                                                                         *data,
                                                                          subresource_offsets,
                                                                          subresource_sizes,
                                                                          scaling_supported,
@@ -1432,7 +1490,7 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
 
             if (result == VK_SUCCESS)
             {
-                bytes = data.data();
+                bytes = data->data();
             }
         }
         else if (!image_wrapper->is_swapchain_image)
@@ -1494,29 +1552,20 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = data_size;
                 upload_cmd.level_count = image_wrapper->mip_levels;
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
-
-                // Calculate size of packet with compressed or uncompressed data size.
                 assert(!snapshot_entry.level_sizes.empty() &&
                        (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
                 size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                upload_cmd.meta_header.block_header.size += levels_size + data_size;
+                upload_cmd.meta_header.block_header.size += levels_size;
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                output_stream_->Write(bytes, data_size);
+                // The level sizes are written between the command header and the resource data.
+                const uint8_t*       header_bytes = reinterpret_cast<const uint8_t*>(&upload_cmd);
+                const uint8_t*       level_bytes  = reinterpret_cast<const uint8_t*>(snapshot_entry.level_sizes.data());
+                std::vector<uint8_t> header(header_bytes, header_bytes + sizeof(upload_cmd));
+                header.insert(header.end(), level_bytes, level_bytes + levels_size);
+
+                // The data is copied or written before QueueResourceData returns, so the memory can be unmapped.
+                QueueResourceData(std::move(header), bytes, data_size, std::move(data));
 
                 if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
                 {
@@ -1530,14 +1579,121 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = 0;
                 upload_cmd.level_count = 0;
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(&upload_cmd);
+                QueueResourceData(
+                    std::vector<uint8_t>(header_bytes, header_bytes + sizeof(upload_cmd)), nullptr, 0, nullptr);
             }
+        }
+    }
+}
 
-            ++blocks_written_;
+void VulkanStateWriter::QueueResourceData(std::vector<uint8_t>                  header,
+                                          const uint8_t*                        data,
+                                          size_t                                data_size,
+                                          std::shared_ptr<std::vector<uint8_t>> data_storage)
+{
+    assert(header.size() >= sizeof(format::MetaDataHeader));
+
+    if ((snapshot_thread_pool_ == nullptr) || (data_size == 0))
+    {
+        // Without worker threads, the data is compressed and written immediately.  Packets without data are also
+        // written here, after any queued packets, to preserve the packet order.
+        size_t compressed_size = 0;
+
+        if ((compressor_ != nullptr) && (data_size > 0))
+        {
+            compressed_size = compressor_->Compress(data_size, data, &compressed_parameter_buffer_, 0);
         }
+
+        FlushPendingResourceData();
+        WriteResourceData(&header, data, data_size, compressed_parameter_buffer_, compressed_size);
+        return;
+    }
+
+    // Worker threads must not read from mapped memory, which may be unmapped as soon as this function returns.
+    if (data_storage == nullptr)
+    {
+        data_storage = std::make_shared<std::vector<uint8_t>>(data, data + data_size);
+        data         = data_storage->data();
+    }
+
+    auto pending          = std::make_unique<PendingResourceData>();
+    pending->header       = std::move(header);
+    pending->data         = data;
+    pending->data_size    = data_size;
+    pending->data_storage = std::move(data_storage);
+
+    PendingResourceData* task_data = pending.get();
+    pending->compressed_size       = snapshot_thread_pool_->Submit([this, task_data]() {
+        return compressor_->Compress(task_data->data_size, task_data->data, &task_data->compressed_data, 0);
+    });
+
+    pending_resource_bytes_ += data_size;
+    pending_resource_data_.emplace_back(std::move(pending));
+
+    // Limit the amount of resource data that is held in memory while waiting to be written.
+    while ((pending_resource_data_.size() > kMaxPendingResourceCount) ||
+           (pending_resource_bytes_ > kMaxPendingResourceBytes))
+    {
+        WriteOldestPendingResourceData();
+    }
+}
+
+void VulkanStateWriter::WriteOldestPendingResourceData()
+{
+    assert(!pending_resource_data_.empty());
+
+    std::unique_ptr<PendingResourceData> pending = std::move(pending_resource_data_.front());
+    pending_resource_data_.pop_front();
+
+    const size_t compressed_size = pending->compressed_size.get();
+
+    WriteResourceData(&pending->header, pending->data, pending->data_size, pending->compressed_data, compressed_size);
+
+    pending_resource_bytes_ -= pending->data_size;
+}
+
+void VulkanStateWriter::FlushPendingResourceData()
+{
+    while (!pending_resource_data_.empty())
+    {
+        WriteOldestPendingResourceData();
     }
 }
 
+void VulkanStateWriter::WriteResourceData(std::vector<uint8_t>*       header,
+                                          const uint8_t*              data,
+                                          size_t                      data_size,
+                                          const std::vector<uint8_t>& compressed_data,
+                                          size_t                      compressed_size)
+{
+    assert(header != nullptr);
+
+    format::MetaDataHeader meta_header;
+    util::platform::MemoryCopy(&meta_header, sizeof(meta_header), header->data(), sizeof(meta_header));
+
+    if ((compressed_size > 0) && (compressed_size < data_size))
+    {
+        meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+        data      = compressed_data.data();
+        data_size = compressed_size;
+    }
+
+    // Calculate size of packet with compressed or uncompressed data size.
+    meta_header.block_header.size += data_size;
+    util::platform::MemoryCopy(header->data(), sizeof(meta_header), &meta_header, sizeof(meta_header));
+
+    output_stream_->Write(header->data(), header->size());
+
+    if (data_size > 0)
+    {
+        output_stream_->Write(data, data_size);
+    }
+
+    ++blocks_written_;
+}
+
 void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_table,
                                                DeviceResourceTables*   resources,
                                                VkDeviceSize*           max_resource_size,
@@ -1823,6 +1979,12 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
     WriteBufferMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
     WriteImageMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
 
+    // Resource data is compressed by worker threads, overlapping compression with the readback of the next resources.
+    if ((compressor_ != nullptr) && !resources.empty())
+    {
+        snapshot_thread_pool_ = std::make_unique<util::ThreadPool>();
+    }
+
     // Write resource memory content.
     for (const auto& resource_entry : resources)
     {
@@ -1863,6 +2025,8 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
                 ProcessImageMemory(device_wrapper, queue_family_entry.second.images, resource_util);
             }
 
+            FlushPendingResourceData();
+
             format::EndResourceInitCommand end_cmd;
             end_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(end_cmd);
             end_cmd.meta_header.block_header.type = format::kMetaDataBlock;
@@ -1879,6 +2043,8 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
             GFXRECON_LOG_ERROR("Failed to create a staging buffer to process trim state");
         }
     }
+
+    snapshot_thread_pool_.reset();
 }
 
 void VulkanStateWriter::WriteMappedMemoryState(const VulkanStateTable& state_table)
@@ -2349,78 +2515,146 @@ void VulkanStateWriter::WriteCommandBufferCommands(const vulkan_wrappers::Comman
     }
 }
 
-void VulkanStateWriter::WriteDescriptorUpdateCommand(format::HandleId                         device_id,
-                                                     const vulkan_state_info::DescriptorInfo* binding,
-                                                     VkWriteDescriptorSet*                    write)
+void VulkanStateWriter::AddDescriptorWrite(const vulkan_state_info::DescriptorInfo* binding,
+                                           const VkWriteDescriptorSet&              write,
+                                           DescriptorSetWrites*                     set_writes)
 {
-    assert((binding != nullptr) && (write != nullptr));
-
-    const VkCopyDescriptorSet* copy = nullptr;
-
-    // scratch-space for a potential pNext-struct
-    constexpr size_t max_num_bytes_p_next_data =
-        std::max(sizeof(VkWriteDescriptorSetAccelerationStructureKHR), sizeof(VkWriteDescriptorSetInlineUniformBlock));
-    std::array<uint8_t, max_num_bytes_p_next_data> p_next_data{};
+    assert((binding != nullptr) && (set_writes != nullptr));
 
-    write->pBufferInfo      = nullptr;
-    write->pImageInfo       = nullptr;
-    write->pTexelBufferView = nullptr;
-    write->pNext            = nullptr;
+    const uint32_t first = write.dstArrayElement;
+    const uint32_t count = write.descriptorCount;
 
-    switch (write->descriptorType)
+    // Descriptor value and pNext pointers are assigned by WriteDescriptorUpdateCommand, after all values for the
+    // descriptor set have been gathered.
+    switch (write.descriptorType)
     {
         case VK_DESCRIPTOR_TYPE_SAMPLER:
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
         case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-            write->pImageInfo = &binding->images[write->dstArrayElement];
+            for (uint32_t i = first; i < (first + count); ++i)
+            {
+                set_writes->images.push_back(binding->images.GetValue(i));
+            }
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-            write->pBufferInfo = &binding->buffers[write->dstArrayElement];
+            for (uint32_t i = first; i < (first + count); ++i)
+            {
+                set_writes->buffers.push_back(binding->buffers.GetValue(i));
+            }
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-            write->pTexelBufferView = &binding->texel_buffer_views[write->dstArrayElement];
-            break;
-        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
-            if (binding->inline_uniform_block != nullptr)
+            for (uint32_t i = first; i < (first + count); ++i)
             {
-                auto& p_next    = *reinterpret_cast<VkWriteDescriptorSetInlineUniformBlock*>(p_next_data.data());
-                p_next.sType    = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK;
-                p_next.pNext    = nullptr;
-                p_next.pData    = binding->inline_uniform_block.get();
-                p_next.dataSize = binding->count;
-                write->pNext    = &p_next;
+                set_writes->texel_buffer_views.push_back(binding->texel_buffer_views.GetValue(i));
             }
             break;
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+        {
+            // Array elements and counts are specified in bytes for inline uniform blocks.
+            assert(binding->inline_uniform_block != nullptr);
+
+            VkWriteDescriptorSetInlineUniformBlock inline_uniform_block = {
+                VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK
+            };
+            inline_uniform_block.dataSize = count;
+            inline_uniform_block.pData    = binding->inline_uniform_block.get() + first;
+            set_writes->inline_uniform_blocks.push_back(inline_uniform_block);
+            break;
+        }
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
             // TODO
             break;
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
         {
-            if (binding->acceleration_structures != nullptr)
+            for (uint32_t i = first; i < (first + count); ++i)
             {
-                auto& p_next = *reinterpret_cast<VkWriteDescriptorSetAccelerationStructureKHR*>(p_next_data.data());
-                p_next.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
-                p_next.pNext = nullptr;
-                p_next.accelerationStructureCount = binding->count;
-                p_next.pAccelerationStructures    = binding->acceleration_structures.get();
-                write->pNext                      = &p_next;
+                set_writes->acceleration_structures.push_back(binding->acceleration_structures.GetValue(i));
             }
+
+            VkWriteDescriptorSetAccelerationStructureKHR acceleration_structure_write = {
+                VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR
+            };
+            acceleration_structure_write.accelerationStructureCount = count;
+            set_writes->acceleration_structure_writes.push_back(acceleration_structure_write);
+            break;
         }
-        break;
         default:
             GFXRECON_LOG_WARNING("Attempting to initialize descriptor state for unrecognized descriptor type");
             break;
     }
 
+    set_writes->writes.push_back(write);
+}
+
+void VulkanStateWriter::WriteDescriptorUpdateCommand(format::HandleId device_id, DescriptorSetWrites* set_writes)
+{
+    assert(set_writes != nullptr);
+
+    const VkCopyDescriptorSet* copy = nullptr;
+
+    // Each write references the values that follow the values of the previous write with the same type of data.
+    size_t image_offset                  = 0;
+    size_t buffer_offset                 = 0;
+    size_t texel_buffer_view_offset      = 0;
+    size_t acceleration_structure_offset = 0;
+    size_t inline_uniform_block_index    = 0;
+    size_t acceleration_write_index      = 0;
+
+    for (auto& write : set_writes->writes)
+    {
+        write.pNext            = nullptr;
+        write.pImageInfo       = nullptr;
+        write.pBufferInfo      = nullptr;
+        write.pTexelBufferView = nullptr;
+
+        switch (write.descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                write.pImageInfo = &set_writes->images[image_offset];
+                image_offset += write.descriptorCount;
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                write.pBufferInfo = &set_writes->buffers[buffer_offset];
+                buffer_offset += write.descriptorCount;
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                write.pTexelBufferView = &set_writes->texel_buffer_views[texel_buffer_view_offset];
+                texel_buffer_view_offset += write.descriptorCount;
+                break;
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
+                write.pNext = &set_writes->inline_uniform_blocks[inline_uniform_block_index++];
+                break;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            {
+                auto& acceleration_write = set_writes->acceleration_structure_writes[acceleration_write_index++];
+                acceleration_write.pAccelerationStructures =
+                    &set_writes->acceleration_structures[acceleration_structure_offset];
+                acceleration_structure_offset += write.descriptorCount;
+                write.pNext = &acceleration_write;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
     encoder_.EncodeHandleIdValue(device_id);
-    encoder_.EncodeUInt32Value(1);
-    EncodeStructArray(&encoder_, write, 1);
+    encoder_.EncodeUInt32Value(static_cast<uint32_t>(set_writes->writes.size()));
+    EncodeStructArray(&encoder_, set_writes->writes.data(), set_writes->writes.size());
     encoder_.EncodeUInt32Value(0);
     EncodeStructArray(&encoder_, copy, 0);
 
@@ -3127,31 +3361,29 @@ bool VulkanStateWriter::CheckDescriptorStatus(const vulkan_state_info::Descripto
 {
     bool valid = false;
 
-    if (descriptor->type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
-    {
-        *descriptor_type = descriptor->mutable_type[index];
-    }
-    else
-    {
-        *descriptor_type = descriptor->type;
-    }
+    *descriptor_type = descriptor->type;
 
-    if (descriptor->written[index])
+    if (descriptor->written.IsSet(index))
     {
+        if (descriptor->type == VK_DESCRIPTOR_TYPE_MUTABLE_VALVE)
+        {
+            *descriptor_type = descriptor->mutable_type.GetValue(index);
+        }
+
         // Check for handles that may no longer exist, which indicates that this descriptor is stale and should
         // be ignored, as there is no valid handle to write into it.
         switch (*descriptor_type)
         {
             case VK_DESCRIPTOR_TYPE_SAMPLER:
-                if (state_table.GetSamplerWrapper(descriptor->sampler_ids[index]) != nullptr)
+                if (state_table.GetSamplerWrapper(descriptor->sampler_ids.GetValue(index)) != nullptr)
                 {
                     valid = true;
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                 if ((descriptor->immutable_samplers ||
-                     (state_table.GetSamplerWrapper(descriptor->sampler_ids[index]) != nullptr)) &&
-                    IsImageViewValid(descriptor->handle_ids[index], state_table))
+                     (state_table.GetSamplerWrapper(descriptor->sampler_ids.GetValue(index)) != nullptr)) &&
+                    IsImageViewValid(descriptor->handle_ids.GetValue(index), state_table))
                 {
                     valid = true;
                 }
@@ -3159,7 +3391,7 @@ bool VulkanStateWriter::CheckDescriptorStatus(const vulkan_state_info::Descripto
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                if (IsImageViewValid(descriptor->handle_ids[index], state_table))
+                if (IsImageViewValid(descriptor->handle_ids.GetValue(index), state_table))
                 {
                     valid = true;
                 }
@@ -3168,14 +3400,14 @@ bool VulkanStateWriter::CheckDescriptorStatus(const vulkan_state_info::Descripto
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                if (IsBufferValid(descriptor->handle_ids[index], state_table))
+                if (IsBufferValid(descriptor->handle_ids.GetValue(index), state_table))
                 {
                     valid = true;
                 }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                if (IsBufferViewValid(descriptor->handle_ids[index], state_table))
+                if (IsBufferViewValid(descriptor->handle_ids.GetValue(index), state_table))
                 {
                     valid = true;
                 }
@@ -3191,7 +3423,7 @@ bool VulkanStateWriter::CheckDescriptorStatus(const vulkan_state_info::Descripto
                 GFXRECON_LOG_WARNING("Descriptor type acceleration structure NV is not currently supported");
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
-                if (state_table.GetAccelerationStructureKHRWrapper(descriptor->handle_ids[index]) != nullptr)
+                if (state_table.GetAccelerationStructureKHRWrapper(descriptor->handle_ids.GetValue(index)) != nullptr)
                 {
                     valid = true;
                 }
@@ -33,11 +33,15 @@
 #include "graphics/vulkan_resources_util.h"
 #include "util/compressor.h"
 #include "util/defines.h"
-#include "util/file_output_stream.h"
+#include "util/output_stream.h"
 #include "util/memory_output_stream.h"
+#include "util/thread_pool.h"
 
 #include "vulkan/vulkan.h"
 
+#include <deque>
+#include <future>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -47,7 +51,7 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    VulkanStateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    VulkanStateWriter(util::OutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
 
     ~VulkanStateWriter();
 
@@ -97,6 +101,39 @@ class VulkanStateWriter
     typedef std::vector<QueryActivationData>                  QueryActivationList;
     typedef std::unordered_map<uint32_t, QueryActivationList> QueryActivationQueueFamilyTable;
 
+    // Descriptor writes for a descriptor set, which are encoded with a single vkUpdateDescriptorSets call.  Descriptor
+    // values are gathered into contiguous arrays, in the order of the writes that reference them, because tracked
+    // descriptor values are only stored contiguously within a chunk.
+    struct DescriptorSetWrites
+    {
+        std::vector<VkWriteDescriptorSet>                         writes;
+        std::vector<VkDescriptorImageInfo>                        images;
+        std::vector<VkDescriptorBufferInfo>                       buffers;
+        std::vector<VkBufferView>                                 texel_buffer_views;
+        std::vector<VkAccelerationStructureKHR>                   acceleration_structures;
+        std::vector<VkWriteDescriptorSetInlineUniformBlock>       inline_uniform_blocks;
+        std::vector<VkWriteDescriptorSetAccelerationStructureKHR> acceleration_structure_writes;
+    };
+
+    // An init buffer or init image command whose resource data is being compressed by a worker thread.  Commands are
+    // written to the output stream in the order that they were queued.
+    struct PendingResourceData
+    {
+        std::vector<uint8_t>                  header; // Command header, followed by any image level sizes.
+        const uint8_t*                        data{ nullptr };
+        size_t                                data_size{ 0 };
+        std::shared_ptr<std::vector<uint8_t>> data_storage; // Owns data, which may be shared by several commands.
+        std::vector<uint8_t>                  compressed_data;
+        std::future<size_t>                   compressed_size;
+    };
+
+    // Maximum size of the buffers that are read back with a single queue submission.
+    static const uint64_t kMaxReadbackBatchSize = 64 * 1024 * 1024;
+
+    // Limits for the resource data that is held in memory while waiting to be written.
+    static const size_t kMaxPendingResourceCount = 64;
+    static const size_t kMaxPendingResourceBytes = 256 * 1024 * 1024;
+
   private:
     void WritePhysicalDeviceState(const VulkanStateTable& state_table);
 
@@ -153,6 +190,28 @@ class VulkanStateWriter
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
                             graphics::VulkanResourcesUtil&        resource_util);
 
+    void QueueBufferData(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                         const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                         const uint8_t*                        data,
+                         std::shared_ptr<std::vector<uint8_t>> data_storage);
+
+    // Queues an init buffer or init image command for compression and writing.  When data_storage is null, data is
+    // copied or written before returning, so that it may reference mapped memory.
+    void QueueResourceData(std::vector<uint8_t>                  header,
+                           const uint8_t*                        data,
+                           size_t                                data_size,
+                           std::shared_ptr<std::vector<uint8_t>> data_storage);
+
+    void WriteOldestPendingResourceData();
+
+    void FlushPendingResourceData();
+
+    void WriteResourceData(std::vector<uint8_t>*       header,
+                           const uint8_t*              data,
+                           size_t                      data_size,
+                           const std::vector<uint8_t>& compressed_data,
+                           size_t                      compressed_size);
+
     void WriteBufferMemoryState(const VulkanStateTable& state_table,
                                 DeviceResourceTables*   resources,
                                 VkDeviceSize*           max_resource_size,
@@ -232,9 +291,12 @@ class VulkanStateWriter
     void WriteCommandBufferCommands(const vulkan_wrappers::CommandBufferWrapper* wrapper,
                                     const VulkanStateTable&                      state_table);
 
-    void WriteDescriptorUpdateCommand(format::HandleId                         device_id,
-                                      const vulkan_state_info::DescriptorInfo* binding,
-                                      VkWriteDescriptorSet*                    write);
+    // Adds a write for a contiguous range of valid descriptors from a binding to the descriptor set's writes.
+    void AddDescriptorWrite(const vulkan_state_info::DescriptorInfo* binding,
+                            const VkWriteDescriptorSet&              write,
+                            DescriptorSetWrites*                     set_writes);
+
+    void WriteDescriptorUpdateCommand(format::HandleId device_id, DescriptorSetWrites* set_writes);
 
     void WriteQueryPoolReset(format::HandleId                                             device_id,
                              const std::vector<const vulkan_wrappers::QueryPoolWrapper*>& query_pool_wrappers);
@@ -347,13 +409,17 @@ class VulkanStateWriter
     void WriteTlasToBlasDependenciesMetadata(const VulkanStateTable& state_table);
 
   private:
-    util::FileOutputStream*  output_stream_;
+    util::OutputStream*      output_stream_;
     util::Compressor*        compressor_;
     std::vector<uint8_t>     compressed_parameter_buffer_;
     format::ThreadId         thread_id_;
     util::MemoryOutputStream parameter_stream_;
     ParameterEncoder         encoder_;
     uint64_t                 blocks_written_;
+
+    std::unique_ptr<util::ThreadPool>                snapshot_thread_pool_;
+    std::deque<std::unique_ptr<PendingResourceData>> pending_resource_data_;
+    size_t                                           pending_resource_bytes_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -0,0 +1,321 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "format/capture_segment.h"
+
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+struct CaptureSegmentFile
+{
+    std::string                 filename;
+    FILE*                       file{ nullptr };
+    FileHeader                  header{};
+    std::vector<FileOptionPair> options;
+    CompressionType             compression_type{ CompressionType::kNone };
+};
+
+static bool OpenCaptureSegmentFile(const std::string& filename, CaptureSegmentFile* capture_file)
+{
+    capture_file->filename = filename;
+
+    int32_t result = util::platform::FileOpen(&capture_file->file, filename.c_str(), "rb");
+    if ((result != 0) || (capture_file->file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", filename.c_str());
+        capture_file->file = nullptr;
+        return false;
+    }
+
+    auto& header = capture_file->header;
+    if (!util::platform::FileRead(&header, sizeof(header), 1, capture_file->file) || !ValidateFileHeader(header))
+    {
+        GFXRECON_LOG_ERROR("File %s is not a valid capture file", filename.c_str());
+        return false;
+    }
+
+    capture_file->options.resize(header.num_options);
+    if ((header.num_options > 0) &&
+        !util::platform::FileRead(
+            capture_file->options.data(), sizeof(FileOptionPair) * header.num_options, 1, capture_file->file))
+    {
+        GFXRECON_LOG_ERROR("Failed to read file options from %s", filename.c_str());
+        return false;
+    }
+
+    for (const auto& option : capture_file->options)
+    {
+        if (option.key == FileOption::kCompressionType)
+        {
+            capture_file->compression_type = static_cast<CompressionType>(option.value);
+        }
+    }
+
+    return true;
+}
+
+static void CloseCaptureSegmentFile(CaptureSegmentFile* capture_file)
+{
+    if (capture_file->file != nullptr)
+    {
+        util::platform::FileClose(capture_file->file);
+        capture_file->file = nullptr;
+    }
+}
+
+// Reads the next block, including its header, into block. Returns false at the end of the file.
+static bool ReadBlock(CaptureSegmentFile* capture_file, BlockHeader* header, std::vector<uint8_t>* block)
+{
+    if (!util::platform::FileRead(header, sizeof(*header), 1, capture_file->file))
+    {
+        if (!feof(capture_file->file))
+        {
+            GFXRECON_LOG_ERROR("Failed to read block header from %s", capture_file->filename.c_str());
+        }
+        return false;
+    }
+
+    block->resize(sizeof(*header) + static_cast<size_t>(header->size));
+    util::platform::MemoryCopy(block->data(), block->size(), header, sizeof(*header));
+
+    if ((header->size > 0) &&
+        !util::platform::FileRead(
+            block->data() + sizeof(*header), static_cast<size_t>(header->size), 1, capture_file->file))
+    {
+        GFXRECON_LOG_ERROR("Failed to read block data from %s", capture_file->filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+static MarkerType GetMarkerType(const std::vector<uint8_t>& block)
+{
+    MarkerType marker_type = MarkerType::kUnknownMarker;
+    if (block.size() >= (sizeof(BlockHeader) + sizeof(marker_type)))
+    {
+        util::platform::MemoryCopy(
+            &marker_type, sizeof(marker_type), block.data() + sizeof(BlockHeader), sizeof(marker_type));
+    }
+    return marker_type;
+}
+
+static uint32_t FindJsonUint(const std::string& json, const char* key, uint32_t default_value)
+{
+    std::string quoted_key = std::string("\"") + key + "\"";
+    size_t      position   = json.find(quoted_key);
+    if (position != std::string::npos)
+    {
+        position = json.find(':', position + quoted_key.size());
+        if (position != std::string::npos)
+        {
+            return static_cast<uint32_t>(std::strtoul(json.c_str() + position + 1, nullptr, 10));
+        }
+    }
+    return default_value;
+}
+
+static bool ReadCaptureSegmentInfo(CaptureSegmentFile* capture_file, CaptureSegmentInfo* info)
+{
+    BlockHeader          header{};
+    std::vector<uint8_t> block;
+
+    while (ReadBlock(capture_file, &header, &block))
+    {
+        if ((header.type == BlockType::kFrameMarkerBlock) && (GetMarkerType(block) == MarkerType::kEndMarker))
+        {
+            ++info->frame_count;
+        }
+        else if ((header.type == BlockType::kAnnotation) && (block.size() >= sizeof(AnnotationHeader)))
+        {
+            AnnotationHeader annotation{};
+            util::platform::MemoryCopy(&annotation, sizeof(annotation), block.data(), sizeof(annotation));
+
+            const size_t data_offset = sizeof(annotation) + annotation.label_length;
+            if ((data_offset + annotation.data_length) <= block.size())
+            {
+                std::string label(reinterpret_cast<const char*>(block.data()) + sizeof(annotation),
+                                  annotation.label_length);
+                if (label == kAnnotationLabelCaptureSegment)
+                {
+                    std::string data(reinterpret_cast<const char*>(block.data()) + data_offset,
+                                     static_cast<size_t>(annotation.data_length));
+                    info->segment     = FindJsonUint(data, "segment", kUnknownCaptureSegment);
+                    info->first_frame = FindJsonUint(data, "first-frame", 0);
+                }
+            }
+        }
+    }
+
+    return feof(capture_file->file) != 0;
+}
+
+bool ReadCaptureSegmentInfo(const std::string& filename, CaptureSegmentInfo* info)
+{
+    CaptureSegmentFile capture_file;
+
+    bool success = OpenCaptureSegmentFile(filename, &capture_file) && ReadCaptureSegmentInfo(&capture_file, info);
+
+    CloseCaptureSegmentFile(&capture_file);
+
+    return success;
+}
+
+// Copies the blocks of a segment to the output file. The header of every segment after the first is skipped, along
+// with the blocks that precede its first frame: the exe info and annotations written when the segment was created,
+// and the state snapshot, which is already represented by the calls from the preceding segments.
+static bool CopyCaptureSegment(CaptureSegmentFile* capture_file, FILE* output, bool skip_snapshot)
+{
+    BlockHeader          header{};
+    std::vector<uint8_t> block;
+
+    bool     in_preamble   = skip_snapshot;
+    bool     snapshot_seen = false;
+    uint32_t depth         = 0;
+
+    while (ReadBlock(capture_file, &header, &block))
+    {
+        if (in_preamble)
+        {
+            if (header.type == BlockType::kStateMarkerBlock)
+            {
+                if (GetMarkerType(block) == MarkerType::kBeginMarker)
+                {
+                    ++depth;
+                }
+                else if (depth > 0)
+                {
+                    --depth;
+                    snapshot_seen = true;
+                }
+                continue;
+            }
+            else if ((depth > 0) || (!snapshot_seen && ((header.type == BlockType::kAnnotation) ||
+                                                        (RemoveCompressedBlockBit(header.type) ==
+                                                         BlockType::kMetaDataBlock))))
+            {
+                continue;
+            }
+
+            in_preamble = false;
+        }
+
+        if (!util::platform::FileWrite(block.data(), block.size(), 1, output))
+        {
+            GFXRECON_LOG_ERROR("Failed to write to output file");
+            return false;
+        }
+    }
+
+    if (skip_snapshot && !snapshot_seen)
+    {
+        GFXRECON_LOG_WARNING("No state snapshot was found at the start of %s", capture_file->filename.c_str());
+    }
+
+    return feof(capture_file->file) != 0;
+}
+
+bool ConcatenateCaptureSegments(const std::vector<std::string>& filenames, const std::string& output_filename)
+{
+    FILE*   output = nullptr;
+    int32_t result = util::platform::FileOpen(&output, output_filename.c_str(), "wb");
+    if ((result != 0) || (output == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open output file %s", output_filename.c_str());
+        return false;
+    }
+
+    bool            success          = true;
+    uint32_t        previous_segment = kUnknownCaptureSegment;
+    CompressionType compression_type = CompressionType::kNone;
+
+    for (size_t i = 0; success && (i < filenames.size()); ++i)
+    {
+        CaptureSegmentFile capture_file;
+        CaptureSegmentInfo info;
+
+        success = OpenCaptureSegmentFile(filenames[i], &capture_file) && ReadCaptureSegmentInfo(&capture_file, &info);
+
+        if (success)
+        {
+            if (info.segment == kUnknownCaptureSegment)
+            {
+                GFXRECON_LOG_WARNING("File %s is not a capture file segment", filenames[i].c_str());
+            }
+            else if ((previous_segment != kUnknownCaptureSegment) && (info.segment != (previous_segment + 1)))
+            {
+                GFXRECON_LOG_WARNING("Segment %u follows segment %u; replay of the output file may fail",
+                                     info.segment,
+                                     previous_segment);
+            }
+            previous_segment = info.segment;
+
+            // Rewind to the first block.
+            const int64_t header_size =
+                sizeof(capture_file.header) + (capture_file.options.size() * sizeof(FileOptionPair));
+            clearerr(capture_file.file);
+            util::platform::FileSeek(capture_file.file, header_size, util::platform::FileSeekOrigin::FileSeekSet);
+
+            if (i == 0)
+            {
+                compression_type = capture_file.compression_type;
+
+                success = util::platform::FileWrite(&capture_file.header, sizeof(capture_file.header), 1, output) &&
+                          (capture_file.options.empty() ||
+                           util::platform::FileWrite(capture_file.options.data(),
+                                                     sizeof(FileOptionPair) * capture_file.options.size(),
+                                                     1,
+                                                     output));
+            }
+            else if (capture_file.compression_type != compression_type)
+            {
+                // Blocks are copied without decompression, so all segments must use the same compression type.
+                GFXRECON_LOG_ERROR("File %s uses a different compression type than %s",
+                                   filenames[i].c_str(),
+                                   filenames[0].c_str());
+                success = false;
+            }
+
+            if (success)
+            {
+                success = CopyCaptureSegment(&capture_file, output, (i > 0));
+            }
+        }
+
+        CloseCaptureSegmentFile(&capture_file);
+    }
+
+    util::platform::FileClose(output);
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,56 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+/// @file Listing and concatenation of the capture file segments written when capture file splitting is enabled.
+#ifndef GFXRECON_FORMAT_CAPTURE_SEGMENT_H
+#define GFXRECON_FORMAT_CAPTURE_SEGMENT_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+const uint32_t kUnknownCaptureSegment = 0xffffffff;
+
+struct CaptureSegmentInfo
+{
+    uint32_t segment{ kUnknownCaptureSegment }; // Index from the capture-segment annotation, if present.
+    uint32_t first_frame{ 0 };
+    uint32_t frame_count{ 0 }; // Number of end of frame markers in the file.
+};
+
+// Reads the capture segment annotation, if present, and counts the frames that the file contains.
+bool ReadCaptureSegmentInfo(const std::string& filename, CaptureSegmentInfo* info);
+
+// Joins consecutive capture file segments into a single file.  Blocks are copied without decoding.  The file header,
+// preamble, and state snapshot of the first segment are kept, while the preamble and state snapshot of every
+// following segment are removed, because the state that they describe is already represented by the calls from the
+// preceding segments.
+bool ConcatenateCaptureSegments(const std::vector<std::string>& filenames, const std::string& output_filename);
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FORMAT_CAPTURE_SEGMENT_H
@@ -70,6 +70,9 @@ const int8_t   kNoneIndex                 = -1;
 const char* const kAnnotationLabelOperation          = "operation";
 const char* const kAnnotationLabelReplayOptions      = "replayopts";
 const char* const kAnnotationLabelRemovedResource    = "removed-resource";
+const char* const kAnnotationLabelFlightRecorder     = "flight-recorder";
+const char* const kAnnotationLabelCaptureSegment     = "capture-segment";
+const char* const kAnnotationLabelCaptureStatistics  = "capture-statistics";
 const char* const kAnnotationPipelineCreationAttempt = "pipelinecreationattempt";
 
 const char* const kOperationAnnotationGfxreconstructVersion = "gfxrecon-version";
@@ -153,6 +156,7 @@ enum class MetaDataType : uint16_t
     kReserved29                             = 29,
     kReserved30                             = 30,
     kReserved31                             = 31,
+    kFillMemoryDeltaCommand                 = 32,
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -325,6 +329,29 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Describes a range of changed bytes within the memory range of a FillMemoryDeltaCommand.
+struct FillMemoryDeltaSpan
+{
+    uint32_t offset; // Offset from FillMemoryDeltaCommandHeader::memory_offset to the start of the changed bytes.
+    uint32_t size;   // Number of changed bytes.
+};
+
+struct FillMemoryDeltaCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Size of the memory range that was checked for changes.
+    uint64_t         span_count;    // Number of FillMemoryDeltaSpan entries encoded after the header.
+    uint64_t         data_size;     // Uncompressed size of the data encoded after the header.
+
+    // The data for FillMemoryDeltaCommand will be organized as:
+    // span_count * FillMemoryDeltaSpan // changed byte ranges, in increasing offset order
+    // sum of span sizes * uint8_t      // changed bytes for each span, in span order
+    // Bytes within the memory range that are not covered by a span are unchanged from the previous fill command.
+};
+
 struct FillMemoryResourceValueCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -46,7 +46,7 @@ bool ValidateFileHeader(const FileHeader& header)
     return valid;
 }
 
-util::Compressor* CreateCompressor(CompressionType type)
+util::Compressor* CreateCompressor(CompressionType type, int level)
 {
     util::Compressor* compressor = nullptr;
 
@@ -62,7 +62,7 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
         case kZlib:
 #if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
-            compressor = new util::ZlibCompressor();
+            compressor = new util::ZlibCompressor((level != 0) ? level : util::ZlibCompressor::kDefaultLevel);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with zlib compression disabled.");
@@ -70,7 +70,7 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
         case kZstd:
 #if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
-            compressor = new util::ZstdCompressor();
+            compressor = new util::ZstdCompressor((level != 0) ? level : util::ZstdCompressor::kDefaultLevel);
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with Zstandard compression disabled.");
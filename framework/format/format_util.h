@@ -91,7 +91,8 @@ constexpr size_t GetAnnotationBlockBaseSize()
 bool ValidateFileHeader(const FileHeader& header);
 
 // Utilities for object creation.
-util::Compressor* CreateCompressor(CompressionType type);
+// A level of 0 selects the default level of the compression type.  The level is ignored by LZ4.
+util::Compressor* CreateCompressor(CompressionType type, int level = 0);
 
 std::string GetCompressionTypeName(CompressionType type);
 
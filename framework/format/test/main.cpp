@@ -25,3 +25,187 @@
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
+
+#include "format/capture_segment.h"
+#include "format/format.h"
+#include "util/logging.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+void AppendBytes(std::vector<uint8_t>* buffer, const void* data, size_t size)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+    buffer->insert(buffer->end(), bytes, bytes + size);
+}
+
+void AppendFileHeader(std::vector<uint8_t>* buffer)
+{
+    gfxrecon::format::FileHeader header{ GFXRECON_FOURCC, 0, 1, 1 };
+    gfxrecon::format::FileOptionPair option{ gfxrecon::format::FileOption::kCompressionType,
+                                             gfxrecon::format::CompressionType::kNone };
+    AppendBytes(buffer, &header, sizeof(header));
+    AppendBytes(buffer, &option, sizeof(option));
+}
+
+void AppendMarker(std::vector<uint8_t>*        buffer,
+                  gfxrecon::format::BlockType  block_type,
+                  gfxrecon::format::MarkerType marker_type,
+                  uint64_t                     frame_number)
+{
+    gfxrecon::format::Marker marker{};
+    marker.header.size  = sizeof(marker.marker_type) + sizeof(marker.frame_number);
+    marker.header.type  = block_type;
+    marker.marker_type  = marker_type;
+    marker.frame_number = frame_number;
+    AppendBytes(buffer, &marker, sizeof(marker));
+}
+
+void AppendAnnotation(std::vector<uint8_t>* buffer, const std::string& label, const std::string& data)
+{
+    gfxrecon::format::AnnotationHeader annotation{};
+    annotation.block_header.size = sizeof(annotation.annotation_type) + sizeof(annotation.label_length) +
+                                   sizeof(annotation.data_length) + label.size() + data.size();
+    annotation.block_header.type = gfxrecon::format::BlockType::kAnnotation;
+    annotation.annotation_type   = gfxrecon::format::AnnotationType::kJson;
+    annotation.label_length      = static_cast<uint32_t>(label.size());
+    annotation.data_length       = data.size();
+    AppendBytes(buffer, &annotation, sizeof(annotation));
+    AppendBytes(buffer, label.data(), label.size());
+    AppendBytes(buffer, data.data(), data.size());
+}
+
+// Appends a block with an arbitrary payload, standing in for an API call or meta-data command.
+void AppendBlock(std::vector<uint8_t>* buffer, gfxrecon::format::BlockType type, uint32_t value)
+{
+    gfxrecon::format::BlockHeader header{ sizeof(value), type };
+    AppendBytes(buffer, &header, sizeof(header));
+    AppendBytes(buffer, &value, sizeof(value));
+}
+
+// Appends the blocks that capture writes when it creates a segment: the exe info, the capture options, and the
+// capture segment annotation.
+void AppendSegmentPreamble(std::vector<uint8_t>* buffer, uint32_t segment, uint32_t first_frame)
+{
+    AppendFileHeader(buffer);
+    AppendBlock(buffer, gfxrecon::format::BlockType::kMetaDataBlock, 0xe0);
+    AppendAnnotation(buffer, gfxrecon::format::kOperationAnnotationCaptureParameters, "{}");
+    AppendAnnotation(buffer,
+                     gfxrecon::format::kAnnotationLabelCaptureSegment,
+                     "{\n    \"segment\": " + std::to_string(segment) + ",\n    \"first-frame\": " +
+                         std::to_string(first_frame) + "\n}");
+}
+
+void AppendFrames(std::vector<uint8_t>* buffer, uint32_t first_frame, uint32_t frame_count)
+{
+    for (uint32_t frame = first_frame; frame < (first_frame + frame_count); ++frame)
+    {
+        AppendBlock(buffer, gfxrecon::format::BlockType::kFunctionCallBlock, frame);
+        AppendBlock(buffer, gfxrecon::format::BlockType::kMetaDataBlock, frame);
+        AppendMarker(buffer, gfxrecon::format::BlockType::kFrameMarkerBlock, gfxrecon::format::kEndMarker, frame);
+    }
+}
+
+void AppendStateSnapshot(std::vector<uint8_t>* buffer, uint32_t frame)
+{
+    AppendMarker(buffer, gfxrecon::format::BlockType::kStateMarkerBlock, gfxrecon::format::kBeginMarker, frame);
+    AppendBlock(buffer, gfxrecon::format::BlockType::kFunctionCallBlock, 0x5a);
+    AppendBlock(buffer, gfxrecon::format::BlockType::kMetaDataBlock, 0x5b);
+    AppendMarker(buffer, gfxrecon::format::BlockType::kStateMarkerBlock, gfxrecon::format::kEndMarker, frame);
+}
+
+bool WriteTestFile(const std::string& filename, const std::vector<uint8_t>& data)
+{
+    FILE* file = std::fopen(filename.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool success = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    std::fclose(file);
+    return success;
+}
+
+std::vector<uint8_t> ReadTestFile(const std::string& filename)
+{
+    std::vector<uint8_t> data;
+    FILE*                file = std::fopen(filename.c_str(), "rb");
+    if (file != nullptr)
+    {
+        uint8_t buffer[4096];
+        size_t  count = 0;
+        while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            AppendBytes(&data, buffer, count);
+        }
+        std::fclose(file);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("Capture file segments can be concatenated into a single capture", "[capture_segment]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    // Segment 0 starts at application launch without a state snapshot. Every following segment begins with a state
+    // snapshot for its first frame.
+    std::vector<uint8_t> segment0;
+    AppendSegmentPreamble(&segment0, 0, 0);
+    AppendFrames(&segment0, 0, 3);
+
+    std::vector<uint8_t> segment1;
+    AppendSegmentPreamble(&segment1, 1, 3);
+    AppendStateSnapshot(&segment1, 3);
+    const size_t segment1_frames_offset = segment1.size();
+    AppendFrames(&segment1, 3, 2);
+
+    std::vector<uint8_t> segment2;
+    AppendSegmentPreamble(&segment2, 2, 5);
+    AppendStateSnapshot(&segment2, 5);
+    const size_t segment2_frames_offset = segment2.size();
+    AppendFrames(&segment2, 5, 4);
+
+    const std::vector<std::string> filenames = { "gfxrecon_format_test_segment_0000.gfxr",
+                                                 "gfxrecon_format_test_segment_0001.gfxr",
+                                                 "gfxrecon_format_test_segment_0002.gfxr" };
+    const std::string output_filename = "gfxrecon_format_test_concat.gfxr";
+
+    REQUIRE(WriteTestFile(filenames[0], segment0));
+    REQUIRE(WriteTestFile(filenames[1], segment1));
+    REQUIRE(WriteTestFile(filenames[2], segment2));
+
+    gfxrecon::format::CaptureSegmentInfo info;
+    REQUIRE(gfxrecon::format::ReadCaptureSegmentInfo(filenames[1], &info));
+    REQUIRE(info.segment == 1);
+    REQUIRE(info.first_frame == 3);
+    REQUIRE(info.frame_count == 2);
+
+    REQUIRE(gfxrecon::format::ConcatenateCaptureSegments(filenames, output_filename));
+
+    // The first segment is copied as is, and only the frames of the following segments are appended to it.
+    std::vector<uint8_t> expected = segment0;
+    expected.insert(expected.end(), segment1.begin() + segment1_frames_offset, segment1.end());
+    expected.insert(expected.end(), segment2.begin() + segment2_frames_offset, segment2.end());
+
+    REQUIRE(ReadTestFile(output_filename) == expected);
+
+    gfxrecon::format::CaptureSegmentInfo output_info;
+    REQUIRE(gfxrecon::format::ReadCaptureSegmentInfo(output_filename, &output_info));
+    REQUIRE(output_info.segment == 0);
+    REQUIRE(output_info.frame_count == 9);
+
+    for (const auto& filename : filenames)
+    {
+        std::remove(filename.c_str());
+    }
+    std::remove(output_filename.c_str());
+
+    gfxrecon::util::Log::Release();
+}
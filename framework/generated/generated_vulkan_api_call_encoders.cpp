@@ -520,7 +520,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
 {
     VulkanCaptureManager* manager = VulkanCaptureManager::Get();
     GFXRECON_ASSERT(manager != nullptr);
-    auto force_command_serialization = manager->GetForceCommandSerialization();
+    auto force_command_serialization = manager->GetForceFrameBoundarySerialization();
     std::shared_lock<CommonCaptureManager::ApiCallMutexT> shared_api_call_lock;
     std::unique_lock<CommonCaptureManager::ApiCallMutexT> exclusive_api_call_lock;
     if (force_command_serialization)
@@ -7234,7 +7234,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(
 {
     VulkanCaptureManager* manager = VulkanCaptureManager::Get();
     GFXRECON_ASSERT(manager != nullptr);
-    auto force_command_serialization = manager->GetForceCommandSerialization();
+    auto force_command_serialization = manager->GetForceFrameBoundarySerialization();
     std::shared_lock<CommonCaptureManager::ApiCallMutexT> shared_api_call_lock;
     std::unique_lock<CommonCaptureManager::ApiCallMutexT> exclusive_api_call_lock;
     if (force_command_serialization)
@@ -13669,7 +13669,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(
 {
     VulkanCaptureManager* manager = VulkanCaptureManager::Get();
     GFXRECON_ASSERT(manager != nullptr);
-    auto force_command_serialization = manager->GetForceCommandSerialization();
+    auto force_command_serialization = manager->GetForceFrameBoundarySerialization();
     std::shared_lock<CommonCaptureManager::ApiCallMutexT> shared_api_call_lock;
     std::unique_lock<CommonCaptureManager::ApiCallMutexT> exclusive_api_call_lock;
     if (force_command_serialization)
@@ -14647,7 +14647,7 @@ VKAPI_ATTR void VKAPI_CALL FrameBoundaryANDROID(
 {
     VulkanCaptureManager* manager = VulkanCaptureManager::Get();
     GFXRECON_ASSERT(manager != nullptr);
-    auto force_command_serialization = manager->GetForceCommandSerialization();
+    auto force_command_serialization = manager->GetForceFrameBoundarySerialization();
     std::shared_lock<CommonCaptureManager::ApiCallMutexT> shared_api_call_lock;
     std::unique_lock<CommonCaptureManager::ApiCallMutexT> exclusive_api_call_lock;
     if (force_command_serialization)
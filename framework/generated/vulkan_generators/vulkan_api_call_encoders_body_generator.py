@@ -66,6 +66,13 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
     # will be replaced by the override value.
     CAPTURE_OVERRIDES = {}
 
+    # Commands that can end a frame, which take the exclusive API call lock when ending the frame can switch to a new
+    # capture file.
+    FRAME_BOUNDARY_COMMANDS = [
+        'vkQueueSubmit', 'vkQueueSubmit2', 'vkQueueSubmit2KHR',
+        'vkFrameBoundaryANDROID'
+    ]
+
     def __init__(
         self, err_file=sys.stderr, warn_file=sys.stderr, diag_file=sys.stdout
     ):
@@ -240,7 +247,10 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         if name == "vkCreateInstance" or name == "vkQueuePresentKHR":
             body += indent + 'auto api_call_lock = VulkanCaptureManager::AcquireExclusiveApiCallLock();\n'
         else:
-            body += indent + 'auto force_command_serialization = manager->GetForceCommandSerialization();\n'
+            force_serialization = 'GetForceCommandSerialization'
+            if name in self.FRAME_BOUNDARY_COMMANDS:
+                force_serialization = 'GetForceFrameBoundarySerialization'
+            body += indent + 'auto force_command_serialization = manager->{}();\n'.format(force_serialization)
             body += indent + 'std::shared_lock<CommonCaptureManager::ApiCallMutexT> shared_api_call_lock;\n'
             body += indent + 'std::unique_lock<CommonCaptureManager::ApiCallMutexT> exclusive_api_call_lock;\n'
             body += indent + 'if (force_command_serialization)\n'
@@ -297,8 +297,12 @@ class VulkanReplayConsumerBodyGenerator(
             else:
                 dispatchfunc = 'GetDeviceTable'
 
-            if is_override:
-                dispatchfunc += '({}->handle)->{}'.format(object_name, name[2:])
+            if object_name == args[0]:
+                # Dispatch tables are cached with the object info of the dispatchable handle, so use the info instead
+                # of the handle to avoid looking up the table for every call.
+                if not is_override:
+                    object_name = self.make_dispatch_handle_info_expr(values[0], preexpr)
+                dispatchfunc += '({})->{}'.format(object_name, name[2:])
             else:
                 dispatchfunc += '({})->{}'.format(object_name, name[2:])
 
@@ -399,6 +403,27 @@ class VulkanReplayConsumerBodyGenerator(
 
         return body
 
+    def make_dispatch_handle_info_expr(self, value, preexpr):
+        """Replace the handle mapping expression for a dispatchable handle with an expression that retrieves the object
+        info for the handle, which is then used to map the handle and to retrieve the dispatch table.
+        Returns the name of the object info variable.
+        """
+        arg_name = 'in_' + value.name
+        info_name = arg_name + '_info'
+        map_expr = '{} {} = MapHandle<{type}Info>({}, &VulkanObjectInfoTable::Get{type}Info);'.format(
+            value.full_type, arg_name, value.name, type=value.base_type[2:]
+        )
+        index = preexpr.index(map_expr)
+        preexpr[index:index + 1] = [
+            'auto {} = GetObjectInfoTable().Get{}Info({});'.format(
+                info_name, value.base_type[2:], value.name
+            ),
+            '{} {} = MapHandle({}, {});'.format(
+                value.full_type, arg_name, value.name, info_name
+            )
+        ]
+        return info_name
+
     def make_variable_length_array_post_expr(
         self, name, value, values, length_name
     ):
@@ -57,13 +57,31 @@ WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame,
                            end_frame);
 }
 
+// Returns the p50, p95, and p99 nearest-rank percentiles of the values.
+static nlohmann::json GetPercentiles(std::vector<int64_t> values)
+{
+    nlohmann::json percentiles = nlohmann::json::object();
+
+    if (!values.empty())
+    {
+        ReplayCostTracker::Percentiles result = ReplayCostTracker::GetPercentiles(std::move(values));
+
+        percentiles["p50"] = result.p50;
+        percentiles["p95"] = result.p95;
+        percentiles["p99"] = result.p99;
+    }
+
+    return percentiles;
+}
+
 FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  uint64_t               measurement_end_frame,
                  bool                   has_measurement_range,
                  bool                   quit_after_range,
                  bool                   flush_measurement_range,
                  bool                   flush_inside_measurement_range,
-                 const std::string_view measurement_file_name) :
+                 const std::string_view measurement_file_name,
+                 bool                   measure_replay_costs) :
     measurement_start_frame_(measurement_start_frame),
     measurement_end_frame_(measurement_end_frame), measurement_start_time_(0), measurement_end_time_(0),
     quit_after_range_(quit_after_range), flush_measurement_range_(flush_measurement_range),
@@ -75,6 +93,11 @@ FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
     {
         GFXRECON_ASSERT(!measurement_file_name_.empty());
     }
+
+    if (measure_replay_costs)
+    {
+        cost_tracker_ = std::make_unique<ReplayCostTracker>();
+    }
 }
 
 void FpsInfo::BeginFile()
@@ -103,9 +126,15 @@ void FpsInfo::BeginFrame(uint64_t frame)
             measurement_start_time_ = util::datetime::GetTimestamp();
             started_measurement_    = true;
             frame_durations_.clear();
+            frame_costs_.clear();
         }
     }
 
+    if (cost_tracker_ != nullptr)
+    {
+        cost_tracker_->BeginFrame();
+    }
+
     frame_start_time_ = util::datetime::GetTimestamp();
 }
 
@@ -115,6 +144,11 @@ void FpsInfo::EndFrame(uint64_t frame)
     {
         frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, util::datetime::GetTimestamp()));
 
+        if (cost_tracker_ != nullptr)
+        {
+            frame_costs_.push_back(cost_tracker_->EndFrame());
+        }
+
         // Measurement frame range end is non-inclusive, as opposed to trim frame range
         if (frame >= measurement_end_frame_ - 1)
         {
@@ -140,6 +174,50 @@ void FpsInfo::EndFrame(uint64_t frame)
                                                     { "fps", fps },
                                                     { "frame_durations", frame_durations_ } } } };
 
+                if (cost_tracker_ != nullptr)
+                {
+                    // Per frame replay time for each replay stage, in nanoseconds, with percentiles over the range.
+                    nlohmann::json frame_costs = nlohmann::json::array();
+                    nlohmann::json percentiles = { { "duration", GetPercentiles(frame_durations_) } };
+
+                    for (size_t i = 0; i < frame_costs_.size(); ++i)
+                    {
+                        nlohmann::json frame_cost = { { "frame", measurement_start_frame_ + i } };
+
+                        if (i < frame_durations_.size())
+                        {
+                            frame_cost["duration"] = frame_durations_[i];
+                        }
+
+                        for (uint32_t category = 0; category < ReplayCostTracker::kCategoryCount; ++category)
+                        {
+                            const char* name = ReplayCostTracker::GetCategoryName(
+                                static_cast<ReplayCostTracker::Category>(category));
+                            frame_cost[name] = frame_costs_[i][category];
+                        }
+
+                        frame_costs.push_back(frame_cost);
+                    }
+
+                    for (uint32_t category = 0; category < ReplayCostTracker::kCategoryCount; ++category)
+                    {
+                        std::vector<int64_t> category_costs;
+                        category_costs.reserve(frame_costs_.size());
+
+                        for (const auto& costs : frame_costs_)
+                        {
+                            category_costs.push_back(costs[category]);
+                        }
+
+                        const char* name =
+                            ReplayCostTracker::GetCategoryName(static_cast<ReplayCostTracker::Category>(category));
+                        percentiles[name] = GetPercentiles(std::move(category_costs));
+                    }
+
+                    file_content["frame_range"]["frame_costs"]            = std::move(frame_costs);
+                    file_content["frame_range"]["frame_cost_percentiles"] = std::move(percentiles);
+                }
+
                 FILE*   file_pointer = nullptr;
                 int32_t result       = util::platform::FileOpen(&file_pointer, measurement_file_name_.c_str(), "w");
                 if (result == 0)
@@ -26,8 +26,10 @@
 
 #include "util/defines.h"
 #include "decode/file_processor.h"
+#include "graphics/replay_cost_tracker.h"
 
 #include <limits>
+#include <memory>
 #include <string_view>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -42,7 +44,8 @@ class FpsInfo
             bool                   quit_after_range               = false,
             bool                   flush_measurement_range        = false,
             bool                   flush_inside_measurement_range = false,
-            const std::string_view measurement_file_name          = "");
+            const std::string_view measurement_file_name          = "",
+            bool                   measure_replay_costs           = false);
 
     void LogToConsole();
 
@@ -55,6 +58,10 @@ class FpsInfo
     void EndFile(uint64_t end_file_processor_frame);
     void ProcessStateEndMarker(uint64_t file_processor_frame);
 
+    // Returns the tracker that attributes the replay time of each frame to replay stages, or nullptr if replay costs
+    // are not measured.
+    ReplayCostTracker* GetCostTracker() { return cost_tracker_.get(); }
+
   private:
     uint64_t start_time_;
 
@@ -78,6 +85,9 @@ class FpsInfo
     int64_t              frame_start_time_;
     std::vector<int64_t> frame_durations_;
 
+    std::unique_ptr<ReplayCostTracker>    cost_tracker_;
+    std::vector<ReplayCostTracker::Times> frame_costs_;
+
     std::string measurement_file_name_;
 };
 
@@ -0,0 +1,81 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "graphics/replay_cost_tracker.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+static const char* const kCategoryNames[ReplayCostTracker::kCategoryCount] = {
+    "other", "file_read", "decompress", "decode", "consumer", "wait", "resource_init"
+};
+
+ReplayCostTracker::ReplayCostTracker() :
+    current_(kOther), transition_time_(static_cast<int64_t>(util::datetime::GetTimestamp())), times_{}
+{}
+
+const char* ReplayCostTracker::GetCategoryName(Category category)
+{
+    assert(category < kCategoryCount);
+    return kCategoryNames[category];
+}
+
+ReplayCostTracker::Percentiles ReplayCostTracker::GetPercentiles(std::vector<int64_t> values)
+{
+    assert(!values.empty());
+
+    std::sort(values.begin(), values.end());
+
+    auto get_percentile = [&values](size_t percentile) {
+        size_t rank = ((values.size() * percentile) + 99) / 100;
+        return values[(rank > 0) ? (rank - 1) : 0];
+    };
+
+    Percentiles percentiles;
+    percentiles.p50 = get_percentile(50);
+    percentiles.p95 = get_percentile(95);
+    percentiles.p99 = get_percentile(99);
+
+    return percentiles;
+}
+
+void ReplayCostTracker::BeginFrame()
+{
+    Enter(current_);
+    times_.fill(0);
+}
+
+ReplayCostTracker::Times ReplayCostTracker::EndFrame()
+{
+    Enter(current_);
+
+    Times times = times_;
+    times_.fill(0);
+
+    return times;
+}
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,129 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_GRAPHICS_REPLAY_COST_TRACKER_H
+#define GFXRECON_GRAPHICS_REPLAY_COST_TRACKER_H
+
+#include "util/date_time.h"
+#include "util/defines.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(graphics)
+
+// Attributes the replay time of each frame to the replay stage that is currently active.  Stages are entered and left
+// with the Scope class, and time spent in a nested scope is only attributed to the nested stage, so that, for example,
+// the time that a consumer spends waiting on a fence is not also counted as consumer work.  The tracker is only used
+// from the thread that processes the capture file.
+class ReplayCostTracker
+{
+  public:
+    enum Category : uint32_t
+    {
+        kOther        = 0, // Time not covered by another category, such as window system event processing.
+        kFileRead     = 1,
+        kDecompress   = 2,
+        kDecode       = 3,
+        kConsumer     = 4, // Replay consumer processing, including API calls that do not wait.
+        kWait         = 5, // API calls that wait for the device, such as fence waits, queue idle waits, and present.
+        kResourceInit = 6, // Trimmed state snapshot resource initialization.
+        kCategoryCount
+    };
+
+    // Times are in nanoseconds.
+    typedef std::array<int64_t, kCategoryCount> Times;
+
+    // Nearest-rank percentiles of a series of per frame times.
+    struct Percentiles
+    {
+        int64_t p50{ 0 };
+        int64_t p95{ 0 };
+        int64_t p99{ 0 };
+    };
+
+    class Scope
+    {
+      public:
+        Scope(ReplayCostTracker* tracker, Category category) : tracker_(tracker), previous_(kOther)
+        {
+            if (tracker_ != nullptr)
+            {
+                previous_ = tracker_->Enter(category);
+            }
+        }
+
+        ~Scope()
+        {
+            if (tracker_ != nullptr)
+            {
+                tracker_->Enter(previous_);
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        ReplayCostTracker* tracker_;
+        Category           previous_;
+    };
+
+  public:
+    ReplayCostTracker();
+
+    static const char* GetCategoryName(Category category);
+
+    // Returns the percentiles of the values, which must not be empty.
+    static Percentiles GetPercentiles(std::vector<int64_t> values);
+
+    // Discards the time accumulated since the previous frame.
+    void BeginFrame();
+
+    // Returns the time accumulated for each category since the previous call to BeginFrame or EndFrame.
+    Times EndFrame();
+
+  private:
+    // Attributes the time since the previous transition to the current category, and returns the current category.
+    Category Enter(Category category)
+    {
+        const int64_t now = static_cast<int64_t>(util::datetime::GetTimestamp());
+        times_[current_] += util::datetime::DiffTimestamps(transition_time_, now);
+        transition_time_ = now;
+
+        Category previous = current_;
+        current_          = category;
+        return previous;
+    }
+
+  private:
+    Category current_;
+    int64_t  transition_time_;
+    Times    times_;
+};
+
+GFXRECON_END_NAMESPACE(graphics)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_GRAPHICS_REPLAY_COST_TRACKER_H
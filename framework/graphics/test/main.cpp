@@ -25,3 +25,85 @@
 
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch.hpp>
+
+#include "graphics/replay_cost_tracker.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using gfxrecon::graphics::ReplayCostTracker;
+
+TEST_CASE("ReplayCostTracker attributes time to the innermost scope", "[replay_cost_tracker]")
+{
+    const int64_t kSleepNs = 2000000;
+
+    ReplayCostTracker tracker;
+    tracker.BeginFrame();
+
+    {
+        ReplayCostTracker::Scope decode_scope(&tracker, ReplayCostTracker::kDecode);
+        std::this_thread::sleep_for(std::chrono::nanoseconds(kSleepNs));
+
+        {
+            ReplayCostTracker::Scope wait_scope(&tracker, ReplayCostTracker::kWait);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(kSleepNs));
+        }
+
+        std::this_thread::sleep_for(std::chrono::nanoseconds(kSleepNs));
+    }
+
+    ReplayCostTracker::Times times = tracker.EndFrame();
+
+    REQUIRE(times[ReplayCostTracker::kDecode] >= 2 * kSleepNs);
+    REQUIRE(times[ReplayCostTracker::kWait] >= kSleepNs);
+    REQUIRE(times[ReplayCostTracker::kConsumer] == 0);
+    REQUIRE(times[ReplayCostTracker::kFileRead] == 0);
+
+    // The scopes have been left, so the next frame starts with no time accumulated for them.
+    times = tracker.EndFrame();
+    REQUIRE(times[ReplayCostTracker::kDecode] == 0);
+    REQUIRE(times[ReplayCostTracker::kWait] == 0);
+}
+
+TEST_CASE("ReplayCostTracker discards time accumulated before BeginFrame", "[replay_cost_tracker]")
+{
+    ReplayCostTracker tracker;
+
+    {
+        ReplayCostTracker::Scope consumer_scope(&tracker, ReplayCostTracker::kConsumer);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    tracker.BeginFrame();
+    ReplayCostTracker::Times times = tracker.EndFrame();
+    REQUIRE(times[ReplayCostTracker::kConsumer] == 0);
+
+    // A scope without a tracker is a no-op.
+    ReplayCostTracker::Scope null_scope(nullptr, ReplayCostTracker::kDecode);
+}
+
+TEST_CASE("ReplayCostTracker computes nearest-rank percentiles", "[replay_cost_tracker]")
+{
+    ReplayCostTracker::Percentiles percentiles = ReplayCostTracker::GetPercentiles({ 7 });
+    REQUIRE(percentiles.p50 == 7);
+    REQUIRE(percentiles.p95 == 7);
+    REQUIRE(percentiles.p99 == 7);
+
+    // Values 1 to 100 in reverse order, so that the input must be sorted.
+    std::vector<int64_t> values;
+    for (int64_t i = 100; i > 0; --i)
+    {
+        values.push_back(i);
+    }
+
+    percentiles = ReplayCostTracker::GetPercentiles(values);
+    REQUIRE(percentiles.p50 == 50);
+    REQUIRE(percentiles.p95 == 95);
+    REQUIRE(percentiles.p99 == 99);
+
+    percentiles = ReplayCostTracker::GetPercentiles({ 40, 10, 30, 20 });
+    REQUIRE(percentiles.p50 == 20);
+    REQUIRE(percentiles.p95 == 40);
+    REQUIRE(percentiles.p99 == 40);
+}
@@ -899,14 +899,15 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
 void VulkanResourcesUtil::CopyBuffer(VkBuffer source_buffer,
                                      VkBuffer destination_buffer,
                                      uint64_t size,
-                                     uint64_t src_offset)
+                                     uint64_t src_offset,
+                                     uint64_t dst_offset)
 {
     assert(source_buffer != VK_NULL_HANDLE);
     assert(command_buffer_ != VK_NULL_HANDLE);
 
     VkBufferCopy copy_region;
     copy_region.srcOffset = src_offset;
-    copy_region.dstOffset = 0;
+    copy_region.dstOffset = dst_offset;
     copy_region.size      = size;
 
     device_table_.CmdCopyBuffer(command_buffer_, source_buffer, destination_buffer, 1, &copy_region);
@@ -1503,6 +1504,75 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(
     return result;
 }
 
+VkResult VulkanResourcesUtil::ReadFromBufferResources(const std::vector<BufferReadRegion>& regions,
+                                                      uint32_t                             queue_family_index,
+                                                      std::vector<uint8_t>&                data)
+{
+    uint64_t total_size = 0;
+    for (const auto& region : regions)
+    {
+        assert((region.buffer != VK_NULL_HANDLE) && (region.size > 0));
+        total_size += region.size;
+    }
+
+    if (total_size == 0)
+    {
+        data.clear();
+        return VK_SUCCESS;
+    }
+
+    const VkQueue queue = GetQueue(queue_family_index, 0);
+    if (queue == VK_NULL_HANDLE)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    VkResult result = CreateStagingBuffer(total_size);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateCommandPool(queue_family_index);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateCommandBuffer(queue_family_index);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    uint64_t staging_offset = 0;
+    for (const auto& region : regions)
+    {
+        CopyBuffer(region.buffer, staging_buffer_.buffer, region.size, region.offset, staging_offset);
+        staging_offset += region.size;
+    }
+
+    result = SubmitCommandBuffer(queue);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = MapStagingBuffer();
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, total_size);
+    data.resize(static_cast<size_t>(total_size));
+
+    InvalidateStagingBuffer();
+    util::platform::MemoryCopy(data.data(), data.size(), staging_buffer_.mapped_ptr, data.size());
+
+    return result;
+}
+
 VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage                      image,
                                                           VkFormat                     format,
                                                           VkImageType                  type,
@@ -174,6 +174,19 @@ class VulkanResourcesUtil
     VkResult ReadFromBufferResource(
         VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, std::vector<uint8_t>& data);
 
+    struct BufferReadRegion
+    {
+        VkBuffer buffer;
+        uint64_t size;
+        uint64_t offset;
+    };
+
+    // Dumps the content of several buffers that are owned by the same queue family with a single queue submission.
+    // The buffer contents are stored consecutively in the data vector, in the same order as the regions.
+    VkResult ReadFromBufferResources(const std::vector<BufferReadRegion>& regions,
+                                     uint32_t                             queue_family_index,
+                                     std::vector<uint8_t>&                data);
+
   private:
     VkResult CreateCommandPool(uint32_t queue_family_index);
 
@@ -219,7 +232,11 @@ class VulkanResourcesUtil
                          bool                         all_layers_per_level,
                          CopyBufferImageDirection     copy_direction);
 
-    void CopyBuffer(VkBuffer source_buffer, VkBuffer destination_buffer, uint64_t size, uint64_t offset);
+    void CopyBuffer(VkBuffer source_buffer,
+                    VkBuffer destination_buffer,
+                    uint64_t size,
+                    uint64_t offset,
+                    uint64_t destination_offset = 0);
 
     VkResult ResolveImage(VkImage           image,
                           VkFormat          format,
@@ -26,6 +26,8 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -61,6 +63,114 @@ Type GenerateCheckSum(const uint8_t* code, size_t code_size)
     return current_sum;
 }
 
+// Fast 64-bit content hash with good distribution, following the XXH64 algorithm.  Suitable for detecting duplicate
+// data, although callers that require an exact match must still compare the data when hashes are equal.
+class ContentHash64
+{
+  public:
+    static uint64_t Generate(const uint8_t* data, size_t size, uint64_t seed = 0)
+    {
+        const uint8_t* position = data;
+        const uint8_t* end      = data + size;
+        uint64_t       result   = 0;
+
+        if (size >= 32)
+        {
+            uint64_t v1 = seed + kPrime1 + kPrime2;
+            uint64_t v2 = seed + kPrime2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - kPrime1;
+
+            const uint8_t* limit = end - 32;
+            do
+            {
+                v1 = Round(v1, Read64(position));
+                v2 = Round(v2, Read64(position + 8));
+                v3 = Round(v3, Read64(position + 16));
+                v4 = Round(v4, Read64(position + 24));
+                position += 32;
+            } while (position <= limit);
+
+            result = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+            result = MergeRound(result, v1);
+            result = MergeRound(result, v2);
+            result = MergeRound(result, v3);
+            result = MergeRound(result, v4);
+        }
+        else
+        {
+            result = seed + kPrime5;
+        }
+
+        result += static_cast<uint64_t>(size);
+
+        while ((position + 8) <= end)
+        {
+            result ^= Round(0, Read64(position));
+            result = (RotateLeft(result, 27) * kPrime1) + kPrime4;
+            position += 8;
+        }
+
+        if ((position + 4) <= end)
+        {
+            result ^= static_cast<uint64_t>(Read32(position)) * kPrime1;
+            result = (RotateLeft(result, 23) * kPrime2) + kPrime3;
+            position += 4;
+        }
+
+        while (position < end)
+        {
+            result ^= static_cast<uint64_t>(*position) * kPrime5;
+            result = RotateLeft(result, 11) * kPrime1;
+            ++position;
+        }
+
+        result ^= result >> 33;
+        result *= kPrime2;
+        result ^= result >> 29;
+        result *= kPrime3;
+        result ^= result >> 32;
+
+        return result;
+    }
+
+  private:
+    static const uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    static const uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+    static uint64_t RotateLeft(uint64_t value, uint32_t bits) { return (value << bits) | (value >> (64 - bits)); }
+
+    static uint64_t Read64(const uint8_t* data)
+    {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static uint32_t Read32(const uint8_t* data)
+    {
+        uint32_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static uint64_t Round(uint64_t accumulator, uint64_t input)
+    {
+        accumulator += input * kPrime2;
+        accumulator = RotateLeft(accumulator, 31);
+        return accumulator * kPrime1;
+    }
+
+    static uint64_t MergeRound(uint64_t accumulator, uint64_t value)
+    {
+        accumulator ^= Round(0, value);
+        return (accumulator * kPrime1) + kPrime4;
+    }
+};
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
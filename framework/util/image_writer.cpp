@@ -236,8 +236,9 @@ static const uint8_t* ConvertIntoTemporaryBuffer(uint32_t    width,
 {
     assert(data_pitch);
 
-    static std::unique_ptr<uint8_t[]> temporary_buffer;
-    static size_t                     temporary_buffer_size = 0;
+    // Images may be written from several threads, so each thread converts into its own buffer.
+    thread_local std::unique_ptr<uint8_t[]> temporary_buffer;
+    thread_local size_t                     temporary_buffer_size = 0;
 
     uint32_t output_pitch = width * (write_alpha ? kImageBpp : kImageBppNoAlpha);
     if (!is_png)
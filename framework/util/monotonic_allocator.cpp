@@ -23,6 +23,8 @@
 
 #include "util/monotonic_allocator.h"
 
+#include "util/platform.h"
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
@@ -31,17 +33,46 @@ void MonotonicAllocator::Clear(bool free_system_memory)
     // Call destructors of allocated objects
     for (auto destructor : destructors_)
     {
-        destructor.destroy(destructor.obj);
+        destructor.destroy(destructor.objects, destructor.count);
     }
     destructors_.clear();
 
     // Free memory blocks
     if (free_system_memory)
     {
+        for (const auto& block : memory_blocks_)
+        {
+            FreeMemoryBlock(block);
+        }
         memory_blocks_.clear();
+
+        for (const auto& entry : cached_allocations_)
+        {
+            FreeMemoryBlock(entry.second.block);
+        }
+        cached_allocations_.clear();
+        cached_bytes_ = 0;
     }
 
-    // Free oversized allocations
+    // Cache or free oversized allocations
+    ++clear_count_;
+
+    for (const auto& block : oversized_allocations_)
+    {
+        if (!free_system_memory && EvictCachedAllocations(block.size))
+        {
+            CachedAllocation entry;
+            entry.block    = block;
+            entry.last_use = clear_count_;
+
+            cached_allocations_.emplace(block.size, entry);
+            cached_bytes_ += block.size;
+        }
+        else
+        {
+            FreeMemoryBlock(block);
+        }
+    }
     oversized_allocations_.clear();
 
     current_block_            = 0;
@@ -75,15 +106,13 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
 
         if (result == nullptr)
         {
-            memory_blocks_.emplace_back(new unsigned char[block_size_]);
+            memory_blocks_.push_back(AllocateMemoryBlock(block_size_));
             result = AllocateToBlock(object_bytes, alignment_bytes);
         }
     }
     else
     {
-        // Custom allocation
-        oversized_allocations_.emplace_back(new unsigned char[object_bytes]);
-        result = oversized_allocations_.back().get();
+        result = AllocateOversized(object_bytes);
     }
 
     return result;
@@ -92,7 +121,7 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
 void* MonotonicAllocator::AllocateToBlock(size_t object_bytes, size_t alignment_bytes)
 {
     void* block_ptr =
-        reinterpret_cast<void*>(memory_blocks_[current_block_].get() + block_size_ - current_block_free_bytes_);
+        reinterpret_cast<void*>(memory_blocks_[current_block_].memory + block_size_ - current_block_free_bytes_);
     void* result = std::align(alignment_bytes, object_bytes, block_ptr, current_block_free_bytes_);
     if (result != nullptr)
     {
@@ -101,5 +130,109 @@ void* MonotonicAllocator::AllocateToBlock(size_t object_bytes, size_t alignment_
     return result;
 }
 
+void* MonotonicAllocator::AllocateOversized(size_t object_bytes)
+{
+    const size_t size_class = GetSizeClass(object_bytes);
+
+    auto entry = cached_allocations_.find(size_class);
+    if (entry != cached_allocations_.end())
+    {
+        oversized_allocations_.push_back(entry->second.block);
+        cached_bytes_ -= entry->second.block.size;
+        cached_allocations_.erase(entry);
+    }
+    else if (max_cached_bytes_ > 0)
+    {
+        oversized_allocations_.push_back(AllocateMemoryBlock(size_class));
+    }
+    else
+    {
+        // Without a cache, there is no reuse to round the size up for.
+        oversized_allocations_.push_back(AllocateMemoryBlock(object_bytes));
+    }
+
+    return oversized_allocations_.back().memory;
+}
+
+bool MonotonicAllocator::EvictCachedAllocations(size_t size)
+{
+    if (size > max_cached_bytes_)
+    {
+        return false;
+    }
+
+    while ((max_cached_bytes_ - cached_bytes_) < size)
+    {
+        // Allocations released by the current Clear are not evicted to make room for each other.
+        auto oldest = cached_allocations_.end();
+        for (auto entry = cached_allocations_.begin(); entry != cached_allocations_.end(); ++entry)
+        {
+            if ((entry->second.last_use < clear_count_) &&
+                ((oldest == cached_allocations_.end()) || (entry->second.last_use < oldest->second.last_use)))
+            {
+                oldest = entry;
+            }
+        }
+
+        if (oldest == cached_allocations_.end())
+        {
+            return false;
+        }
+
+        FreeMemoryBlock(oldest->second.block);
+        cached_bytes_ -= oldest->second.block.size;
+        cached_allocations_.erase(oldest);
+    }
+
+    return true;
+}
+
+size_t MonotonicAllocator::GetSizeClass(size_t size)
+{
+    // Find the largest power of two that is less than or equal to size.
+    size_t power = 1;
+    while (power <= (size / 2))
+    {
+        power <<= 1;
+    }
+
+    const size_t step = (power >= 4) ? (power / 4) : 1;
+    return ((size + step - 1) / step) * step;
+}
+
+MonotonicAllocator::MemoryBlock MonotonicAllocator::AllocateMemoryBlock(size_t size) const
+{
+    MemoryBlock block;
+    block.size = size;
+
+    if (use_huge_pages_ && (size >= kHugePageSize))
+    {
+        const size_t aligned_size = platform::GetAlignedSize(size, platform::GetSystemPageSize());
+
+        block.memory = reinterpret_cast<unsigned char*>(platform::AllocateRawMemory(aligned_size));
+        if (block.memory != nullptr)
+        {
+            block.is_raw_memory = true;
+            platform::AdviseHugePages(block.memory, aligned_size);
+            return block;
+        }
+    }
+
+    block.memory = new unsigned char[size];
+    return block;
+}
+
+void MonotonicAllocator::FreeMemoryBlock(const MemoryBlock& block)
+{
+    if (block.is_raw_memory)
+    {
+        platform::FreeRawMemory(block.memory, platform::GetAlignedSize(block.size, platform::GetSystemPageSize()));
+    }
+    else
+    {
+        delete[] block.memory;
+    }
+}
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
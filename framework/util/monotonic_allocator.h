@@ -26,7 +26,10 @@
 
 #include "util/defines.h"
 
+#include <cassert>
+#include <map>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -38,16 +41,26 @@ class MonotonicAllocator
   public:
     // block_size is the size of the individual memory blocks allocated. The number of blocks increases as needed to
     // fit requested allocations, and blocks are freed using an appropriate call to Clear or upon destruction of this
-    // MonotonicAllocator
-    MonotonicAllocator(size_t block_size) :
-        block_size_(block_size), current_block_(0), current_block_free_bytes_(block_size)
+    // MonotonicAllocator. Up to max_cached_bytes of oversized allocations are retained by Clear for reuse by later
+    // oversized allocations of the same size class, evicting the least recently used allocations when the cache is
+    // full. When use_huge_pages is true, transparent huge page backing is requested for system memory allocations
+    // that are at least as large as a huge page.
+    MonotonicAllocator(size_t block_size, size_t max_cached_bytes = 0, bool use_huge_pages = false) :
+        block_size_(block_size), max_cached_bytes_(max_cached_bytes), use_huge_pages_(use_huge_pages),
+        current_block_(0), current_block_free_bytes_(block_size), cached_bytes_(0), clear_count_(0)
     {}
 
     ~MonotonicAllocator() { Clear(true); }
 
+    // The allocator owns its memory blocks and the objects allocated from them, so it cannot be copied or moved.
+    MonotonicAllocator(const MonotonicAllocator&)            = delete;
+    MonotonicAllocator& operator=(const MonotonicAllocator&) = delete;
+    MonotonicAllocator(MonotonicAllocator&&)                 = delete;
+    MonotonicAllocator& operator=(MonotonicAllocator&&)      = delete;
+
     // Allocates memory for count objects of type T and optionally initializes them with default constructor. Objects
     // allocated here are valid until the next call to Clear. If the allocation requires greater than block_size
-    // bytes (oversized allocation), a system heap allocation is performed.
+    // bytes (oversized allocation), a system heap allocation is performed, or a cached allocation is reused.
     template <typename T>
     T* Allocate(size_t count = 1, bool initialize = true)
     {
@@ -57,11 +70,13 @@ class MonotonicAllocator
         {
             for (size_t i = 0; i < count; ++i)
             {
-                T* obj = new (result + i) T();
-                if (!std::is_trivially_destructible<T>())
-                {
-                    destructors_.push_back({ obj, [](const void* x) { static_cast<const T*>(x)->~T(); } });
-                }
+                new (result + i) T();
+            }
+
+            if (!std::is_trivially_destructible<T>() && (count > 0))
+            {
+                // A single destructor entry is recorded for the array, instead of one entry per object.
+                destructors_.push_back({ result, count, DestroyObjects<T> });
             }
         }
         assert(!(reinterpret_cast<uintptr_t>(result) % std::alignment_of<T>::value) &&
@@ -70,28 +85,73 @@ class MonotonicAllocator
     }
 
     // "Frees" all previously allocated objects. Depending on free_system_memory, system memory blocks are either
-    // reused for new calls to Allocate or freed and re-created as needed. Oversized allocations are freed from system
-    // memory
+    // reused for new calls to Allocate or freed and re-created as needed. Oversized allocations are cached for reuse
+    // when free_system_memory is false and the cache has space for them, and are otherwise freed from system memory.
     void Clear(bool free_system_memory);
 
-  private:
-    void* Allocate(size_t object_bytes, size_t alignment_bytes);
-    void* AllocateToBlock(size_t object_bytes, size_t alignment_bytes);
+    // Combined size of the oversized allocations that are cached for reuse.
+    size_t GetCachedBytes() const { return cached_bytes_; }
+
+    // Oversized allocation sizes are rounded up to one of four size classes between consecutive powers of two, so that
+    // a cached allocation can be reused by requests for similar sizes while wasting at most a quarter of its size.
+    static size_t GetSizeClass(size_t size);
 
   private:
+    struct MemoryBlock
+    {
+        unsigned char* memory{ nullptr };
+        size_t         size{ 0 };
+        bool           is_raw_memory{ false }; // Allocated with platform::AllocateRawMemory to request huge pages.
+    };
+
+    struct CachedAllocation
+    {
+        MemoryBlock block;
+        uint64_t    last_use{ 0 }; // Value of clear_count_ when the allocation was last released to the cache.
+    };
+
     struct Destructor
     {
-        void* obj;
-        void (*destroy)(const void*);
+        void*  objects;
+        size_t count;
+        void (*destroy)(void*, size_t);
     };
 
   private:
-    std::vector<std::unique_ptr<unsigned char[]>> memory_blocks_;
-    std::vector<std::unique_ptr<unsigned char[]>> oversized_allocations_;
-    std::vector<Destructor>                       destructors_;
-    const size_t                                  block_size_;
-    size_t                                        current_block_;
-    size_t                                        current_block_free_bytes_;
+    template <typename T>
+    static void DestroyObjects(void* objects, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            (static_cast<T*>(objects) + i)->~T();
+        }
+    }
+
+    void* Allocate(size_t object_bytes, size_t alignment_bytes);
+    void* AllocateToBlock(size_t object_bytes, size_t alignment_bytes);
+    void* AllocateOversized(size_t object_bytes);
+
+    // Frees cached allocations that were last used before the current Clear, starting with the least recently used,
+    // until size bytes are available in the cache. Returns false if space could not be made.
+    bool EvictCachedAllocations(size_t size);
+
+    MemoryBlock AllocateMemoryBlock(size_t size) const;
+    static void FreeMemoryBlock(const MemoryBlock& block);
+
+  private:
+    static const size_t kHugePageSize = 2 * 1024 * 1024;
+
+    std::vector<MemoryBlock>                memory_blocks_;
+    std::vector<MemoryBlock>                oversized_allocations_;
+    std::multimap<size_t, CachedAllocation> cached_allocations_; // Released oversized allocations, keyed by size class.
+    std::vector<Destructor>                 destructors_;
+    const size_t                            block_size_;
+    const size_t                            max_cached_bytes_;
+    const bool                              use_huge_pages_;
+    size_t                                  current_block_;
+    size_t                                  current_block_free_bytes_;
+    size_t                                  cached_bytes_;
+    uint64_t                                clear_count_;
 };
 
 GFXRECON_END_NAMESPACE(util)
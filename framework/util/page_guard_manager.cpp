@@ -24,6 +24,7 @@
 
 #include "util/page_guard_manager.h"
 
+#include "util/date_time.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
@@ -238,7 +239,9 @@ PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
     enable_separate_read_(enable_separate_read), unblock_sigsegv_(unblock_SIGSEGV),
     enable_signal_handler_watcher_(enable_signal_handler_watcher),
     signal_handler_watcher_max_restores_(signal_handler_watcher_max_restores),
-    enable_read_write_same_page_(expect_read_write_same_page), protection_mode_(protection_mode), uffd_is_init_(false)
+    enable_read_write_same_page_(expect_read_write_same_page), statistics_enabled_(false), fault_count_(0),
+    fault_time_(0), process_count_(0), process_time_(0), modified_bytes_(0), protection_mode_(protection_mode),
+    uffd_is_init_(false)
 {
     if (kUserFaultFdMode == protection_mode_ && !USERFAULTFD_SUPPORTED)
     {
@@ -853,6 +856,11 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
         void* destination_address = static_cast<uint8_t*>(memory_info->mapped_memory) + page_offset;
         MemoryCopy(destination_address, source_address, page_range);
 
+        if (statistics_enabled_)
+        {
+            modified_bytes_.fetch_add(page_range, std::memory_order_relaxed);
+        }
+
         // The shadow memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
         handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
@@ -894,6 +902,11 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
             page_offset -= memory_info->aligned_offset;
         }
 
+        if (statistics_enabled_)
+        {
+            modified_bytes_.fetch_add(page_range, std::memory_order_relaxed);
+        }
+
         // The mapped memory address, page offset, and range values to be provided to the callback, which will process
         // the memory range.
         handle_modified(memory_id, memory_info->mapped_memory, page_offset, page_range);
@@ -1220,6 +1233,8 @@ void PageGuardManager::FreePersistentShadowMemory(uintptr_t shadow_memory_handle
 
 void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemoryFunc& handle_modified)
 {
+    const int64_t start_time = statistics_enabled_ ? util::datetime::GetTimestamp() : 0;
+
     std::lock_guard<std::mutex> lock(tracked_memory_lock_);
 
     auto entry = memory_info_.find(memory_id);
@@ -1252,10 +1267,19 @@ void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemo
     {
         UffdUnblockFaultingThreads(n_threads_to_wait);
     }
+
+    if (statistics_enabled_)
+    {
+        process_count_.fetch_add(1, std::memory_order_relaxed);
+        process_time_.fetch_add(util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp()),
+                                std::memory_order_relaxed);
+    }
 }
 
 void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified)
 {
+    const int64_t start_time = statistics_enabled_ ? util::datetime::GetTimestamp() : 0;
+
     std::lock_guard<std::mutex> lock(tracked_memory_lock_);
 
     uint32_t n_threads_to_wait = 0;
@@ -1286,12 +1310,21 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     {
         UffdUnblockFaultingThreads(n_threads_to_wait);
     }
+
+    if (statistics_enabled_)
+    {
+        process_count_.fetch_add(1, std::memory_order_relaxed);
+        process_time_.fetch_add(util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp()),
+                                std::memory_order_relaxed);
+    }
 }
 
 bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bool clear_guard)
 {
     assert(protection_mode_ == kMProtectMode);
 
+    const int64_t start_time = statistics_enabled_ ? util::datetime::GetTimestamp() : 0;
+
     MemoryInfo* memory_info = nullptr;
 
     std::lock_guard<std::mutex> lock(tracked_memory_lock_);
@@ -1353,11 +1386,29 @@ bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bo
                 memory_info->status_tracker.SetActiveWriteBlock(page_index, true);
             }
         }
+
+        if (statistics_enabled_)
+        {
+            fault_count_.fetch_add(1, std::memory_order_relaxed);
+            fault_time_.fetch_add(util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp()),
+                                  std::memory_order_relaxed);
+        }
     }
 
     return found;
 }
 
+PageGuardManager::Statistics PageGuardManager::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.fault_count    = fault_count_.load(std::memory_order_relaxed);
+    statistics.fault_time     = fault_time_.load(std::memory_order_relaxed);
+    statistics.process_count  = process_count_.load(std::memory_order_relaxed);
+    statistics.process_time   = process_time_.load(std::memory_order_relaxed);
+    statistics.modified_bytes = modified_bytes_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 const void* PageGuardManager::GetMappedMemory(uint64_t memory_id) const
 {
     const auto& mem_info = memory_info_.find(memory_id);
@@ -316,6 +316,11 @@ bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address
 
     memory_info->is_modified = true;
 
+    if (statistics_enabled_)
+    {
+        fault_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
     assert((memory_info != nullptr) && (memory_info->aligned_address != nullptr));
     assert(static_cast<uintptr_t>(address) >= reinterpret_cast<uintptr_t>(memory_info->aligned_address));
 
@@ -51,6 +51,9 @@
 #include <unistd.h>
 #include <signal.h>
 #include <sys/mman.h>
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
 #endif // WIN32
 
 #if defined(__ANDROID__)
@@ -196,6 +199,14 @@ inline size_t FileReadNoLock(void* buffer, size_t element_size, size_t element_c
     return _fread_nolock(buffer, element_size, element_count, stream);
 }
 
+inline uint64_t FileCopyRange(FILE* destination, FILE* source, uint64_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(destination);
+    GFXRECON_UNREFERENCED_PARAMETER(source);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return 0;
+}
+
 inline int32_t FileVprintf(FILE* stream, const char* format, va_list vlist)
 {
     return vfprintf_s(stream, format, vlist);
@@ -250,6 +261,14 @@ inline void FreeRawMemory(void* memory, size_t aligned_size)
     VirtualFree(memory, 0, MEM_RELEASE);
 }
 
+// Large pages require the SeLockMemoryPrivilege on Windows, so memory is not backed by large pages on request.
+inline bool AdviseHugePages(void* memory, size_t aligned_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(aligned_size);
+    return false;
+}
+
 inline int GetSystemLastErrorCode()
 {
     return GetLastError();
@@ -448,6 +467,87 @@ inline size_t FileReadNoLock(void* buffer, size_t element_size, size_t element_c
 #endif
 }
 
+// Copies up to size bytes from the current position of source to the current position of destination without passing
+// the data through a user space buffer, and advances both stream positions by the number of bytes copied.  Returns the
+// number of bytes copied, which is less than size at the end of the source file or when in-kernel copies are not
+// supported, in which case the caller is expected to copy the remaining data with FileRead and FileWrite.
+inline uint64_t FileCopyRange(FILE* destination, FILE* source, uint64_t size)
+{
+#if defined(__linux__)
+    // Data buffered by the destination stream must reach the file before the in-kernel copy is appended to it.
+    if (fflush(destination) != 0)
+    {
+        return 0;
+    }
+
+    int64_t in_offset  = ftello(source);
+    int64_t out_offset = ftello(destination);
+
+    if ((in_offset < 0) || (out_offset < 0))
+    {
+        return 0;
+    }
+
+    const int in_fd               = fileno(source);
+    const int out_fd              = fileno(destination);
+    uint64_t  copied              = 0;
+    bool      use_copy_file_range = true;
+
+    while (copied < size)
+    {
+        // Limit each request to 1GB, which keeps the size within the range of ssize_t on all targets.
+        const uint64_t remaining = size - copied;
+        const size_t   request   = static_cast<size_t>((remaining < (1ull << 30)) ? remaining : (1ull << 30));
+        ssize_t        result    = -1;
+
+#if defined(SYS_copy_file_range)
+        if (use_copy_file_range)
+        {
+            loff_t in  = static_cast<loff_t>(in_offset);
+            loff_t out = static_cast<loff_t>(out_offset);
+            result     = syscall(SYS_copy_file_range, in_fd, &in, out_fd, &out, request, 0u);
+
+            if (result < 0)
+            {
+                // Older kernels and some file systems do not support copy_file_range, so fall back to sendfile.
+                use_copy_file_range = false;
+                continue;
+            }
+        }
+        else
+#endif
+        {
+            // sendfile writes to the current offset of the destination file descriptor.
+            off_t in = static_cast<off_t>(in_offset);
+            if (lseek(out_fd, static_cast<off_t>(out_offset), SEEK_SET) >= 0)
+            {
+                result = sendfile(out_fd, in_fd, &in, request);
+            }
+        }
+
+        if (result <= 0)
+        {
+            break;
+        }
+
+        copied += static_cast<uint64_t>(result);
+        in_offset += result;
+        out_offset += result;
+    }
+
+    // Move the streams past the copied data, which also discards data that the source stream had read ahead.
+    fseeko(source, in_offset, SEEK_SET);
+    fseeko(destination, out_offset, SEEK_SET);
+
+    return copied;
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(destination);
+    GFXRECON_UNREFERENCED_PARAMETER(source);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return 0;
+#endif
+}
+
 inline int32_t FileVprintf(FILE* stream, const char* format, va_list vlist)
 {
     return vfprintf(stream, format, vlist);
@@ -539,6 +639,19 @@ inline void FreeRawMemory(void* memory, size_t aligned_size)
     munmap(memory, aligned_size);
 }
 
+// Requests transparent huge page backing for memory allocated with AllocateRawMemory, returning false when huge pages
+// are not supported.
+inline bool AdviseHugePages(void* memory, size_t aligned_size)
+{
+#if defined(MADV_HUGEPAGE)
+    return (madvise(memory, aligned_size, MADV_HUGEPAGE) == 0);
+#else
+    GFXRECON_UNREFERENCED_PARAMETER(memory);
+    GFXRECON_UNREFERENCED_PARAMETER(aligned_size);
+    return false;
+#endif
+}
+
 inline int GetSystemLastErrorCode()
 {
     return errno;
@@ -564,6 +677,30 @@ inline bool IsAddressAligned(const void* address, size_t alignment)
     return (uint_addr % alignment) == 0;
 }
 
+// Minimum copy size for which MappedMemoryCopy uses StreamingMemoryCopy instead of MemoryCopy.
+const size_t kStreamingMemoryCopyThreshold = 256 * 1024;
+
+// Copies memory with non-temporal stores that bypass the CPU cache, which is faster than MemoryCopy for large writes to
+// write-combined or uncached memory, and avoids evicting cached data for copies that will not be read back by the CPU.
+// The AVX2 or SSE2 copy is selected at runtime on x86-64, AArch64 builds with clang use STNP stores, and other builds
+// use MemoryCopy. Returns STRUNCATE when source_size is larger than destination_size, after copying destination_size
+// bytes.
+int32_t StreamingMemoryCopy(void* destination, size_t destination_size, const void* source, size_t source_size);
+
+// Copies data to mapped device memory, which is often write-combined. Copies of at least kStreamingMemoryCopyThreshold
+// bytes use StreamingMemoryCopy to bypass the CPU cache, and smaller copies use MemoryCopy.
+inline int32_t MappedMemoryCopy(void* destination, size_t destination_size, const void* source, size_t source_size)
+{
+    const size_t copy_size = (source_size > destination_size) ? destination_size : source_size;
+
+    if (copy_size >= kStreamingMemoryCopyThreshold)
+    {
+        return StreamingMemoryCopy(destination, destination_size, source, source_size);
+    }
+
+    return MemoryCopy(destination, destination_size, source, source_size);
+}
+
 inline LibraryHandle OpenLibrary(const std::vector<std::string>& name_list)
 {
     for (const auto& name : name_list)
@@ -0,0 +1,237 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/platform.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define GFXRECON_STREAMING_COPY_X64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) && defined(__has_builtin)
+// Clang lowers non-temporal stores of 128-bit vectors to STNP on AArch64.  GCC does not provide the builtin, and
+// builds without it fall back to memcpy.
+#if __has_builtin(__builtin_nontemporal_store)
+#define GFXRECON_STREAMING_COPY_AARCH64
+#endif
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(platform)
+
+#if defined(GFXRECON_STREAMING_COPY_X64)
+
+typedef void (*StreamingCopyFunc)(uint8_t* destination, const uint8_t* source, size_t size);
+
+// Returns the number of bytes to copy before destination is aligned to alignment, which must be a power of two.
+static size_t GetUnalignedHeadSize(const uint8_t* destination, size_t alignment, size_t size)
+{
+    const size_t misalignment = reinterpret_cast<uintptr_t>(destination) & (alignment - 1);
+    const size_t head_size    = (misalignment != 0) ? (alignment - misalignment) : 0;
+    return (head_size < size) ? head_size : size;
+}
+
+// SSE2 is supported by all x86-64 processors.
+static void StreamingCopySse2(uint8_t* destination, const uint8_t* source, size_t size)
+{
+    const size_t head_size = GetUnalignedHeadSize(destination, sizeof(__m128i), size);
+    std::memcpy(destination, source, head_size);
+    destination += head_size;
+    source += head_size;
+    size -= head_size;
+
+    while (size >= (4 * sizeof(__m128i)))
+    {
+        const __m128i* src = reinterpret_cast<const __m128i*>(source);
+        __m128i*       dst = reinterpret_cast<__m128i*>(destination);
+
+        const __m128i value0 = _mm_loadu_si128(src);
+        const __m128i value1 = _mm_loadu_si128(src + 1);
+        const __m128i value2 = _mm_loadu_si128(src + 2);
+        const __m128i value3 = _mm_loadu_si128(src + 3);
+        _mm_stream_si128(dst, value0);
+        _mm_stream_si128(dst + 1, value1);
+        _mm_stream_si128(dst + 2, value2);
+        _mm_stream_si128(dst + 3, value3);
+
+        destination += 4 * sizeof(__m128i);
+        source += 4 * sizeof(__m128i);
+        size -= 4 * sizeof(__m128i);
+    }
+
+    while (size >= sizeof(__m128i))
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+
+        destination += sizeof(__m128i);
+        source += sizeof(__m128i);
+        size -= sizeof(__m128i);
+    }
+
+    // Order the non-temporal stores before any stores that follow the copy, such as a write that signals that the
+    // copied data is ready.
+    _mm_sfence();
+
+    std::memcpy(destination, source, size);
+}
+
+#if defined(__GNUC__)
+__attribute__((target("avx2")))
+#endif
+static void StreamingCopyAvx2(uint8_t* destination, const uint8_t* source, size_t size)
+{
+    const size_t head_size = GetUnalignedHeadSize(destination, sizeof(__m256i), size);
+    std::memcpy(destination, source, head_size);
+    destination += head_size;
+    source += head_size;
+    size -= head_size;
+
+    while (size >= (4 * sizeof(__m256i)))
+    {
+        const __m256i* src = reinterpret_cast<const __m256i*>(source);
+        __m256i*       dst = reinterpret_cast<__m256i*>(destination);
+
+        const __m256i value0 = _mm256_loadu_si256(src);
+        const __m256i value1 = _mm256_loadu_si256(src + 1);
+        const __m256i value2 = _mm256_loadu_si256(src + 2);
+        const __m256i value3 = _mm256_loadu_si256(src + 3);
+        _mm256_stream_si256(dst, value0);
+        _mm256_stream_si256(dst + 1, value1);
+        _mm256_stream_si256(dst + 2, value2);
+        _mm256_stream_si256(dst + 3, value3);
+
+        destination += 4 * sizeof(__m256i);
+        source += 4 * sizeof(__m256i);
+        size -= 4 * sizeof(__m256i);
+    }
+
+    while (size >= sizeof(__m256i))
+    {
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)));
+
+        destination += sizeof(__m256i);
+        source += sizeof(__m256i);
+        size -= sizeof(__m256i);
+    }
+
+    _mm_sfence();
+
+    std::memcpy(destination, source, size);
+}
+
+static bool IsAvx2Supported()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // AVX state must be enabled by the OS, which is reported by OSXSAVE and the XCR0 register.
+    __cpuid(info, 1);
+    const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+    const bool has_avx     = (info[2] & (1 << 28)) != 0;
+    if (!has_osxsave || !has_avx || ((_xgetbv(0) & 0x6) != 0x6))
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+static StreamingCopyFunc SelectStreamingCopy()
+{
+    return IsAvx2Supported() ? StreamingCopyAvx2 : StreamingCopySse2;
+}
+
+#elif defined(GFXRECON_STREAMING_COPY_AARCH64)
+
+typedef uint64_t StreamingVector __attribute__((vector_size(16)));
+
+static void StreamingCopyAArch64(uint8_t* destination, const uint8_t* source, size_t size)
+{
+    const size_t misalignment = reinterpret_cast<uintptr_t>(destination) & (sizeof(StreamingVector) - 1);
+    size_t       head_size    = (misalignment != 0) ? (sizeof(StreamingVector) - misalignment) : 0;
+    head_size                 = (head_size < size) ? head_size : size;
+
+    std::memcpy(destination, source, head_size);
+    destination += head_size;
+    source += head_size;
+    size -= head_size;
+
+    // Pairs of vectors are stored together so that the compiler can combine them into a single STNP.
+    while (size >= (2 * sizeof(StreamingVector)))
+    {
+        StreamingVector value0;
+        StreamingVector value1;
+        std::memcpy(&value0, source, sizeof(StreamingVector));
+        std::memcpy(&value1, source + sizeof(StreamingVector), sizeof(StreamingVector));
+
+        StreamingVector* dst = reinterpret_cast<StreamingVector*>(destination);
+        __builtin_nontemporal_store(value0, dst);
+        __builtin_nontemporal_store(value1, dst + 1);
+
+        destination += 2 * sizeof(StreamingVector);
+        source += 2 * sizeof(StreamingVector);
+        size -= 2 * sizeof(StreamingVector);
+    }
+
+    // Unlike the x86 streaming stores, STNP follows the ordering rules of regular stores, so no barrier is needed.
+    std::memcpy(destination, source, size);
+}
+
+#endif
+
+int32_t StreamingMemoryCopy(void* destination, size_t destination_size, const void* source, size_t source_size)
+{
+    const size_t copy_size = (source_size > destination_size) ? destination_size : source_size;
+
+#if defined(GFXRECON_STREAMING_COPY_X64)
+    static const StreamingCopyFunc streaming_copy = SelectStreamingCopy();
+
+    streaming_copy(static_cast<uint8_t*>(destination), static_cast<const uint8_t*>(source), copy_size);
+#elif defined(GFXRECON_STREAMING_COPY_AARCH64)
+    StreamingCopyAArch64(static_cast<uint8_t*>(destination), static_cast<const uint8_t*>(source), copy_size);
+#else
+    std::memcpy(destination, source, copy_size);
+#endif
+
+    return (source_size > destination_size) ? STRUNCATE : 0;
+}
+
+GFXRECON_END_NAMESPACE(platform)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -25,14 +25,22 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
 #include "util/to_string.h"
 #include "util/strings.h"
 #include "util/date_time.h"
 #include "util/logging.h"
+#include "util/thread_pool.h"
+#include "util/hash.h"
+#include "util/monotonic_allocator.h"
+#include "util/platform.h"
 #include "generated/generated_vulkan_enum_to_string.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace gfxrecon::util::strings;
 using namespace gfxrecon::util::datetime;
 
@@ -403,3 +411,219 @@ TEST_CASE("UtcString", "[datetime]")
 
     gfxrecon::util::Log::Release();
 }
+
+TEST_CASE("ThreadPool", "[thread_pool]")
+{
+    std::vector<std::future<uint32_t>> results;
+
+    {
+        gfxrecon::util::ThreadPool pool(4);
+        REQUIRE(pool.GetThreadCount() == 4);
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            results.emplace_back(pool.Submit([i]() { return i * i; }));
+        }
+    }
+
+    // All tasks are completed before the pool is destroyed.
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        REQUIRE(results[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        REQUIRE(results[i].get() == i * i);
+    }
+
+    REQUIRE(gfxrecon::util::ThreadPool::GetDefaultThreadCount() >= 1);
+}
+
+TEST_CASE("ContentHash64", "[hash]")
+{
+    using gfxrecon::util::hash::ContentHash64;
+
+    const std::string text = "Nobody inspects the spammish repetition";
+
+    // Reference values of the XXH64 algorithm with a seed of 0.
+    REQUIRE(ContentHash64::Generate(nullptr, 0) == 0xEF46DB3751D8E999ULL);
+    REQUIRE(ContentHash64::Generate(reinterpret_cast<const uint8_t*>("a"), 1) == 0xD24EC4F1A98C6E5BULL);
+    REQUIRE(ContentHash64::Generate(reinterpret_cast<const uint8_t*>(text.data()), text.size()) ==
+            0xFBCEA83C8A378BF1ULL);
+}
+
+TEST_CASE("StreamingMemoryCopy", "[platform]")
+{
+    std::vector<uint8_t> source(4096);
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<uint8_t>((i * 7) + 3);
+    }
+
+    // Copies to unaligned destinations with sizes that are not a multiple of the vector size are exact.
+    for (size_t offset : { 0, 1, 17, 32 })
+    {
+        for (size_t size : { 0, 15, 64, 129, 3000 })
+        {
+            std::vector<uint8_t> destination(source.size() + 64, 0);
+
+            REQUIRE(gfxrecon::util::platform::StreamingMemoryCopy(
+                        destination.data() + offset, size, source.data() + 5, size) == 0);
+            REQUIRE(std::equal(source.begin() + 5, source.begin() + 5 + size, destination.begin() + offset));
+            REQUIRE(std::all_of(destination.begin(), destination.begin() + offset, [](uint8_t x) { return x == 0; }));
+            REQUIRE(std::all_of(
+                destination.begin() + offset + size, destination.end(), [](uint8_t x) { return x == 0; }));
+        }
+    }
+
+    std::vector<uint8_t> destination(16);
+    REQUIRE(gfxrecon::util::platform::StreamingMemoryCopy(destination.data(), 16, source.data(), 32) == STRUNCATE);
+    REQUIRE(std::equal(destination.begin(), destination.end(), source.begin()));
+}
+
+TEST_CASE("MappedMemoryCopy", "[platform]")
+{
+    // Copies on either side of the streaming threshold are exact.
+    for (size_t size : { size_t{ 4096 }, gfxrecon::util::platform::kStreamingMemoryCopyThreshold + 17 })
+    {
+        std::vector<uint8_t> source(size);
+        for (size_t i = 0; i < source.size(); ++i)
+        {
+            source[i] = static_cast<uint8_t>((i * 13) + 1);
+        }
+
+        std::vector<uint8_t> destination(size, 0);
+        REQUIRE(gfxrecon::util::platform::MappedMemoryCopy(destination.data(), size, source.data(), size) == 0);
+        REQUIRE(destination == source);
+    }
+}
+
+TEST_CASE("StreamingMemoryCopy large copy workload", "[platform][!benchmark]")
+{
+    // Copies of the size of a large fill memory command, which exceed the CPU cache.
+    const size_t kCopySize = 64 * 1024 * 1024;
+
+    std::vector<uint8_t> source(kCopySize, 0xab);
+    std::vector<uint8_t> destination(kCopySize);
+
+    BENCHMARK("Copy 64 MiB with MemoryCopy")
+    {
+        return gfxrecon::util::platform::MemoryCopy(destination.data(), kCopySize, source.data(), kCopySize);
+    };
+
+    BENCHMARK("Copy 64 MiB with StreamingMemoryCopy")
+    {
+        return gfxrecon::util::platform::StreamingMemoryCopy(destination.data(), kCopySize, source.data(), kCopySize);
+    };
+}
+
+TEST_CASE("MonotonicAllocator size classes", "[monotonic_allocator]")
+{
+    using gfxrecon::util::MonotonicAllocator;
+
+    // Sizes below 4 have no intermediate classes.
+    REQUIRE(MonotonicAllocator::GetSizeClass(1) == 1);
+    REQUIRE(MonotonicAllocator::GetSizeClass(3) == 3);
+
+    // Sizes are rounded up to a quarter of the largest power of two that does not exceed them.
+    REQUIRE(MonotonicAllocator::GetSizeClass(1024) == 1024);
+    REQUIRE(MonotonicAllocator::GetSizeClass(1025) == 1280);
+    REQUIRE(MonotonicAllocator::GetSizeClass(1280) == 1280);
+    REQUIRE(MonotonicAllocator::GetSizeClass(1281) == 1536);
+    REQUIRE(MonotonicAllocator::GetSizeClass(2047) == 2048);
+}
+
+TEST_CASE("MonotonicAllocator caches oversized allocations", "[monotonic_allocator]")
+{
+    using gfxrecon::util::MonotonicAllocator;
+
+    SECTION("A cached allocation is reused by a later allocation of the same size class")
+    {
+        MonotonicAllocator allocator(1024, 1024 * 1024);
+
+        uint8_t* first = allocator.Allocate<uint8_t>(2000, false);
+        allocator.Clear(false);
+        REQUIRE(allocator.GetCachedBytes() == 2048);
+
+        REQUIRE(allocator.Allocate<uint8_t>(1900, false) == first);
+        REQUIRE(allocator.GetCachedBytes() == 0);
+    }
+
+    SECTION("The cache does not exceed its byte limit")
+    {
+        MonotonicAllocator allocator(1024, 8192);
+
+        allocator.Allocate<uint8_t>(4096, false);
+        allocator.Allocate<uint8_t>(4096, false);
+        allocator.Allocate<uint8_t>(4096, false);
+        allocator.Allocate<uint8_t>(10000, false);
+        allocator.Clear(false);
+        REQUIRE(allocator.GetCachedBytes() == 8192);
+
+        allocator.Clear(true);
+        REQUIRE(allocator.GetCachedBytes() == 0);
+    }
+
+    SECTION("The least recently used allocations are evicted for a new size class")
+    {
+        MonotonicAllocator allocator(1024, 10240);
+
+        uint8_t* recent = allocator.Allocate<uint8_t>(4096, false);
+        allocator.Clear(false);
+        allocator.Allocate<uint8_t>(3072, false);
+        allocator.Clear(false);
+        REQUIRE(allocator.Allocate<uint8_t>(4000, false) == recent);
+        allocator.Clear(false);
+        REQUIRE(allocator.GetCachedBytes() == (4096 + 3072));
+
+        // The 3072 byte allocation has not been used for the longest time, and is evicted to make room.
+        allocator.Allocate<uint8_t>(6000, false);
+        allocator.Clear(false);
+        REQUIRE(allocator.GetCachedBytes() == (4096 + 6144));
+        REQUIRE(allocator.Allocate<uint8_t>(4096, false) == recent);
+    }
+
+    SECTION("Huge page and heap allocations are cached and freed")
+    {
+        const size_t kHugeSize = 3 * 1024 * 1024;
+
+        MonotonicAllocator allocator(1024, 8 * 1024 * 1024, true);
+
+        uint8_t* huge  = allocator.Allocate<uint8_t>(kHugeSize, false);
+        uint8_t* small = allocator.Allocate<uint8_t>(4096, false);
+
+        huge[kHugeSize - 1] = 1;
+        small[4095]         = 1;
+        allocator.Clear(false);
+
+        REQUIRE(allocator.Allocate<uint8_t>(kHugeSize, false) == huge);
+        REQUIRE(allocator.Allocate<uint8_t>(4096, false) == small);
+        allocator.Clear(true);
+        REQUIRE(allocator.GetCachedBytes() == 0);
+    }
+}
+
+struct MonotonicAllocatorCounted
+{
+    static size_t destroyed;
+
+    ~MonotonicAllocatorCounted() { ++destroyed; }
+};
+
+size_t MonotonicAllocatorCounted::destroyed = 0;
+
+TEST_CASE("MonotonicAllocator destroys initialized arrays", "[monotonic_allocator]")
+{
+    gfxrecon::util::MonotonicAllocator allocator(1024, 1024 * 1024);
+
+    MonotonicAllocatorCounted::destroyed = 0;
+
+    allocator.Allocate<MonotonicAllocatorCounted>(5);
+    allocator.Allocate<MonotonicAllocatorCounted>(2000);
+    allocator.Allocate<MonotonicAllocatorCounted>(3, false);
+    REQUIRE(MonotonicAllocatorCounted::destroyed == 0);
+
+    // Every object of the initialized arrays is destroyed, while uninitialized arrays have no destructor entry.
+    allocator.Clear(false);
+    REQUIRE(MonotonicAllocatorCounted::destroyed == 2005);
+
+    allocator.Clear(false);
+    REQUIRE(MonotonicAllocatorCounted::destroyed == 2005);
+}
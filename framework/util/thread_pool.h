@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_THREAD_POOL_H
+#define GFXRECON_UTIL_THREAD_POOL_H
+
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// A fixed set of worker threads that process submitted tasks in submission order.  Tasks that are still queued when
+// the pool is destroyed are completed before the worker threads exit.
+class ThreadPool
+{
+  public:
+    // A thread_count of 0 selects GetDefaultThreadCount().
+    explicit ThreadPool(uint32_t thread_count = 0);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(threads_.size()); }
+
+    // Queues a task for a worker thread, returning a future for its result.  Exceptions thrown by the task are
+    // rethrown by the future.
+    template <typename Function>
+    std::future<typename std::invoke_result<Function>::type> Submit(Function&& function)
+    {
+        using Result = typename std::invoke_result<Function>::type;
+
+        auto task   = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+        auto result = task->get_future();
+
+        Enqueue([task]() { (*task)(); });
+
+        return result;
+    }
+
+    // One less than the number of hardware threads, leaving a thread for the application, with a minimum of 1.
+    static uint32_t GetDefaultThreadCount();
+
+  private:
+    void Enqueue(std::function<void()> task);
+
+    void ProcessTasks();
+
+  private:
+    std::mutex                        mutex_;
+    std::condition_variable           condition_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread>          threads_;
+    bool                              stop_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_THREAD_POOL_H
@@ -56,12 +56,13 @@ size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
     compress_stream.avail_in = static_cast<uInt>(uncompressed_size);
     compress_stream.next_in  = const_cast<Bytef*>(uncompressed_data);
 
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size());
-    compress_stream.avail_out = static_cast<uInt>(compressed_data->size());
+    // Output is limited to the space following the offset.
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size() - compressed_data_offset);
+    compress_stream.avail_out = static_cast<uInt>(compressed_data->size() - compressed_data_offset);
     compress_stream.next_out  = compressed_data->data() + compressed_data_offset;
 
     // Perform the compression (deflate the data).
-    deflateInit(&compress_stream, Z_BEST_COMPRESSION);
+    deflateInit(&compress_stream, level_);
     deflate(&compress_stream, Z_FINISH);
     deflateEnd(&compress_stream);
 
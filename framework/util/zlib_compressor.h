@@ -32,7 +32,11 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class ZlibCompressor : public Compressor
 {
   public:
-    ZlibCompressor() {}
+    // Corresponds to Z_BEST_COMPRESSION.
+    static const int kDefaultLevel = 9;
+
+  public:
+    explicit ZlibCompressor(int level = kDefaultLevel) : level_(level) {}
 
     virtual ~ZlibCompressor() override {}
 
@@ -45,6 +49,9 @@ class ZlibCompressor : public Compressor
                               const std::vector<uint8_t>& compressed_data,
                               const size_t                expected_uncompressed_size,
                               std::vector<uint8_t>*       uncompressed_data) override;
+
+  private:
+    int level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -57,7 +57,7 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
                       zstd_compressed_size,
                       reinterpret_cast<const char*>(uncompressed_data),
                       uncompressed_size,
-                      1);
+                      level_);
 
     if (!ZSTD_isError(compressed_size_generated))
     {
@@ -31,7 +31,11 @@ GFXRECON_BEGIN_NAMESPACE(util)
 class ZstdCompressor : public Compressor
 {
   public:
-    ZstdCompressor() {}
+    // Level 1 favors compression speed over compression ratio, for compression during capture.
+    static const int kDefaultLevel = 1;
+
+  public:
+    explicit ZstdCompressor(int level = kDefaultLevel) : level_(level) {}
 
     virtual ~ZstdCompressor() override {}
 
@@ -44,6 +48,9 @@ class ZstdCompressor : public Compressor
                               const std::vector<uint8_t>& compressed_data,
                               const size_t                expected_uncompressed_size,
                               std::vector<uint8_t>*       uncompressed_data) override;
+
+  private:
+    int level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
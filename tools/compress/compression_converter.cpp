@@ -26,26 +26,41 @@
 
 #include "format/format_util.h"
 #include "util/logging.h"
+#include "util/platform.h"
 
 #include <cassert>
+#include <cstddef>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
 CompressionConverter::CompressionConverter() :
-    decompressing_(true), target_compression_type_(format::CompressionType::kNone)
+    decompressing_(true), target_compression_type_(format::CompressionType::kNone), batch_size_(0)
 {}
 
-CompressionConverter::~CompressionConverter() {}
+CompressionConverter::~CompressionConverter()
+{
+    // Wait for the worker threads before the compressor that they reference is destroyed.
+    thread_pool_.reset();
+}
 
 bool CompressionConverter::Initialize(const std::string&      input_filename,
                                       const std::string&      output_filename,
-                                      format::CompressionType target_compression_type)
+                                      format::CompressionType target_compression_type,
+                                      int                     compression_level,
+                                      uint32_t                thread_count)
 {
-    bool success = CreateCompressor(target_compression_type, &target_compressor_);
+    bool success = CreateCompressor(target_compression_type, &target_compressor_, compression_level);
 
     if (success)
     {
+        // There is nothing to compress when converting to an uncompressed file, and decompression of the input file
+        // is always performed on the reading thread.
+        if ((thread_count != 1) && (target_compressor_ != nullptr))
+        {
+            thread_pool_ = std::make_unique<util::ThreadPool>(thread_count);
+        }
+
         // The target compression type needs to be set before FileTransformer::Initialize is called, because it invokes
         // WriteFileHeader, which depends on a valid target compression type.
         target_compression_type_ = target_compression_type;
@@ -217,6 +232,10 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     {
         return WriteFillMemoryMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryDeltaCommand)
+    {
+        return WriteFillMemoryDeltaMetaData(block_header, meta_data_id);
+    }
     else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
         return WriteInitBufferMetaData(block_header, meta_data_id);
@@ -248,87 +267,45 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
             return false;
         }
 
-        return FileTransformer::ProcessMetaData(block_header, meta_data_id);
+        return FlushPendingBlocks() && FileTransformer::ProcessMetaData(block_header, meta_data_id);
     }
 }
 
-bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
+bool CompressionConverter::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
-
-    if (!write_uncompressed)
-    {
-        assert(target_compressor_ != nullptr);
-
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
-
-        if (0 < compressed_size && compressed_size < buffer_size)
-        {
-            format::CompressedFunctionCallHeader compressed_func_call_header = {};
-            compressed_func_call_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
-            compressed_func_call_header.api_call_id       = call_id;
-            compressed_func_call_header.thread_id         = thread_id;
-            compressed_func_call_header.uncompressed_size = buffer_size;
-
-            packet_size += sizeof(compressed_func_call_header.api_call_id) +
-                           sizeof(compressed_func_call_header.thread_id) +
-                           sizeof(compressed_func_call_header.uncompressed_size) + compressed_size;
-
-            compressed_func_call_header.block_header.size = packet_size;
-
-            if (!WriteBytes(&compressed_func_call_header, sizeof(compressed_func_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed function call block header");
-                return false;
-            }
-
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed function call block data");
-                return false;
-            }
-        }
-        else
-        {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
-        }
-    }
-
-    if (write_uncompressed)
-    {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::FunctionCallHeader func_call_header = {};
-        size_t                     packet_size      = 0;
-
-        func_call_header.block_header.type = format::BlockType::kFunctionCallBlock;
-        func_call_header.api_call_id       = call_id;
-        func_call_header.thread_id         = thread_id;
-
-        packet_size += sizeof(func_call_header.api_call_id) + sizeof(func_call_header.thread_id) + buffer_size;
-
-        func_call_header.block_header.size = packet_size;
+    return FlushPendingBlocks() && FileTransformer::ProcessStateMarker(block_header, marker_type);
+}
 
-        if (!WriteBytes(&func_call_header, sizeof(func_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write function call block header");
-            return false;
-        }
+bool CompressionConverter::CopyBlock(const format::BlockHeader& block_header)
+{
+    return FlushPendingBlocks() && FileTransformer::CopyBlock(block_header);
+}
 
-        if (!WriteBytes(buffer.data(), buffer_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block data");
-            return false;
-        }
-    }
+bool CompressionConverter::FinishProcessing()
+{
+    return FlushPendingBlocks();
+}
 
-    return true;
+bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
+{
+    format::FunctionCallHeader func_call_header = {};
+    func_call_header.block_header.type          = format::BlockType::kFunctionCallBlock;
+    func_call_header.api_call_id                = call_id;
+    func_call_header.thread_id                  = thread_id;
+
+    format::CompressedFunctionCallHeader compressed_func_call_header = {};
+    compressed_func_call_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+    compressed_func_call_header.api_call_id       = call_id;
+    compressed_func_call_header.thread_id         = thread_id;
+    compressed_func_call_header.uncompressed_size = buffer_size;
+
+    const auto* header            = reinterpret_cast<const uint8_t*>(&func_call_header);
+    const auto* compressed_header = reinterpret_cast<const uint8_t*>(&compressed_func_call_header);
+
+    return WriteBlock(std::vector<uint8_t>(header, header + sizeof(func_call_header)),
+                      std::vector<uint8_t>(compressed_header, compressed_header + sizeof(compressed_func_call_header)),
+                      GetParameterBuffer().data(),
+                      buffer_size);
 }
 
 bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
@@ -336,114 +313,120 @@ bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
                                            format::ThreadId  thread_id,
                                            size_t            buffer_size)
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
+    format::MethodCallHeader method_call_header = {};
+    method_call_header.block_header.type        = format::BlockType::kMethodCallBlock;
+    method_call_header.api_call_id              = call_id;
+    method_call_header.object_id                = object_id;
+    method_call_header.thread_id                = thread_id;
+
+    format::CompressedMethodCallHeader compressed_method_call_header = {};
+    compressed_method_call_header.block_header.type = format::BlockType::kCompressedMethodCallBlock;
+    compressed_method_call_header.api_call_id       = call_id;
+    compressed_method_call_header.object_id         = object_id;
+    compressed_method_call_header.thread_id         = thread_id;
+    compressed_method_call_header.uncompressed_size = buffer_size;
+
+    const auto* header            = reinterpret_cast<const uint8_t*>(&method_call_header);
+    const auto* compressed_header = reinterpret_cast<const uint8_t*>(&compressed_method_call_header);
+
+    return WriteBlock(
+        std::vector<uint8_t>(header, header + sizeof(method_call_header)),
+        std::vector<uint8_t>(compressed_header, compressed_header + sizeof(compressed_method_call_header)),
+        GetParameterBuffer().data(),
+        buffer_size);
+}
 
-    if (!write_uncompressed)
-    {
-        GFXRECON_ASSERT(target_compressor_ != nullptr);
+bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& block_header,
+                                                   format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
 
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
+    format::FillMemoryCommandHeader fill_cmd;
 
-        if (0 < compressed_size && compressed_size < buffer_size)
-        {
-            format::CompressedMethodCallHeader compressed_method_call_header = {};
-            compressed_method_call_header.block_header.type = format::BlockType::kCompressedMethodCallBlock;
-            compressed_method_call_header.api_call_id       = call_id;
-            compressed_method_call_header.object_id         = object_id;
-            compressed_method_call_header.thread_id         = thread_id;
-            compressed_method_call_header.uncompressed_size = buffer_size;
+    bool success = ReadBytes(&fill_cmd.thread_id, sizeof(fill_cmd.thread_id));
+    success      = success && ReadBytes(&fill_cmd.memory_id, sizeof(fill_cmd.memory_id));
+    success      = success && ReadBytes(&fill_cmd.memory_offset, sizeof(fill_cmd.memory_offset));
+    success      = success && ReadBytes(&fill_cmd.memory_size, sizeof(fill_cmd.memory_size));
 
-            packet_size += sizeof(compressed_method_call_header.api_call_id) +
-                           sizeof(compressed_method_call_header.object_id) +
-                           sizeof(compressed_method_call_header.thread_id) +
-                           sizeof(compressed_method_call_header.uncompressed_size) + compressed_size;
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill_cmd.memory_size);
 
-            compressed_method_call_header.block_header.size = packet_size;
+        size_t data_size = static_cast<size_t>(fill_cmd.memory_size);
 
-            if (!WriteBytes(&compressed_method_call_header, sizeof(compressed_method_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed method call block header");
-                return false;
-            }
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            size_t compressed_size =
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
 
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
+            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
             {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed method call block data");
+                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block");
                 return false;
             }
+
+            assert(uncompressed_size == data_size);
         }
         else
         {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
-        }
-    }
-
-    if (write_uncompressed)
-    {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::MethodCallHeader method_call_header = {};
-        size_t                   packet_size        = 0;
-
-        method_call_header.block_header.type = format::BlockType::kMethodCallBlock;
-        method_call_header.api_call_id       = call_id;
-        method_call_header.object_id         = object_id;
-        method_call_header.thread_id         = thread_id;
-
-        packet_size += sizeof(method_call_header.api_call_id) + sizeof(method_call_header.object_id) +
-                       sizeof(method_call_header.thread_id) + buffer_size;
-
-        method_call_header.block_header.size = packet_size;
-
-        if (!WriteBytes(&method_call_header, sizeof(method_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write method call block header");
-            return false;
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory meta-data block");
+                return false;
+            }
         }
 
-        if (!WriteBytes(buffer.data(), buffer_size))
+        if (!WriteMetaDataBlock(&fill_cmd.meta_header,
+                                sizeof(fill_cmd),
+                                meta_data_id,
+                                nullptr,
+                                0,
+                                GetParameterBuffer().data(),
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write method call block data");
             return false;
         }
     }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        return false;
+    }
 
     return true;
 }
 
-bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& block_header,
-                                                   format::MetaDataId         meta_data_id)
+bool CompressionConverter::WriteFillMemoryDeltaMetaData(const format::BlockHeader& block_header,
+                                                        format::MetaDataId         meta_data_id)
 {
-    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryDeltaCommand);
 
-    format::FillMemoryCommandHeader fill_cmd;
+    format::FillMemoryDeltaCommandHeader delta_cmd;
 
-    bool success = ReadBytes(&fill_cmd.thread_id, sizeof(fill_cmd.thread_id));
-    success      = success && ReadBytes(&fill_cmd.memory_id, sizeof(fill_cmd.memory_id));
-    success      = success && ReadBytes(&fill_cmd.memory_offset, sizeof(fill_cmd.memory_offset));
-    success      = success && ReadBytes(&fill_cmd.memory_size, sizeof(fill_cmd.memory_size));
+    bool success = ReadBytes(&delta_cmd.thread_id, sizeof(delta_cmd.thread_id));
+    success      = success && ReadBytes(&delta_cmd.memory_id, sizeof(delta_cmd.memory_id));
+    success      = success && ReadBytes(&delta_cmd.memory_offset, sizeof(delta_cmd.memory_offset));
+    success      = success && ReadBytes(&delta_cmd.memory_size, sizeof(delta_cmd.memory_size));
+    success      = success && ReadBytes(&delta_cmd.span_count, sizeof(delta_cmd.span_count));
+    success      = success && ReadBytes(&delta_cmd.data_size, sizeof(delta_cmd.data_size));
 
     if (success)
     {
-        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill_cmd.memory_size);
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, delta_cmd.data_size);
 
-        size_t data_size = static_cast<size_t>(fill_cmd.memory_size);
+        size_t data_size = static_cast<size_t>(delta_cmd.data_size);
 
         if (format::IsBlockCompressed(block_header.type))
         {
             size_t uncompressed_size = 0;
             size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(delta_cmd));
 
             if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
             {
-                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block");
+                HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                     "Failed to read fill memory delta meta-data block");
                 return false;
             }
 
@@ -453,34 +436,25 @@ bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& bl
         {
             if (!ReadParameterBuffer(data_size))
             {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory meta-data block");
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory delta meta-data block");
                 return false;
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(fill_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + data_size;
-
-        if (!WriteBytes(&fill_cmd, sizeof(fill_cmd)))
+        if (!WriteMetaDataBlock(&delta_cmd.meta_header,
+                                sizeof(delta_cmd),
+                                meta_data_id,
+                                nullptr,
+                                0,
+                                GetParameterBuffer().data(),
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
             return false;
         }
     }
     else
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory delta meta-data block header");
         return false;
     }
 
@@ -528,23 +502,14 @@ bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& bl
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init buffer meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
+        if (!WriteMetaDataBlock(&init_cmd.meta_header,
+                                sizeof(init_cmd),
+                                meta_data_id,
+                                nullptr,
+                                0,
+                                GetParameterBuffer().data(),
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init buffer meta-data block");
             return false;
         }
     }
@@ -583,11 +548,6 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
 
     if (success)
     {
-        // Packet size without the resource data.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd);
-        init_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-        init_cmd.meta_header.meta_data_id      = meta_data_id;
-
         if (init_cmd.data_size > 0)
         {
             assert(init_cmd.data_size == std::accumulate(level_sizes.begin(), level_sizes.end(), 0ull));
@@ -618,30 +578,14 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
                 }
             }
 
-            const auto&    buffer       = GetParameterBuffer();
-            const uint8_t* data_address = buffer.data();
-
-            PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-            // Calculate size of packet with compressed or uncompressed data size.
-            init_cmd.meta_header.block_header.size =
-                format::GetMetaDataBlockBaseSize(init_cmd) + levels_size + data_size;
-
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
-                return false;
-            }
-
-            if (!WriteBytes(level_sizes.data(), levels_size))
+            if (!WriteMetaDataBlock(&init_cmd.meta_header,
+                                    sizeof(init_cmd),
+                                    meta_data_id,
+                                    level_sizes.data(),
+                                    levels_size,
+                                    GetParameterBuffer().data(),
+                                    data_size))
             {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block");
-                return false;
-            }
-
-            if (!WriteBytes(data_address, data_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init image meta-data block");
                 return false;
             }
         }
@@ -652,9 +596,8 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
             init_cmd.data_size   = 0;
             init_cmd.level_count = 0;
 
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
+            if (!WriteMetaDataBlock(&init_cmd.meta_header, sizeof(init_cmd), meta_data_id, nullptr, 0, nullptr, 0))
             {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
                 return false;
             }
         }
@@ -714,23 +657,14 @@ bool CompressionConverter::WriteInitSubresourceMetaData(const format::BlockHeade
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init subresource meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
+        if (!WriteMetaDataBlock(&init_cmd.meta_header,
+                                sizeof(init_cmd),
+                                meta_data_id,
+                                nullptr,
+                                0,
+                                GetParameterBuffer().data(),
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init subresource meta-data block");
             return false;
         }
     }
@@ -818,33 +752,14 @@ bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const form
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size =
-            format::GetMetaDataBlockBaseSize(init_cmd) + data_size +
-            (sizeof(format::InitDx12AccelerationStructureGeometryDesc) * init_cmd.inputs_num_geometry_descs);
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
+        if (!WriteMetaDataBlock(&init_cmd.meta_header,
+                                sizeof(init_cmd),
+                                meta_data_id,
+                                geom_descs.data(),
+                                sizeof(format::InitDx12AccelerationStructureGeometryDesc) * geom_descs.size(),
+                                GetParameterBuffer().data(),
+                                data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader,
-                                  "Failed to write init DX12 acceleration structure meta-data block header");
-            return false;
-        }
-        if (!WriteBytes(geom_descs.data(),
-                        sizeof(format::InitDx12AccelerationStructureGeometryDesc) * geom_descs.size()))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader,
-                                  "Failed to write init DX12 acceleration structure geometry block");
-            return false;
-        }
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData,
-                                  "Failed to write init DX12 acceleration structure meta-data block");
             return false;
         }
     }
@@ -895,58 +810,207 @@ bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::Bl
             }
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
+        if (!WriteMetaDataBlock(&rv_cmd.meta_header,
+                                sizeof(rv_cmd),
+                                meta_data_id,
+                                nullptr,
+                                0,
+                                GetParameterBuffer().data(),
+                                data_size))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to write fill memory resource value meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
+bool CompressionConverter::WriteMetaDataBlock(format::MetaDataHeader* meta_header,
+                                              size_t                  header_size,
+                                              format::MetaDataId      meta_data_id,
+                                              const void*             extra_data,
+                                              size_t                  extra_size,
+                                              const uint8_t*          payload,
+                                              size_t                  payload_size)
+{
+    assert((meta_header != nullptr) && (header_size >= sizeof(format::MetaDataHeader)));
+
+    meta_header->block_header.type = format::BlockType::kMetaDataBlock;
+    meta_header->meta_data_id      = meta_data_id;
 
-        PrepMetadataBlock(rv_cmd.meta_header, meta_data_id, data_address, data_size);
+    const auto*          header = reinterpret_cast<const uint8_t*>(meta_header);
+    std::vector<uint8_t> uncompressed_prefix(header, header + header_size);
 
-        // Calculate size of packet with compressed or uncompressed data size.
-        rv_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(rv_cmd) + data_size;
+    if (extra_size > 0)
+    {
+        const auto* extra = reinterpret_cast<const uint8_t*>(extra_data);
+        uncompressed_prefix.insert(uncompressed_prefix.end(), extra, extra + extra_size);
+    }
+
+    // The compressed form only differs by block type, because the payload size is not recorded by the meta-data header.
+    std::vector<uint8_t>    compressed_prefix(uncompressed_prefix);
+    const format::BlockType compressed_type = format::BlockType::kCompressedMetaDataBlock;
+    util::platform::MemoryCopy(compressed_prefix.data() + offsetof(format::BlockHeader, type),
+                               sizeof(compressed_type),
+                               &compressed_type,
+                               sizeof(compressed_type));
+
+    return WriteBlock(std::move(uncompressed_prefix), std::move(compressed_prefix), payload, payload_size);
+}
+
+void CompressionConverter::EncodeBlock(util::Compressor*           compressor,
+                                       const std::vector<uint8_t>& uncompressed_prefix,
+                                       const std::vector<uint8_t>& compressed_prefix,
+                                       const uint8_t*              payload,
+                                       size_t                      payload_size,
+                                       std::vector<uint8_t>*       output)
+{
+    assert((output != nullptr) && (uncompressed_prefix.size() >= sizeof(format::BlockHeader)) &&
+           (compressed_prefix.size() >= sizeof(format::BlockHeader)));
+
+    const size_t start           = output->size();
+    size_t       compressed_size = 0;
+
+    if ((compressor != nullptr) && (payload_size > 0))
+    {
+        // Compress directly after the compressed prefix, which is only kept if compression reduces the size.
+        compressed_size = compressor->Compress(payload_size, payload, output, start + compressed_prefix.size());
+    }
+
+    const std::vector<uint8_t>* prefix       = &uncompressed_prefix;
+    size_t                      written_size = payload_size;
+
+    if ((compressed_size > 0) && (compressed_size < payload_size))
+    {
+        prefix       = &compressed_prefix;
+        written_size = compressed_size;
+        output->resize(start + compressed_prefix.size() + compressed_size);
+    }
+    else
+    {
+        output->resize(start + uncompressed_prefix.size() + payload_size);
 
-        if (!WriteBytes(&rv_cmd, sizeof(rv_cmd)))
+        if (payload_size > 0)
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
+            util::platform::MemoryCopy(
+                output->data() + start + uncompressed_prefix.size(), payload_size, payload, payload_size);
         }
+    }
+
+    util::platform::MemoryCopy(output->data() + start, prefix->size(), prefix->data(), prefix->size());
+
+    const uint64_t block_size = (prefix->size() - sizeof(format::BlockHeader)) + written_size;
+    util::platform::MemoryCopy(output->data() + start + offsetof(format::BlockHeader, size),
+                               sizeof(block_size),
+                               &block_size,
+                               sizeof(block_size));
+}
+
+bool CompressionConverter::WriteBlock(std::vector<uint8_t>&& uncompressed_prefix,
+                                      std::vector<uint8_t>&& compressed_prefix,
+                                      const uint8_t*         payload,
+                                      size_t                 payload_size)
+{
+    if (thread_pool_ == nullptr)
+    {
+        util::Compressor* compressor = decompressing_ ? nullptr : target_compressor_.get();
 
-        if (!WriteBytes(data_address, data_size))
+        output_buffer_.clear();
+        EncodeBlock(compressor, uncompressed_prefix, compressed_prefix, payload, payload_size, &output_buffer_);
+
+        if (!WriteBytes(output_buffer_.data(), output_buffer_.size()))
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to read fill memory resource value meta-data block");
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write block data");
             return false;
         }
+
+        return true;
     }
-    else
+
+    // The payload references the parameter buffer, which is reused for the next block, so it must be copied.
+    BlockData block;
+    block.uncompressed_prefix = std::move(uncompressed_prefix);
+    block.compressed_prefix   = std::move(compressed_prefix);
+    block.payload.assign(payload, payload + payload_size);
+
+    batch_size_ += block.uncompressed_prefix.size() + payload_size;
+    batch_.emplace_back(std::move(block));
+
+    if (batch_size_ >= kBatchSize)
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to write fill memory resource value meta-data block");
-        return false;
+        SubmitBatch();
+        return WritePendingBatches(thread_pool_->GetThreadCount() * kPendingBatchesPerThread);
     }
 
     return true;
 }
 
-void CompressionConverter::PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
-                                             format::MetaDataId      meta_data_id,
-                                             const uint8_t*&         data_address,
-                                             size_t&                 data_size)
+void CompressionConverter::SubmitBatch()
 {
-    meta_data_header.block_header.type = format::kMetaDataBlock;
-    meta_data_header.meta_data_id      = meta_data_id;
-
-    if (!decompressing_)
+    if (!batch_.empty())
     {
-        assert(target_compressor_ != nullptr);
+        assert(thread_pool_ != nullptr);
 
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+        util::Compressor* compressor = target_compressor_.get();
+        auto              blocks     = std::make_shared<std::vector<BlockData>>(std::move(batch_));
+        const size_t      size_hint  = batch_size_;
 
-        if ((compressed_size > 0) && (compressed_size < data_size))
-        {
-            meta_data_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        PendingBatch pending;
+        pending.output = thread_pool_->Submit([compressor, blocks, size_hint]() {
+            std::vector<uint8_t> output;
+            output.reserve(size_hint);
+
+            for (const auto& block : *blocks)
+            {
+                EncodeBlock(compressor,
+                            block.uncompressed_prefix,
+                            block.compressed_prefix,
+                            block.payload.data(),
+                            block.payload.size(),
+                            &output);
+            }
+
+            return output;
+        });
+
+        pending_batches_.emplace_back(std::move(pending));
+
+        batch_.clear();
+        batch_size_ = 0;
+    }
+}
+
+bool CompressionConverter::WritePendingBatches(size_t max_pending)
+{
+    while (pending_batches_.size() > max_pending)
+    {
+        std::vector<uint8_t> output = pending_batches_.front().output.get();
+        pending_batches_.pop_front();
 
-            data_address = compressed_buffer.data();
-            data_size    = compressed_size;
+        if (!WriteBytes(output.data(), output.size()))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write compressed block data");
+            return false;
         }
     }
+
+    return true;
+}
+
+bool CompressionConverter::FlushPendingBlocks()
+{
+    if (thread_pool_ == nullptr)
+    {
+        return true;
+    }
+
+    SubmitBatch();
+    return WritePendingBatches(0);
 }
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -29,21 +29,39 @@
 #include "format/format.h"
 #include "util/compressor.h"
 #include "util/defines.h"
+#include "util/thread_pool.h"
 
+#include <cstdint>
+#include <deque>
+#include <future>
 #include <memory>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+// Converts a capture file to a different compression type.  Blocks are read and decompressed in order, and may be
+// recompressed by a pool of worker threads, in which case the output blocks are written in the original order.
 class CompressionConverter : public decode::FileTransformer
 {
+  public:
+    // Blocks are submitted to the worker threads in batches of at least this many bytes of uncompressed data.
+    static const size_t kBatchSize = 1024 * 1024;
+
+    // The number of batches that may wait for compression or writing, for each worker thread.
+    static const size_t kPendingBatchesPerThread = 4;
+
   public:
     CompressionConverter();
 
     virtual ~CompressionConverter() override;
 
+    // A compression_level of 0 selects the default level of the target compression type.  A thread_count of 1
+    // compresses blocks on the calling thread, and a thread_count of 0 selects util::ThreadPool's default count.
     bool Initialize(const std::string&      input_filename,
                     const std::string&      output_filename,
-                    format::CompressionType target_compression_type);
+                    format::CompressionType target_compression_type,
+                    int                     compression_level = 0,
+                    uint32_t                thread_count      = 1);
 
   protected:
     virtual bool WriteFileHeader(const format::FileHeader&                  header,
@@ -56,7 +74,60 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
+    virtual bool CopyBlock(const format::BlockHeader& block_header) override;
+
+    virtual bool FinishProcessing() override;
+
   private:
+    // A block with a payload that is compressed when that reduces the block size.  The prefixes contain the block
+    // header and the fields that precede the payload, for the compressed and uncompressed forms of the block.
+    struct BlockData
+    {
+        std::vector<uint8_t> uncompressed_prefix;
+        std::vector<uint8_t> compressed_prefix;
+        std::vector<uint8_t> payload;
+    };
+
+    struct PendingBatch
+    {
+        std::future<std::vector<uint8_t>> output;
+    };
+
+  private:
+    // Appends the complete block, with the size in its block header set for the selected form, to output.
+    static void EncodeBlock(util::Compressor*           compressor,
+                            const std::vector<uint8_t>& uncompressed_prefix,
+                            const std::vector<uint8_t>& compressed_prefix,
+                            const uint8_t*              payload,
+                            size_t                      payload_size,
+                            std::vector<uint8_t>*       output);
+
+    bool WriteBlock(std::vector<uint8_t>&& uncompressed_prefix,
+                    std::vector<uint8_t>&& compressed_prefix,
+                    const uint8_t*         payload,
+                    size_t                 payload_size);
+
+    // Writes a meta-data block that begins with a command header of header_size bytes, followed by extra_size bytes of
+    // fields that are never compressed, followed by the payload.  The meta-data header must be the first member of the
+    // command header, and its block type, size, and ID are set by this function.
+    bool WriteMetaDataBlock(format::MetaDataHeader* meta_header,
+                            size_t                  header_size,
+                            format::MetaDataId      meta_data_id,
+                            const void*             extra_data,
+                            size_t                  extra_size,
+                            const uint8_t*          payload,
+                            size_t                  payload_size);
+
+    void SubmitBatch();
+
+    // Writes the output of pending batches, in order, until no more than max_pending batches remain.
+    bool WritePendingBatches(size_t max_pending);
+
+    // Writes all pending blocks, before a block that is not compressed by the worker threads is written.
+    bool FlushPendingBlocks();
+
     bool WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size);
 
     bool WriteMethodCall(format::ApiCallId call_id,
@@ -66,6 +137,8 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool WriteFillMemoryDeltaMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
     bool WriteInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
@@ -77,15 +150,15 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteFillMemoryResourceValueMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
-    void PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
-                           format::MetaDataId      meta_data_id,
-                           const uint8_t*&         data_address,
-                           size_t&                 data_size);
-
   private:
     bool                              decompressing_;
     format::CompressionType           target_compression_type_;
     std::unique_ptr<util::Compressor> target_compressor_;
+    std::vector<uint8_t>              output_buffer_;
+    std::unique_ptr<util::ThreadPool> thread_pool_;
+    std::vector<BlockData>            batch_;
+    size_t                            batch_size_;
+    std::deque<PendingBatch>          pending_batches_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
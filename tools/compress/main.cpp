@@ -21,9 +21,10 @@
 ** DEALINGS IN THE SOFTWARE.
 */
 
-#include PROJECT_VERSION_HEADER_FILE
 #include "compression_converter.h"
 
+#include "../tool_settings.h"
+
 #include "decode/file_processor.h"
 #include "format/format.h"
 #include "util/argument_parser.h"
@@ -32,15 +33,13 @@
 
 #include "vulkan/vulkan_core.h"
 
-#include <cassert>
 #include <cstdlib>
 
-const char kHelpShortOption[] = "-h";
-const char kHelpLongOption[]  = "--help";
-const char kVersionOption[]   = "--version";
-const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kJobsArgument[]  = "--jobs";
+const char kLevelArgument[] = "--level";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--jobs,--level";
 
 const char kArgNone[]    = "NONE";
 const char kArgLz4[]     = "LZ4";
@@ -58,8 +57,9 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to compress/decompress GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input_file> <output_file> <compression_format>\n",
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--jobs <N>] [--level <N>] <input_file> <output_file>",
                            app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t<compression_format>\n");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process.");
     GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the output file to generate.");
@@ -78,48 +78,18 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --jobs <N>\t\tNumber of threads used to compress blocks.  The default is 1, which");
+    GFXRECON_WRITE_CONSOLE("            \t\tcompresses blocks on the thread that reads the input file.  A value of");
+    GFXRECON_WRITE_CONSOLE("            \t\t0 uses one less than the number of hardware threads.");
+    GFXRECON_WRITE_CONSOLE("  --level <N>\t\tCompression level.  Valid values are 1 to 9 for ZLIB and 1 to 22 for");
+    GFXRECON_WRITE_CONSOLE("            \t\tZSTD, where higher values produce smaller files more slowly.  The");
+    GFXRECON_WRITE_CONSOLE("            \t\tdefault is 9 for ZLIB and 1 for ZSTD.  Ignored for LZ4 and NONE.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
 #endif
 }
 
-static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
-{
-    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
-    {
-        PrintUsage(exe_name);
-        return true;
-    }
-
-    return false;
-}
-
-static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
-{
-    if (arg_parser.IsOptionSet(kVersionOption))
-    {
-        std::string app_name     = exe_name;
-        size_t      dir_location = app_name.find_last_of("/\\");
-
-        if (dir_location >= 0)
-        {
-            app_name.replace(0, dir_location + 1, "");
-        }
-
-        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
-        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
-        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
-                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
-                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
-                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
-
-        return true;
-    }
-
-    return false;
-}
-
 static std::string GetCompressionTypeName(uint32_t type)
 {
     switch (type)
@@ -143,7 +113,7 @@ int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -196,9 +166,60 @@ int main(int argc, const char** argv)
         }
     }
 
+    uint32_t thread_count      = 1;
+    uint32_t compression_level = 0;
+
+    const std::string& jobs_value = arg_parser.GetArgumentValue(kJobsArgument);
+    if (!jobs_value.empty() && !ParseUnsignedArgument(jobs_value, &thread_count))
+    {
+        GFXRECON_LOG_ERROR("Invalid value \'%s\' for %s", jobs_value.c_str(), kJobsArgument);
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    const std::string& level_value = arg_parser.GetArgumentValue(kLevelArgument);
+    if (!level_value.empty())
+    {
+        uint32_t max_level = 0;
+
+        if (compression_type == gfxrecon::format::CompressionType::kZlib)
+        {
+            max_level = 9;
+        }
+        else if (compression_type == gfxrecon::format::CompressionType::kZstd)
+        {
+            max_level = 22;
+        }
+
+        if (max_level == 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring %s, which is not supported for compression format \'%s\'",
+                                 kLevelArgument,
+                                 dst_compression_string.c_str());
+        }
+        else if (!ParseUnsignedArgument(level_value, &compression_level) || (compression_level < 1) ||
+                 (compression_level > max_level))
+        {
+            GFXRECON_LOG_ERROR("Invalid value \'%s\' for %s, which must be between 1 and %u for compression format "
+                               "\'%s\'",
+                               level_value.c_str(),
+                               kLevelArgument,
+                               max_level,
+                               dst_compression_string.c_str());
+            PrintUsage(argv[0]);
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+    }
+
     gfxrecon::CompressionConverter file_converter;
 
-    if (file_converter.Initialize(input_filename, output_filename, compression_type))
+    if (file_converter.Initialize(input_filename,
+                                  output_filename,
+                                  compression_type,
+                                  static_cast<int>(compression_level),
+                                  thread_count))
     {
         if (file_converter.Process())
         {
@@ -0,0 +1,193 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include PROJECT_VERSION_HEADER_FILE
+
+#include "format/capture_segment.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <cinttypes>
+#include <string>
+#include <vector>
+
+const char kHelpShortOption[] = "-h";
+const char kHelpLongOption[]  = "--help";
+const char kVersionOption[]   = "--version";
+const char kListOption[]      = "--list";
+const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kOutputArgument[]  = "--output";
+
+const char kOptions[]   = "-h|--help,--version,--list,--no-debug-popup";
+const char kArguments[] = "--output";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - List or concatenate GFXReconstruct capture file segments.\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --list <file> [<file> ...]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --output <file> <file> [<file> ...]\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tCapture file segments, written by capture with the");
+    GFXRECON_WRITE_CONSOLE("        \t\tcapture file split options, in capture order.");
+    GFXRECON_WRITE_CONSOLE("Optional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --list\t\tPrint the segment index, first frame, and frame count");
+    GFXRECON_WRITE_CONSOLE("        \t\tof each file.");
+    GFXRECON_WRITE_CONSOLE("  --output <file>\tConcatenate the input segments into <file>. The state");
+    GFXRECON_WRITE_CONSOLE("                 \tsnapshot at the start of the first segment is kept, and");
+    GFXRECON_WRITE_CONSOLE("                 \tthe state snapshots of the remaining segments are removed.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool ListSegments(const std::vector<std::string>& filenames)
+{
+    bool success = true;
+
+    GFXRECON_WRITE_CONSOLE("Segment\tFirst frame\tFrames\tFile");
+
+    for (const auto& filename : filenames)
+    {
+        gfxrecon::format::CaptureSegmentInfo info;
+
+        if (gfxrecon::format::ReadCaptureSegmentInfo(filename, &info))
+        {
+            if (info.segment == gfxrecon::format::kUnknownCaptureSegment)
+            {
+                GFXRECON_WRITE_CONSOLE("-\t-\t\t%u\t%s", info.frame_count, filename.c_str());
+            }
+            else
+            {
+                GFXRECON_WRITE_CONSOLE(
+                    "%u\t%u\t\t%u\t%s", info.segment, info.first_frame, info.frame_count, filename.c_str());
+            }
+        }
+        else
+        {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+
+    const bool         list_segments   = arg_parser.IsOptionSet(kListOption);
+    const std::string& output_filename = arg_parser.GetArgumentValue(kOutputArgument);
+
+    if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() < 1) ||
+        (list_segments == !output_filename.empty()))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    const std::vector<std::string>& input_filenames = arg_parser.GetPositionalArguments();
+    bool                            success         = false;
+
+    if (list_segments)
+    {
+        success = ListSegments(input_filenames);
+    }
+    else
+    {
+        success = gfxrecon::format::ConcatenateCaptureSegments(input_filenames, output_filename);
+        if (success)
+        {
+            GFXRECON_WRITE_CONSOLE("Wrote %" PRIu64 " segments to %s",
+                                   static_cast<uint64_t>(input_filenames.size()),
+                                   output_filename.c_str());
+        }
+    }
+
+    gfxrecon::util::Log::Release();
+    return success ? 0 : -1;
+}
@@ -20,7 +20,7 @@
 ** DEALINGS IN THE SOFTWARE.
 */
 
-#include PROJECT_VERSION_HEADER_FILE
+#include "../tool_settings.h"
 
 #include "decode/file_processor.h"
 #include "format/format.h"
@@ -28,21 +28,30 @@
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
 #include "util/file_path.h"
+#include "util/hash.h"
 #include "util/logging.h"
+#include "util/platform.h"
+#include "util/thread_pool.h"
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
-const char kHelpShortOption[]   = "-h";
-const char kHelpLongOption[]    = "--help";
-const char kVersionOption[]     = "--version";
 const char kDirectoryArgument[] = "--dir";
-const char kNoDebugPopup[]      = "--no-debug-popup";
+const char kJobsArgument[]      = "--jobs";
+const char kDedupOption[]       = "--dedup";
 
-const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
-const char kArguments[] = "--dir";
+const char kOptions[]   = "-h|--help,--version,--dedup,--no-debug-popup";
+const char kArguments[] = "--dir,--jobs";
+
+const char kManifestFileName[] = "manifest.json";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -54,7 +63,8 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Extract shaders from a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--dir <dir>] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE(
+        "  %s [-h | --help] [--version] [--dir <dir>] [--jobs <N>] [--dedup] <file>\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("Optional arguments:");
@@ -65,52 +75,51 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("             \t\tif necessary. Each shader is placed in individual file");
     GFXRECON_WRITE_CONSOLE("             \t\tnamed sh<handle_id> where handle_id is handle id of the");
     GFXRECON_WRITE_CONSOLE("             \t\tCreateShaderModule call. See gfxrecon-replay --replace-shaders.");
+    GFXRECON_WRITE_CONSOLE("             \t\tSPIR-V shader objects are named so<handle_id>, and shader");
+    GFXRECON_WRITE_CONSOLE("             \t\tcode passed directly to pipeline creation is named");
+    GFXRECON_WRITE_CONSOLE("             \t\tpl<pipeline_handle_id>_<stage_index>.");
+    GFXRECON_WRITE_CONSOLE("  --jobs <N>\t\tNumber of threads used to write shader files.  The default is 1, which");
+    GFXRECON_WRITE_CONSOLE("            \t\twrites files on the thread that reads the capture file.  A value of");
+    GFXRECON_WRITE_CONSOLE("            \t\t0 uses one less than the number of hardware threads.");
+    GFXRECON_WRITE_CONSOLE("  --dedup\t\tWrite shaders with identical code only once, to the file named");
+    GFXRECON_WRITE_CONSOLE("         \t\tfor the first handle created with that code, and write %s", kManifestFileName);
+    GFXRECON_WRITE_CONSOLE("         \t\tmapping the handle id of every shader to the file containing");
+    GFXRECON_WRITE_CONSOLE("         \t\tits code.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
 #endif
 }
 
-static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
-{
-    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
-    {
-        PrintUsage(exe_name);
-        return true;
-    }
-
-    return false;
-}
-
-static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+// Writes the SPIR-V code of shader modules, of shader objects, and of shader module create info structures chained to
+// pipeline shader stages.  Only the calls that create shaders are decoded, and files are written by a thread pool
+// when one is requested.  With deduplication, shaders with the same code are written once, to the file named for the
+// first handle created with that code, and a manifest maps each handle to the file containing its code.
+class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
 {
-    if (arg_parser.IsOptionSet(kVersionOption))
+  public:
+    VulkanExtractConsumer(const std::string& extract_dir, bool dedup, uint32_t thread_count) :
+        extract_dir_(extract_dir), dedup_(dedup), error_count_(0)
     {
-        std::string app_name     = exe_name;
-        size_t      dir_location = app_name.find_last_of("/\\");
-
-        if (dir_location >= 0)
+        if (thread_count != 1)
         {
-            app_name.replace(0, dir_location + 1, "");
+            thread_pool_ = std::make_unique<gfxrecon::util::ThreadPool>(thread_count);
         }
+    }
 
-        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
-        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
-        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
-                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
-                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
-                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
-
+    virtual bool GetProcessedApiCalls(std::unordered_set<gfxrecon::format::ApiCallId>* api_calls) const override
+    {
+        api_calls->insert(gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule);
+        api_calls->insert(gfxrecon::format::ApiCallId::ApiCall_vkCreateGraphicsPipelines);
+        api_calls->insert(gfxrecon::format::ApiCallId::ApiCall_vkCreateComputePipelines);
+        api_calls->insert(gfxrecon::format::ApiCallId::ApiCall_vkCreateShadersEXT);
         return true;
     }
 
-    return false;
-}
-
-class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
-{
-  public:
-    VulkanExtractConsumer(std::string& extract_dir) : extract_dir_(extract_dir) {}
+    virtual bool GetProcessedMetaDataTypes(std::unordered_set<gfxrecon::format::MetaDataType>*) const override
+    {
+        return true;
+    }
 
     virtual void Process_vkCreateShaderModule(
         const gfxrecon::decode::ApiCallInfo&                                                        call_info,
@@ -123,32 +132,268 @@ class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
         if ((returnValue >= 0) && (pCreateInfo != nullptr) && !pCreateInfo->IsNull() && (pShaderModule != nullptr) &&
             !pShaderModule->IsNull())
         {
-            const uint32_t* orig_code = pCreateInfo->GetPointer()->pCode;
-            size_t          orig_size = pCreateInfo->GetPointer()->codeSize;
-            uint64_t        handle_id = *pShaderModule->GetPointer();
-            std::string     file_name = "sh" + std::to_string(handle_id);
-            std::string     file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
+            const VkShaderModuleCreateInfo* create_info = pCreateInfo->GetPointer();
+            uint64_t                        handle_id   = *pShaderModule->GetPointer();
 
-            FILE*   fp     = nullptr;
-            int32_t result = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
-            if (result == 0)
+            AddShader(
+                "sh" + std::to_string(handle_id), handle_id, kNoStageIndex, create_info->pCode, create_info->codeSize);
+        }
+    }
+
+    virtual void Process_vkCreateGraphicsPipelines(
+        const gfxrecon::decode::ApiCallInfo& call_info,
+        VkResult                             returnValue,
+        gfxrecon::format::HandleId           device,
+        gfxrecon::format::HandleId           pipelineCache,
+        uint32_t                             createInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
+        gfxrecon::decode::HandlePointerDecoder<VkPipeline>* pPipelines) override
+    {
+        if ((returnValue >= 0) && (pCreateInfos != nullptr) && !pCreateInfos->IsNull() && (pPipelines != nullptr) &&
+            !pPipelines->IsNull())
+        {
+            const VkGraphicsPipelineCreateInfo* create_infos = pCreateInfos->GetPointer();
+            const gfxrecon::format::HandleId*   pipeline_ids = pPipelines->GetPointer();
+            const size_t                        count = std::min(pCreateInfos->GetLength(), pPipelines->GetLength());
+
+            for (size_t i = 0; i < count; ++i)
             {
-                size_t written_size = gfxrecon::util::platform::FileWrite(orig_code, sizeof(char), orig_size, fp);
-                if (written_size != orig_size)
+                if (create_infos[i].pStages != nullptr)
                 {
-                    GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_name.c_str());
+                    for (uint32_t j = 0; j < create_infos[i].stageCount; ++j)
+                    {
+                        AddPipelineStage(pipeline_ids[i], j, create_infos[i].pStages[j]);
+                    }
                 }
-                gfxrecon::util::platform::FileClose(fp);
             }
-            else
+        }
+    }
+
+    virtual void Process_vkCreateComputePipelines(
+        const gfxrecon::decode::ApiCallInfo& call_info,
+        VkResult                             returnValue,
+        gfxrecon::format::HandleId           device,
+        gfxrecon::format::HandleId           pipelineCache,
+        uint32_t                             createInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
+        gfxrecon::decode::HandlePointerDecoder<VkPipeline>* pPipelines) override
+    {
+        if ((returnValue >= 0) && (pCreateInfos != nullptr) && !pCreateInfos->IsNull() && (pPipelines != nullptr) &&
+            !pPipelines->IsNull())
+        {
+            const VkComputePipelineCreateInfo* create_infos = pCreateInfos->GetPointer();
+            const gfxrecon::format::HandleId*  pipeline_ids = pPipelines->GetPointer();
+            const size_t                       count = std::min(pCreateInfos->GetLength(), pPipelines->GetLength());
+
+            for (size_t i = 0; i < count; ++i)
             {
-                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_name.c_str());
+                AddPipelineStage(pipeline_ids[i], 0, create_infos[i].stage);
             }
         }
     }
 
+    virtual void Process_vkCreateShadersEXT(
+        const gfxrecon::decode::ApiCallInfo&                                                     call_info,
+        VkResult                                                                                 returnValue,
+        gfxrecon::format::HandleId                                                               device,
+        uint32_t                                                                                 createInfoCount,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkShaderCreateInfoEXT>* pCreateInfos,
+        gfxrecon::decode::StructPointerDecoder<gfxrecon::decode::Decoded_VkAllocationCallbacks>*,
+        gfxrecon::decode::HandlePointerDecoder<VkShaderEXT>* pShaders) override
+    {
+        if ((returnValue >= 0) && (pCreateInfos != nullptr) && !pCreateInfos->IsNull() && (pShaders != nullptr) &&
+            !pShaders->IsNull())
+        {
+            const VkShaderCreateInfoEXT*      create_infos = pCreateInfos->GetPointer();
+            const gfxrecon::format::HandleId* shader_ids   = pShaders->GetPointer();
+            const size_t                      count = std::min(pCreateInfos->GetLength(), pShaders->GetLength());
+
+            // Binary shader code is specific to the implementation that produced it, so only SPIR-V is extracted.
+            for (size_t i = 0; i < count; ++i)
+            {
+                if ((create_infos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) &&
+                    (shader_ids[i] != gfxrecon::format::kNullHandleId))
+                {
+                    AddShader("so" + std::to_string(shader_ids[i]),
+                              shader_ids[i],
+                              kNoStageIndex,
+                              create_infos[i].pCode,
+                              create_infos[i].codeSize);
+                }
+            }
+        }
+    }
+
+    // Waits for the pending file writes to complete and writes the manifest.
+    void Finish()
+    {
+        // Destroying the thread pool completes the queued tasks.
+        thread_pool_.reset();
+
+        if (dedup_)
+        {
+            WriteManifest();
+        }
+    }
+
+    size_t GetShaderCount() const { return manifest_.size(); }
+
+    size_t GetDuplicateCount() const { return duplicate_count_; }
+
+    uint32_t GetErrorCount() const { return error_count_.load(); }
+
+  private:
+    static const int64_t kNoStageIndex = -1;
+
+    struct UniqueShader
+    {
+        std::shared_ptr<const std::vector<uint8_t>> code;
+        std::string                                 file_name;
+    };
+
+    struct ManifestEntry
+    {
+        gfxrecon::format::HandleId handle_id;
+        int64_t                    stage_index;
+        std::string                file_name;
+    };
+
   private:
-    std::string extract_dir_;
+    // Pipelines created with VK_KHR_maintenance5 or VK_EXT_graphics_pipeline_library may provide the shader code by
+    // chaining VkShaderModuleCreateInfo to the stage, instead of specifying a shader module.
+    void AddPipelineStage(gfxrecon::format::HandleId             pipeline_id,
+                          uint32_t                               stage_index,
+                          const VkPipelineShaderStageCreateInfo& stage)
+    {
+        if (pipeline_id == gfxrecon::format::kNullHandleId)
+        {
+            return;
+        }
+
+        auto next = reinterpret_cast<const VkBaseInStructure*>(stage.pNext);
+        while (next != nullptr)
+        {
+            if (next->sType == VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO)
+            {
+                auto create_info = reinterpret_cast<const VkShaderModuleCreateInfo*>(next);
+                AddShader("pl" + std::to_string(pipeline_id) + "_" + std::to_string(stage_index),
+                          pipeline_id,
+                          stage_index,
+                          create_info->pCode,
+                          create_info->codeSize);
+                break;
+            }
+
+            next = next->pNext;
+        }
+    }
+
+    void AddShader(const std::string&         file_name,
+                   gfxrecon::format::HandleId handle_id,
+                   int64_t                    stage_index,
+                   const void*                code,
+                   size_t                     code_size)
+    {
+        if ((code == nullptr) || (code_size == 0))
+        {
+            return;
+        }
+
+        // The decoded code is released after the call is processed, so the file write needs its own copy.
+        auto bytes = reinterpret_cast<const uint8_t*>(code);
+        auto data  = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + code_size);
+
+        if (dedup_)
+        {
+            // Shaders with equal hashes are compared in full, so that a hash collision cannot drop a shader.
+            const uint64_t hash = gfxrecon::util::hash::ContentHash64::Generate(data->data(), data->size());
+
+            auto& candidates = unique_shaders_[hash];
+            auto  match      = std::find_if(candidates.begin(), candidates.end(), [&data](const UniqueShader& shader) {
+                return (*shader.code == *data);
+            });
+
+            if (match != candidates.end())
+            {
+                manifest_.push_back({ handle_id, stage_index, match->file_name });
+                ++duplicate_count_;
+                return;
+            }
+
+            candidates.push_back({ data, file_name });
+        }
+
+        manifest_.push_back({ handle_id, stage_index, file_name });
+
+        if (thread_pool_ != nullptr)
+        {
+            thread_pool_->Submit([this, file_name, data]() { WriteFile(file_name, *data); });
+        }
+        else
+        {
+            WriteFile(file_name, *data);
+        }
+    }
+
+    // Called from the thread pool workers when a thread pool is used.
+    void WriteFile(const std::string& file_name, const std::vector<uint8_t>& data)
+    {
+        std::string file_path = gfxrecon::util::filepath::Join(extract_dir_, file_name);
+
+        FILE*   fp     = nullptr;
+        int32_t result = gfxrecon::util::platform::FileOpen(&fp, file_path.c_str(), "wb");
+        if (result == 0)
+        {
+            size_t written_size = gfxrecon::util::platform::FileWrite(data.data(), sizeof(char), data.size(), fp);
+            if (written_size != data.size())
+            {
+                GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not complete", file_name.c_str());
+                ++error_count_;
+            }
+            gfxrecon::util::platform::FileClose(fp);
+        }
+        else
+        {
+            GFXRECON_WRITE_CONSOLE("Error while writing file %s: Could not open", file_name.c_str());
+            ++error_count_;
+        }
+    }
+
+    void WriteManifest()
+    {
+        std::string manifest = "{\n    \"shaders\": [";
+
+        for (size_t i = 0; i < manifest_.size(); ++i)
+        {
+            const ManifestEntry& entry = manifest_[i];
+
+            manifest += (i == 0) ? "\n" : ",\n";
+            manifest += "        { \"handle-id\": " + std::to_string(entry.handle_id);
+            if (entry.stage_index != kNoStageIndex)
+            {
+                manifest += ", \"stage-index\": " + std::to_string(entry.stage_index);
+            }
+            manifest += ", \"file\": \"" + entry.file_name + "\" }";
+        }
+
+        manifest += manifest_.empty() ? "]\n}\n" : "\n    ]\n}\n";
+
+        std::vector<uint8_t> data(manifest.begin(), manifest.end());
+        WriteFile(kManifestFileName, data);
+    }
+
+  private:
+    std::string                                             extract_dir_;
+    bool                                                    dedup_;
+    std::unordered_map<uint64_t, std::vector<UniqueShader>> unique_shaders_;
+    std::vector<ManifestEntry>                              manifest_;
+    size_t                                                  duplicate_count_{ 0 };
+    std::atomic<uint32_t>                                   error_count_;
+
+    // Declared last, so that pending writes complete before the members they use are destroyed.
+    std::unique_ptr<gfxrecon::util::ThreadPool> thread_pool_;
 };
 
 int main(int argc, const char** argv)
@@ -178,6 +423,17 @@ int main(int argc, const char** argv)
 #endif
     }
 
+    uint32_t thread_count = 1;
+
+    const std::string& jobs_value = arg_parser.GetArgumentValue(kJobsArgument);
+    if (!jobs_value.empty() && !ParseUnsignedArgument(jobs_value, &thread_count))
+    {
+        GFXRECON_LOG_ERROR("Invalid value \'%s\' for %s", jobs_value.c_str(), kJobsArgument);
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
     const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
     std::string                     input_filename       = positional_arguments[0];
     gfxrecon::decode::FileProcessor file_processor;
@@ -217,14 +473,30 @@ int main(int argc, const char** argv)
             }
         }
 
+        const bool dedup = arg_parser.IsOptionSet(kDedupOption);
+
         gfxrecon::decode::VulkanDecoder decoder;
-        VulkanExtractConsumer           extract_consumer(extract_dir);
+        VulkanExtractConsumer           extract_consumer(extract_dir, dedup, thread_count);
 
         decoder.AddConsumer(&extract_consumer);
 
         file_processor.AddDecoder(&decoder);
         file_processor.ProcessAllFrames();
 
+        extract_consumer.Finish();
+
+        if (extract_consumer.GetErrorCount() > 0)
+        {
+            GFXRECON_WRITE_CONSOLE("%u files could not be written", extract_consumer.GetErrorCount());
+        }
+
+        if (dedup)
+        {
+            GFXRECON_WRITE_CONSOLE("Extracted %zu shaders, of which %zu were duplicates",
+                                   extract_consumer.GetShaderCount(),
+                                   extract_consumer.GetDuplicateCount());
+        }
+
         if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
             GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
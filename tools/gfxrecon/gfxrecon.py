@@ -25,7 +25,7 @@
 # Utility for invoking gfxrecon commands
 # Usage:
 #
-#     gfxrecon.py [capture|compress|convert|extract|info|optimize|replay] [<args>]
+#     gfxrecon.py [capture|compress|concat|convert|extract|info|optimize|replay] [<args>]
 #
 #         args is a command-specific argument list
 
@@ -46,6 +46,7 @@ argc = len(sys.argv)
 valid_commands = [
     'capture-vulkan',
     'compress',
+    'concat',
     'convert',
     'extract',
     'info',
@@ -50,9 +50,12 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <cstdlib>
 #include <limits>
+#include <map>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -92,14 +95,22 @@ class AnnotationRecorder : public gfxrecon::decode::AnnotationHandler
         {
             operation_annotation_datas_.push_back(data);
         }
+        else if (type == gfxrecon::format::AnnotationType::kJson &&
+                 label.compare(gfxrecon::format::kAnnotationLabelCaptureStatistics) == 0)
+        {
+            statistics_annotation_datas_.push_back(data);
+        }
     }
 
     uint64_t GetAnnotationCount() const { return annotation_count_; }
 
     const std::vector<std::string>& GetOperationAnnotationDatas() const { return operation_annotation_datas_; }
 
+    const std::vector<std::string>& GetStatisticsAnnotationDatas() const { return statistics_annotation_datas_; }
+
   private:
     std::vector<std::string> operation_annotation_datas_;
+    std::vector<std::string> statistics_annotation_datas_;
     uint64_t                 annotation_count_{ 0 };
 };
 
@@ -243,6 +254,124 @@ std::string GetJsonValue(const nlohmann::json& json_obj, const std::string& key)
     return out;
 }
 
+double NanosecondsToMilliseconds(uint64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1000000.0;
+}
+
+// Sums the capture statistics annotations written with GFXRECON_CAPTURE_STATISTICS_FRAMES and prints the capture
+// overhead for the whole file.
+void PrintCaptureStatistics(const std::vector<std::string>& statistics_annotation_datas)
+{
+    if (statistics_annotation_datas.empty())
+    {
+        return;
+    }
+
+    std::map<std::string, uint64_t>                      totals;
+    std::map<std::string, std::pair<uint64_t, uint64_t>> block_totals;
+    uint32_t                                             first_frame = std::numeric_limits<uint32_t>::max();
+    uint32_t                                             last_frame  = 0;
+
+    for (const auto& data : statistics_annotation_datas)
+    {
+        nlohmann::json json_obj = nlohmann::json::parse(data, nullptr, false);
+
+        if (json_obj.is_discarded() || !json_obj.is_object())
+        {
+            GFXRECON_LOG_WARNING("Invalid JSON in capture statistics annotation: \"%s\"", data.c_str());
+            continue;
+        }
+
+        for (const auto& entry : json_obj.items())
+        {
+            if (entry.key() == "first-frame")
+            {
+                first_frame = std::min(first_frame, entry.value().get<uint32_t>());
+            }
+            else if (entry.key() == "last-frame")
+            {
+                last_frame = std::max(last_frame, entry.value().get<uint32_t>());
+            }
+            else if (entry.key() == "blocks")
+            {
+                for (const auto& block : entry.value().items())
+                {
+                    auto& block_total = block_totals[block.key()];
+                    block_total.first += block.value().value("count", uint64_t{ 0 });
+                    block_total.second += block.value().value("bytes", uint64_t{ 0 });
+                }
+            }
+            else if (entry.value().is_number_unsigned())
+            {
+                totals[entry.key()] += entry.value().get<uint64_t>();
+            }
+        }
+    }
+
+    if (first_frame > last_frame)
+    {
+        return;
+    }
+
+    const uint32_t frame_count = last_frame - first_frame + 1;
+
+    GFXRECON_WRITE_CONSOLE("");
+    GFXRECON_WRITE_CONSOLE("Capture statistics:");
+    GFXRECON_WRITE_CONSOLE("\tFrames: %u-%u (%u frames)", first_frame, last_frame, frame_count);
+    GFXRECON_WRITE_CONSOLE("\tAPI calls: %" PRIu64, totals["api-calls"]);
+
+    const std::pair<const char*, const char*> timers[] = {
+        { "Encode time", "encode-time-ns" },
+        { "Compress time", "compress-time-ns" },
+        { "Write time", "write-time-ns" },
+        { "State snapshot time", "state-snapshot-time-ns" },
+        { "Page guard fault time", "page-guard-fault-time-ns" },
+        { "Page guard process time", "page-guard-process-time-ns" }
+    };
+
+    for (const auto& timer : timers)
+    {
+        auto iter = totals.find(timer.second);
+        if (iter != totals.end())
+        {
+            const double total_ms = NanosecondsToMilliseconds(iter->second);
+            GFXRECON_WRITE_CONSOLE(
+                "\t%s: %.3f ms (%.3f ms per frame)", timer.first, total_ms, total_ms / frame_count);
+        }
+    }
+
+    const uint64_t compress_input  = totals["compress-input-bytes"];
+    const uint64_t compress_output = totals["compress-output-bytes"];
+    if (compress_input > 0)
+    {
+        GFXRECON_WRITE_CONSOLE("\tCompression: %" PRIu64 " bytes to %" PRIu64 " bytes (ratio %.2f)",
+                               compress_input,
+                               compress_output,
+                               static_cast<double>(compress_output) / static_cast<double>(compress_input));
+    }
+
+    auto faults = totals.find("page-guard-faults");
+    if (faults != totals.end())
+    {
+        GFXRECON_WRITE_CONSOLE("\tPage guard faults: %" PRIu64, faults->second);
+        GFXRECON_WRITE_CONSOLE("\tPage guard process calls: %" PRIu64, totals["page-guard-process-calls"]);
+        GFXRECON_WRITE_CONSOLE("\tPage guard modified bytes: %" PRIu64, totals["page-guard-modified-bytes"]);
+    }
+
+    if (!block_totals.empty())
+    {
+        GFXRECON_WRITE_CONSOLE("\tBlocks written:");
+        for (const auto& block_total : block_totals)
+        {
+            GFXRECON_WRITE_CONSOLE("\t\t%s: %" PRIu64 " blocks, %" PRIu64 " bytes",
+                                   block_total.first.c_str(),
+                                   block_total.second.first,
+                                   block_total.second.second);
+        }
+    }
+}
+
 void PrintAnnotations(uint32_t                          annotation_count,
                       const std::vector<std::string>&   operation_annotation_datas,
                       const std::vector<AnnotationInfo> target_annotations)
@@ -802,6 +931,8 @@ void GatherAndPrintAllInfo(const std::string& input_filename)
             PrintAnnotations(annotation_recorder.GetAnnotationCount(),
                              annotation_recorder.GetOperationAnnotationDatas(),
                              target_annotations);
+
+            PrintCaptureStatistics(annotation_recorder.GetStatisticsAnnotationDatas());
         }
         else
         {
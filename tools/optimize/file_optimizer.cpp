@@ -50,6 +50,78 @@ uint64_t FileOptimizer::GetUnreferencedBlocksSize()
     return unreferenced_blocks_.size();
 }
 
+bool FileOptimizer::ProcessRanges(const std::vector<ResourceInitBlock>& removed_blocks, uint64_t file_size)
+{
+    // Initialize() has already copied the file header, so copying starts at the first block.
+    uint64_t position = GetNumBytesRead();
+
+    for (const auto& block : removed_blocks)
+    {
+        GFXRECON_ASSERT((block.offset >= position) && ((block.offset + block.size) <= file_size));
+
+        if (!CopyRange(block.offset - position))
+        {
+            HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy block data");
+            return false;
+        }
+
+        std::string data;
+        if (block.type == format::MetaDataType::kInitBufferCommand)
+        {
+            data = "Removed buffer " + std::to_string(block.resource_id);
+        }
+        else
+        {
+            GFXRECON_ASSERT(block.type == format::MetaDataType::kInitImageCommand);
+            data = "Removed subresource from image " + std::to_string(block.resource_id);
+        }
+
+        if (!WriteRemovedResourceAnnotation(data))
+        {
+            return false;
+        }
+
+        if (!SkipBytes(block.size))
+        {
+            HandleBlockReadError(kErrorSeekingFile, "Failed to skip removed resource initialization block");
+            return false;
+        }
+
+        position = block.offset + block.size;
+    }
+
+    if (!CopyRange(file_size - position))
+    {
+        HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy block data");
+        return false;
+    }
+
+    return (GetErrorState() == kErrorNone);
+}
+
+bool FileOptimizer::WriteRemovedResourceAnnotation(const std::string& data)
+{
+    const char*  label        = format::kAnnotationLabelRemovedResource;
+    const size_t label_length = util::platform::StringLength(label);
+    const size_t data_length  = data.length();
+
+    format::AnnotationHeader annotation;
+    annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
+    annotation.block_header.type = format::BlockType::kAnnotation;
+    annotation.annotation_type   = format::kText;
+    annotation.label_length      = static_cast<uint32_t>(label_length);
+    annotation.data_length       = static_cast<uint64_t>(data_length);
+
+    if (!WriteBytes(&annotation, sizeof(annotation)) || !WriteBytes(label, label_length) ||
+        !WriteBytes(data.c_str(), data_length))
+    {
+        HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write annotation meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
 bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
@@ -104,26 +176,9 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
         // If the buffer is in the unused list, omit its initialization data from the file.
         if (unreferenced_ids_.find(header.buffer_id) != unreferenced_ids_.end())
         {
-            // In its place insert a dummy annotation meta command. This should keep the block index when
-            // replaying an optimized trimmed capture in in alignment with the block index calculated
-            // at capture time
-            const char*       label = format::kAnnotationLabelRemovedResource;
-            const std::string data  = "Removed buffer " + std::to_string(header.buffer_id);
-
-            const size_t label_length = util::platform::StringLength(label);
-            const size_t data_length  = data.length();
-
-            format::AnnotationHeader annotation;
-            annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
-            annotation.block_header.type = format::BlockType::kAnnotation;
-            annotation.annotation_type   = format::kText;
-            annotation.label_length      = static_cast<uint32_t>(label_length);
-            annotation.data_length       = static_cast<uint64_t>(data.length());
-
-            if (!WriteBytes(&annotation, sizeof(annotation)) || !WriteBytes(label, label_length) ||
-                !WriteBytes(data.c_str(), data_length))
+            // In its place insert a dummy annotation meta command.
+            if (!WriteRemovedResourceAnnotation("Removed buffer " + std::to_string(header.buffer_id)))
             {
-                HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write annotation meta-data block");
                 return false;
             }
 
@@ -185,26 +240,9 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
         // If the image is in the unused list, omit its initialization data from the file.
         if (unreferenced_ids_.find(header.image_id) != unreferenced_ids_.end())
         {
-            // In its place insert a dummy annotation meta command. This should keep the block index when
-            // replaying an optimized trimmed capture in in alignment with the block index calculated
-            // at capture time
-            const char*       label = format::kAnnotationLabelRemovedResource;
-            const std::string data  = "Removed subresource from image " + std::to_string(header.image_id);
-
-            const size_t label_length = util::platform::StringLength(label);
-            const size_t data_length  = data.length();
-
-            format::AnnotationHeader annotation;
-            annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
-            annotation.block_header.type = format::BlockType::kAnnotation;
-            annotation.annotation_type   = format::kText;
-            annotation.label_length      = static_cast<uint32_t>(label_length);
-            annotation.data_length       = static_cast<uint64_t>(data.length());
-
-            if (!WriteBytes(&annotation, sizeof(annotation)) || !WriteBytes(label, label_length) ||
-                !WriteBytes(data.c_str(), data_length))
+            // In its place insert a dummy annotation meta command.
+            if (!WriteRemovedResourceAnnotation("Removed subresource from image " + std::to_string(header.image_id)))
             {
-                HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write annotation meta-data block");
                 return false;
             }
 
@@ -26,12 +26,24 @@
 #include "decode/file_transformer.h"
 #include "util/defines.h"
 
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
 class FileOptimizer : public decode::FileTransformer
 {
+  public:
+    // Location of the init buffer or init image meta-data block for a resource, recorded while scanning the file.
+    struct ResourceInitBlock
+    {
+        format::HandleId     resource_id;
+        format::MetaDataType type;
+        uint64_t             offset; // File offset of the block header.
+        uint64_t             size;   // Size of the block, including the block header.
+    };
+
   public:
     FileOptimizer(){};
 
@@ -43,6 +55,11 @@ class FileOptimizer : public decode::FileTransformer
 
     uint64_t GetUnreferencedBlocksSize();
 
+    // Writes the output file as contiguous copies of the input file ranges between the removed blocks, which are
+    // replaced by annotations, instead of processing each block.  The removed blocks must be sorted by offset, and
+    // file_size is the size of the input file.
+    bool ProcessRanges(const std::vector<ResourceInitBlock>& removed_blocks, uint64_t file_size);
+
   protected:
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
@@ -51,6 +68,10 @@ class FileOptimizer : public decode::FileTransformer
                                    uint64_t                   block_index = 0) override;
 
   private:
+    // Writes an annotation in place of a removed block, which keeps the block index when replaying an optimized
+    // trimmed capture in alignment with the block index calculated at capture time.
+    bool WriteRemovedResourceAnnotation(const std::string& data);
+
     bool FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool FilterInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
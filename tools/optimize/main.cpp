@@ -23,6 +23,7 @@
 
 #include PROJECT_VERSION_HEADER_FILE
 #include "file_optimizer.h"
+#include "vulkan_init_block_locator.h"
 
 #include "../tool_settings.h"
 
@@ -113,18 +114,22 @@ static void PrintUsage(const char* exe_name)
 #endif
 }
 
-void GetUnreferencedResources(const std::string&                              input_filename,
-                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids)
+void GetUnreferencedResources(const std::string&                                       input_filename,
+                              std::unordered_set<gfxrecon::format::HandleId>*          unreferenced_ids,
+                              std::vector<gfxrecon::FileOptimizer::ResourceInitBlock>* init_blocks,
+                              uint64_t*                                                file_size)
 {
-    GFXRECON_ASSERT(unreferenced_ids != nullptr);
+    GFXRECON_ASSERT((unreferenced_ids != nullptr) && (init_blocks != nullptr) && (file_size != nullptr));
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::VulkanDecoder                    decoder;
         gfxrecon::decode::VulkanReferencedResourceConsumer resref_consumer;
+        gfxrecon::VulkanInitBlockLocator                   init_block_locator(&file_processor);
 
         decoder.AddConsumer(&resref_consumer);
+        decoder.AddConsumer(&init_block_locator);
 
         file_processor.AddDecoder(&decoder);
         file_processor.ProcessAllFrames();
@@ -140,6 +145,9 @@ void GetUnreferencedResources(const std::string&                              in
         {
             // Get the list of resources that were included in a command buffer submission during replay.
             resref_consumer.GetReferencedResourceIds(nullptr, unreferenced_ids);
+
+            (*init_blocks) = init_block_locator.GetInitBlocks();
+            (*file_size)   = file_processor.GetNumBytesRead();
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
@@ -156,14 +164,26 @@ void GetUnreferencedResources(const std::string&                              in
     }
 }
 
-void FilterUnreferencedResources(const std::string&                               input_filename,
-                                 const std::string&                               output_filename,
-                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
+void FilterUnreferencedResources(const std::string&                                             input_filename,
+                                 const std::string&                                             output_filename,
+                                 const std::unordered_set<gfxrecon::format::HandleId>&          unreferenced_ids,
+                                 const std::vector<gfxrecon::FileOptimizer::ResourceInitBlock>& init_blocks,
+                                 uint64_t                                                       file_size)
 {
-    gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
+    // Only the blocks for unreferenced resources are removed; the file data between them is copied as whole ranges.
+    std::vector<gfxrecon::FileOptimizer::ResourceInitBlock> removed_blocks;
+    for (const auto& block : init_blocks)
+    {
+        if (unreferenced_ids.find(block.resource_id) != unreferenced_ids.end())
+        {
+            removed_blocks.push_back(block);
+        }
+    }
+
+    gfxrecon::FileOptimizer file_processor;
     if (file_processor.Initialize(input_filename, output_filename))
     {
-        file_processor.Process();
+        file_processor.ProcessRanges(removed_blocks, file_size);
 
         if (file_processor.GetErrorState() != gfxrecon::FileOptimizer::kErrorNone)
         {
@@ -181,15 +201,17 @@ void FilterUnreferencedResources(const std::string&
 void VkRemoveRedundantResources(std::string input_filename, std::string output_filename)
 {
     GFXRECON_WRITE_CONSOLE("Scanning Vulkan file %s for unreferenced resources.", input_filename.c_str());
-    std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
-    GetUnreferencedResources(input_filename, &unreferenced_ids);
+    std::unordered_set<gfxrecon::format::HandleId>          unreferenced_ids;
+    std::vector<gfxrecon::FileOptimizer::ResourceInitBlock> init_blocks;
+    uint64_t                                                file_size = 0;
+    GetUnreferencedResources(input_filename, &unreferenced_ids, &init_blocks, &file_size);
 
     if (!unreferenced_ids.empty())
     {
         // Filter unreferenced ids.
         GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64 " unused resources.",
                                unreferenced_ids.size());
-        FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids));
+        FilterUnreferencedResources(input_filename, output_filename, unreferenced_ids, init_blocks, file_size);
     }
     else
     {
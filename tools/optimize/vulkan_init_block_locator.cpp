@@ -0,0 +1,73 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vulkan_init_block_locator.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+void VulkanInitBlockLocator::ProcessInitBufferCommand(format::HandleId device_id,
+                                                      format::HandleId buffer_id,
+                                                      uint64_t         data_size,
+                                                      const uint8_t*   data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device_id);
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    AddInitBlock(buffer_id, format::MetaDataType::kInitBufferCommand);
+}
+
+void VulkanInitBlockLocator::ProcessInitImageCommand(format::HandleId             device_id,
+                                                     format::HandleId             image_id,
+                                                     uint64_t                     data_size,
+                                                     uint32_t                     aspect,
+                                                     uint32_t                     layout,
+                                                     const std::vector<uint64_t>& level_sizes,
+                                                     const uint8_t*               data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device_id);
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(aspect);
+    GFXRECON_UNREFERENCED_PARAMETER(layout);
+    GFXRECON_UNREFERENCED_PARAMETER(level_sizes);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    AddInitBlock(image_id, format::MetaDataType::kInitImageCommand);
+}
+
+void VulkanInitBlockLocator::AddInitBlock(format::HandleId resource_id, format::MetaDataType type)
+{
+    assert(file_processor_ != nullptr);
+
+    // Meta-data commands are dispatched after the entire block has been read, so the current read position is the end
+    // of the block.
+    const uint64_t offset = file_processor_->GetCurrentBlockOffset();
+    const uint64_t end    = file_processor_->GetNumBytesRead();
+
+    assert(end > offset);
+
+    init_blocks_.push_back({ resource_id, type, offset, end - offset });
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
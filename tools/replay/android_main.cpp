@@ -26,6 +26,8 @@
 #include "application/android_context.h"
 #include "application/android_window.h"
 #include "decode/file_processor.h"
+#include "decode/shadow_memory.h"
+#include "decode/vulkan_command_buffer_reuse_decoder.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "format/format.h"
@@ -91,6 +93,15 @@ void android_main(struct android_app* app)
         gfxrecon::util::Log::Release();
         gfxrecon::util::Log::Init(log_settings);
 
+        if (!ConfigureDecodeAllocator(arg_parser))
+        {
+            PrintUsage(kApplicationName);
+            run = false;
+        }
+    }
+
+    if (run)
+    {
         std::string filename = kDefaultCaptureFile;
 
         if (arg_parser.GetPositionalArgumentsCount() == 1)
@@ -125,9 +136,9 @@ void android_main(struct android_app* app)
                     return;
                 }
 
-                gfxrecon::decode::VulkanReplayConsumer replay_consumer(application, replay_options);
-                gfxrecon::decode::VulkanDecoder        decoder;
-                uint32_t                               start_frame, end_frame;
+                gfxrecon::decode::VulkanReplayConsumer            replay_consumer(application, replay_options);
+                gfxrecon::decode::VulkanCommandBufferReuseDecoder decoder(replay_options.reuse_command_buffers);
+                uint32_t                                          start_frame, end_frame;
                 bool        has_mfr = GetMeasurementFrameRange(arg_parser, start_frame, end_frame);
                 std::string measurement_file_name;
 
@@ -142,13 +153,16 @@ void android_main(struct android_app* app)
                                                      replay_options.quit_after_measurement_frame_range,
                                                      replay_options.flush_measurement_frame_range,
                                                      replay_options.flush_inside_measurement_range,
-                                                     measurement_file_name);
+                                                     measurement_file_name,
+                                                     replay_options.measurement_cost_breakdown);
 
                 replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
                 replay_consumer.SetFpsInfo(&fps_info);
 
+                decoder.SetCostTracker(fps_info.GetCostTracker());
                 decoder.AddConsumer(&replay_consumer);
                 file_processor.AddDecoder(&decoder);
+                file_processor.SetCostTracker(fps_info.GetCostTracker());
                 application->SetPauseFrame(GetPauseFrame(arg_parser));
 
                 // Warn if the capture layer is active.
@@ -168,6 +182,13 @@ void android_main(struct android_app* app)
                 // Add one so that it matches the trim range frame number semantic
                 fps_info.EndFile(file_processor.GetCurrentFrameNumber() + 1);
 
+                // Host memory used to reconstruct the content of mapped memory with --memory-translation rebind.
+                if (gfxrecon::decode::ShadowMemory::GetPeakCommittedSize() > 0)
+                {
+                    GFXRECON_LOG_INFO("Peak rebind shadow memory: %" PRIu64 " bytes",
+                                      gfxrecon::decode::ShadowMemory::GetPeakCommittedSize());
+                }
+
                 if ((file_processor.GetCurrentFrameNumber() > 0) &&
                     (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
                 {
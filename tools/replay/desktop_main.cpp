@@ -26,6 +26,8 @@
 
 #include "application/application.h"
 #include "decode/file_processor.h"
+#include "decode/shadow_memory.h"
+#include "decode/vulkan_command_buffer_reuse_decoder.h"
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -144,6 +146,13 @@ int main(int argc, const char** argv)
     gfxrecon::util::Log::Release();
     gfxrecon::util::Log::Init(log_settings);
 
+    if (!ConfigureDecodeAllocator(arg_parser))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
     try
     {
         const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
@@ -179,6 +188,7 @@ int main(int argc, const char** argv)
             bool        quit_after_measurement_frame_range = false;
             bool        flush_measurement_frame_range      = false;
             bool        flush_inside_measurement_range     = false;
+            bool        measurement_cost_breakdown         = false;
             std::string measurement_file_name;
 
             if (vulkan_replay_options.enable_vulkan)
@@ -187,6 +197,7 @@ int main(int argc, const char** argv)
                 quit_after_measurement_frame_range = vulkan_replay_options.quit_after_measurement_frame_range;
                 flush_measurement_frame_range      = vulkan_replay_options.flush_measurement_frame_range;
                 flush_inside_measurement_range     = vulkan_replay_options.flush_inside_measurement_range;
+                measurement_cost_breakdown         = vulkan_replay_options.measurement_cost_breakdown;
             }
 
             if (has_mfr)
@@ -200,10 +211,14 @@ int main(int argc, const char** argv)
                                                  quit_after_measurement_frame_range,
                                                  flush_measurement_frame_range,
                                                  flush_inside_measurement_range,
-                                                 measurement_file_name);
+                                                 measurement_file_name,
+                                                 measurement_cost_breakdown);
 
             gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, vulkan_replay_options);
-            gfxrecon::decode::VulkanDecoder        vulkan_decoder;
+
+            // Decodes as VulkanDecoder unless --reuse-command-buffers was specified.
+            gfxrecon::decode::VulkanCommandBufferReuseDecoder vulkan_decoder(
+                vulkan_replay_options.reuse_command_buffers);
 
             if (vulkan_replay_options.enable_vulkan)
             {
@@ -211,6 +226,7 @@ int main(int argc, const char** argv)
                     [](const char* message) { throw std::runtime_error(message); });
                 vulkan_replay_consumer.SetFpsInfo(&fps_info);
 
+                vulkan_decoder.SetCostTracker(fps_info.GetCostTracker());
                 vulkan_decoder.AddConsumer(&vulkan_replay_consumer);
                 file_processor.AddDecoder(&vulkan_decoder);
             }
@@ -280,6 +296,7 @@ int main(int argc, const char** argv)
             // Warn if the capture layer is active.
             CheckActiveLayers(gfxrecon::util::platform::GetEnv(kLayerEnvVar));
 
+            file_processor.SetCostTracker(fps_info.GetCostTracker());
             fps_info.BeginFile();
 
             application->SetPauseFrame(GetPauseFrame(arg_parser));
@@ -290,6 +307,20 @@ int main(int argc, const char** argv)
             // Add one so that it matches the trim range frame number semantic
             fps_info.EndFile(file_processor.GetCurrentFrameNumber() + 1);
 
+            if (vulkan_replay_options.reuse_command_buffers)
+            {
+                GFXRECON_LOG_INFO("Reused %" PRIu64 " of %" PRIu64 " command buffer recordings",
+                                  vulkan_decoder.GetReusedCount(),
+                                  vulkan_decoder.GetReusedCount() + vulkan_decoder.GetRecordedCount());
+            }
+
+            // Host memory used to reconstruct the content of mapped memory with --memory-translation rebind.
+            if (gfxrecon::decode::ShadowMemory::GetPeakCommittedSize() > 0)
+            {
+                GFXRECON_LOG_INFO("Peak rebind shadow memory: %" PRIu64 " bytes",
+                                  gfxrecon::decode::ShadowMemory::GetPeakCommittedSize());
+            }
+
             if ((file_processor.GetCurrentFrameNumber() > 0) &&
                 (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
             {
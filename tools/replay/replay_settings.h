@@ -30,9 +30,10 @@ const char kOptions[] =
     "-h|--help,--version,--log-debugview,--no-debug-popup,--paused,--sync,--sfa|--skip-failed-allocations,--opcd|--"
     "omit-pipeline-cache-data,--remove-unsupported,--validate,--debug-device-lost,--create-dummy-allocations,--"
     "screenshot-all,--onhb|--omit-null-hardware-buffers,--qamr|--quit-after-measurement-range,--fmr|--flush-"
-    "measurement-range,--flush-inside-measurement-range,--vssb|--virtual-swapchain-skip-blit,--use-captured-swapchain-"
+    "measurement-range,--flush-inside-measurement-range,--measurement-cost-breakdown,--decode-huge-pages,--vssb|--"
+    "virtual-swapchain-skip-blit,--use-captured-swapchain-"
     "indices,--dcp,--discard-cached-psos,--use-colorspace-fallback,--use-cached-psos,--dx12-override-object-names,--"
-    "offscreen-swapchain-frame-boundary,--wait-before-present,--dump-resources-before-draw,"
+    "offscreen-swapchain-frame-boundary,--wait-before-present,--reuse-command-buffers,--dump-resources-before-draw,"
     "--dump-resources-dump-depth-attachment,--dump-"
     "resources-dump-vertex-index-buffers,--dump-resources-json-output-per-command,--dump-resources-dump-immutable-"
     "resources,--dump-resources-dump-all-image-subresources,--pbi-all";
@@ -43,7 +44,7 @@ const char kArguments[] =
     "force-windowed,--fwo|--force-windowed-origin,--batching-memory-usage,--measurement-file,--swapchain,--sgfs|--skip-"
     "get-fence-status,--sgfr|--"
     "skip-get-fence-ranges,--dump-resources,--dump-resources-scale,--dump-resources-image-format,--dump-resources-dir,"
-    "--dump-resources-dump-color-attachment-index,--pbis";
+    "--dump-resources-dump-color-attachment-index,--pbis,--decode-block-size";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -76,7 +77,8 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--offscreen-swapchain-frame-boundary]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--mfr|--measurement-frame-range <start-frame>-<end-frame>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--measurement-file <file>] [--quit-after-measurement-range]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range] [--measurement-cost-breakdown]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--decode-block-size <bytes>] [--decode-huge-pages]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--fw <width,height> | --force-windowed <width,height>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
@@ -265,6 +267,21 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tIf this is specified the replayer will flush")
     GFXRECON_WRITE_CONSOLE("          \t\tand wait for all current GPU work to finish at the");
     GFXRECON_WRITE_CONSOLE("          \t\tend of each frame inside the measurement range.");
+    GFXRECON_WRITE_CONSOLE("  --measurement-cost-breakdown");
+    GFXRECON_WRITE_CONSOLE("          \t\tAttribute the replay time of each frame in the measurement");
+    GFXRECON_WRITE_CONSOLE("          \t\trange to file read, decompression, decode, consumer work,");
+    GFXRECON_WRITE_CONSOLE("          \t\tdevice waits, and resource initialization, and write the");
+    GFXRECON_WRITE_CONSOLE("          \t\tper frame times with p50/p95/p99 summaries to the");
+    GFXRECON_WRITE_CONSOLE("          \t\tmeasurement file.");
+    GFXRECON_WRITE_CONSOLE("  --decode-block-size <bytes>");
+    GFXRECON_WRITE_CONSOLE("          \t\tSize of the memory blocks used for decoded API call");
+    GFXRECON_WRITE_CONSOLE("          \t\tparameters.  Parameters that are larger than a block");
+    GFXRECON_WRITE_CONSOLE("          \t\tare allocated separately, and the allocations are");
+    GFXRECON_WRITE_CONSOLE("          \t\treused by later calls.  Valid values are 4096 to");
+    GFXRECON_WRITE_CONSOLE("          \t\t1073741824.  Default is 65536.");
+    GFXRECON_WRITE_CONSOLE("  --decode-huge-pages");
+    GFXRECON_WRITE_CONSOLE("          \t\tRequest transparent huge page backing for decoded API");
+    GFXRECON_WRITE_CONSOLE("          \t\tcall parameter memory allocations of 2 MiB or larger.");
     GFXRECON_WRITE_CONSOLE("  --gpu-group <index>\tUse the specified device group for replay, where index");
     GFXRECON_WRITE_CONSOLE("          \t\tis the zero-based index to the array of physical device group");
     GFXRECON_WRITE_CONSOLE("          \t\treturned by vkEnumeratePhysicalDeviceGroups.  Replay may fail");
@@ -284,6 +301,10 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tForce wait on completion of queue operations for all queues");
     GFXRECON_WRITE_CONSOLE("          \t\tbefore calling Present. This is needed for accurate acquisition");
     GFXRECON_WRITE_CONSOLE("          \t\tof instrumentation data on some platforms.");
+    GFXRECON_WRITE_CONSOLE("  --reuse-command-buffers");
+    GFXRECON_WRITE_CONSOLE("          \t\tSkip recording a command buffer when its recorded calls are");
+    GFXRECON_WRITE_CONSOLE("          \t\tidentical to its previous recording, keeping the previously");
+    GFXRECON_WRITE_CONSOLE("          \t\trecorded command buffer. Not supported with --dump-resources.");
     GFXRECON_WRITE_CONSOLE("  --dump-resources <arg>");
     GFXRECON_WRITE_CONSOLE("          \t\t<arg> is BeginCommandBuffer=<n>,Draw=<m>,BeginRenderPass=<o>,");
     GFXRECON_WRITE_CONSOLE("          \t\tNextSubpass=<p>,Dispatch=<q>,CmdTraceRays=<r>,QueueSubmit=<s>");
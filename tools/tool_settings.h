@@ -28,6 +28,7 @@
 #include <initguid.h>
 #include "generated/generated_dx12_decoder.h"
 #endif
+#include "decode/decode_allocator.h"
 #include "decode/file_processor.h"
 #include "decode/vulkan_default_allocator.h"
 #include "decode/vulkan_realign_allocator.h"
@@ -45,6 +46,7 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <cassert>
 #include <cstdlib>
 #include <limits>
 #include <sstream>
@@ -106,6 +108,9 @@ const char kMeasurementFileArgument[]            = "--measurement-file";
 const char kQuitAfterMeasurementRangeOption[]    = "--quit-after-measurement-range";
 const char kFlushMeasurementRangeOption[]        = "--flush-measurement-range";
 const char kFlushInsideMeasurementRangeOption[]  = "--flush-inside-measurement-range";
+const char kMeasurementCostBreakdownOption[]     = "--measurement-cost-breakdown";
+const char kDecodeBlockSizeArgument[]            = "--decode-block-size";
+const char kDecodeHugePagesOption[]              = "--decode-huge-pages";
 const char kSwapchainOption[]                    = "--swapchain";
 const char kEnableUseCapturedSwapchainIndices[] =
     "--use-captured-swapchain-indices"; // The same: util::SwapchainOption::kCaptured
@@ -120,6 +125,7 @@ const char kFilePerFrameOption[]                  = "--file-per-frame";
 const char kSkipGetFenceStatus[]                  = "--skip-get-fence-status";
 const char kSkipGetFenceRanges[]                  = "--skip-get-fence-ranges";
 const char kWaitBeforePresent[]                   = "--wait-before-present";
+const char kReuseCommandBuffers[]                 = "--reuse-command-buffers";
 const char kPrintBlockInfoAllOption[]             = "--pbi-all";
 const char kPrintBlockInfosArgument[]             = "--pbis";
 #if defined(WIN32)
@@ -287,6 +293,42 @@ InitRealignAllocatorCreateFunc(const std::string&                              f
     };
 }
 
+// Parses a non-negative integer argument value, returning false if the value is not a valid number or is greater than
+// max_value.
+static bool ParseUnsignedArgument(const std::string& value, uint64_t max_value, uint64_t* result)
+{
+    assert(result != nullptr);
+
+    // Values with up to 19 digits fit in 64 bits.
+    if (value.empty() || (value.find_first_not_of("0123456789") != std::string::npos) || (value.size() > 19))
+    {
+        return false;
+    }
+
+    const uint64_t parsed_value = std::strtoull(value.c_str(), nullptr, 10);
+    if (parsed_value > max_value)
+    {
+        return false;
+    }
+
+    (*result) = parsed_value;
+    return true;
+}
+
+static bool ParseUnsignedArgument(const std::string& value, uint32_t* result)
+{
+    assert(result != nullptr);
+
+    uint64_t parsed_value = 0;
+    if (!ParseUnsignedArgument(value, std::numeric_limits<uint32_t>::max(), &parsed_value))
+    {
+        return false;
+    }
+
+    (*result) = static_cast<uint32_t>(parsed_value);
+    return true;
+}
+
 static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     uint32_t    pause_frame = 0;
@@ -304,6 +346,36 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+// Returns false if the decode block size argument is not a valid size.
+static bool ConfigureDecodeAllocator(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint64_t    block_size = 0;
+    const auto& value      = arg_parser.GetArgumentValue(kDecodeBlockSizeArgument);
+
+    if (!value.empty() &&
+        (!ParseUnsignedArgument(value, gfxrecon::decode::DecodeAllocator::kMaxBlockSize, &block_size) ||
+         (block_size < gfxrecon::decode::DecodeAllocator::kMinBlockSize)))
+    {
+        GFXRECON_LOG_ERROR("Invalid value \'%s\' for %s. Expected a size in bytes from %zu to %zu.",
+                           value.c_str(),
+                           kDecodeBlockSizeArgument,
+                           gfxrecon::decode::DecodeAllocator::kMinBlockSize,
+                           gfxrecon::decode::DecodeAllocator::kMaxBlockSize);
+        return false;
+    }
+
+    const bool use_huge_pages = arg_parser.IsOptionSet(kDecodeHugePagesOption);
+
+    if ((block_size > 0) || use_huge_pages)
+    {
+        gfxrecon::decode::DecodeAllocator::Configure(static_cast<size_t>(block_size),
+                                                     gfxrecon::decode::DecodeAllocator::kDefaultMaxCachedBytes,
+                                                     use_huge_pages);
+    }
+
+    return true;
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -898,6 +970,11 @@ static void GetReplayOptions(gfxrecon::decode::ReplayOptions&      options,
         options.flush_inside_measurement_range = true;
     }
 
+    if (arg_parser.IsOptionSet(kMeasurementCostBreakdownOption))
+    {
+        options.measurement_cost_breakdown = true;
+    }
+
     if (arg_parser.IsOptionSet(kPrintBlockInfoAllOption))
     {
         options.enable_print_block_info = true;
@@ -1088,6 +1165,19 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
         replay_options.dump_resources_color_attachment_index = std::stoi(dr_color_att_idx);
     }
 
+    if (arg_parser.IsOptionSet(kReuseCommandBuffers))
+    {
+        // Resource dumping instruments the command buffers that it records, so recordings are never skipped.
+        if (replay_options.dumping_resources)
+        {
+            GFXRECON_LOG_WARNING("Ignoring --reuse-command-buffers, which is not supported with --dump-resources");
+        }
+        else
+        {
+            replay_options.reuse_command_buffers = true;
+        }
+    }
+
     return replay_options;
 }
 